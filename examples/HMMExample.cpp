@@ -18,6 +18,7 @@
 
 #include <gtsam/discrete/DiscreteFactorGraph.h>
 #include <gtsam/discrete/DiscreteMarginals.h>
+#include <gtsam/discrete/DiscreteViterbi.h>
 #include <gtsam/inference/BayesNet.h>
 
 #include <iomanip>
@@ -63,6 +64,11 @@ int main(int argc, char **argv) {
   auto mpe = factorGraph.optimize();
   GTSAM_PRINT(mpe);
 
+  // For chains, Viterbi in log-space gives the same result, and scales to
+  // long sequences and batches of observation sequences.
+  DiscreteViterbi viterbi(factorGraph);
+  GTSAM_PRINT(viterbi.optimize());
+
   // Create solver and eliminate
   // This will create a DAG ordered with arrow of time reversed
   DiscreteBayesNet::shared_ptr chordal =
@@ -0,0 +1,193 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteBatchSampler.cpp
+ * @brief Draw many joint samples from a discrete Bayes net or Bayes tree.
+ * @date October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+#include <gtsam/discrete/DiscreteBatchSampler.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <boost/range/adaptor/reversed.hpp>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+using std::vector;
+
+namespace gtsam {
+
+const size_t DiscreteBatchSampler::kBlockSize;
+
+/* ************************************************************************ */
+DiscreteBatchSampler::DiscreteBatchSampler(const DiscreteBayesNet& bayesNet) {
+  vector<DiscreteConditional::shared_ptr> conditionals;
+  for (auto conditional : boost::adaptors::reverse(bayesNet))
+    conditionals.push_back(conditional);
+  initialize(conditionals);
+}
+
+/* ************************************************************************ */
+namespace {
+// Collect clique conditionals in pre-order, i.e., parents before children.
+void collectConditionals(
+    const DiscreteBayesTree::sharedClique& clique,
+    vector<DiscreteConditional::shared_ptr>* conditionals) {
+  if (clique->conditional()) conditionals->push_back(clique->conditional());
+  for (const auto& child : clique->children)
+    collectConditionals(child, conditionals);
+}
+}  // namespace
+
+DiscreteBatchSampler::DiscreteBatchSampler(const DiscreteBayesTree& bayesTree) {
+  vector<DiscreteConditional::shared_ptr> conditionals;
+  for (const auto& root : bayesTree.roots())
+    collectConditionals(root, &conditionals);
+  initialize(conditionals);
+}
+
+/* ************************************************************************ */
+void DiscreteBatchSampler::initialize(
+    const vector<DiscreteConditional::shared_ptr>& conditionals) {
+  gttic(DiscreteBatchSampler_initialize);
+
+  // Dense indices for all variables.
+  std::map<Key, size_t> cardinalities;
+  for (const auto& conditional : conditionals)
+    for (const DiscreteKey& dkey : conditional->discreteKeys())
+      cardinalities.emplace(dkey.first, dkey.second);
+  for (auto&& kv : cardinalities) keys_.push_back(kv.first);
+  auto indexOf = [this](Key key) {
+    return static_cast<size_t>(
+        std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin());
+  };
+
+  tables_.reserve(conditionals.size());
+  for (const auto& conditional : conditionals) {
+    Table table;
+    size_t nrParentValues = 1;
+    table.nrFrontalValues = 1;
+    for (Key key : conditional->frontals()) {
+      table.frontals.push_back(indexOf(key));
+      table.frontalCards.push_back(cardinalities.at(key));
+      table.nrFrontalValues *= table.frontalCards.back();
+    }
+    for (Key key : conditional->parents()) {
+      table.parents.push_back(indexOf(key));
+      table.parentCards.push_back(cardinalities.at(key));
+      nrParentValues *= table.parentCards.back();
+    }
+
+    // Evaluate the conditional for every assignment, with the first variable
+    // varying fastest, and accumulate into one CDF per parent assignment.
+    table.cdfs.resize(nrParentValues * table.nrFrontalValues);
+    DiscreteValues values;
+    for (size_t p = 0; p < nrParentValues; ++p) {
+      size_t index = p;
+      for (size_t i = 0; i < table.parents.size(); ++i) {
+        values[keys_[table.parents[i]]] = index % table.parentCards[i];
+        index /= table.parentCards[i];
+      }
+      double* cdf = &table.cdfs[p * table.nrFrontalValues];
+      double sum = 0.0;
+      for (size_t f = 0; f < table.nrFrontalValues; ++f) {
+        index = f;
+        for (size_t i = 0; i < table.frontals.size(); ++i) {
+          values[keys_[table.frontals[i]]] = index % table.frontalCards[i];
+          index /= table.frontalCards[i];
+        }
+        sum += (*conditional)(values);
+        cdf[f] = sum;
+      }
+      if (!(sum > 0.0))
+        throw std::invalid_argument(
+            "DiscreteBatchSampler: conditional has zero probability mass for "
+            "some parent assignment.");
+      for (size_t f = 0; f < table.nrFrontalValues; ++f) cdf[f] /= sum;
+    }
+    tables_.push_back(std::move(table));
+  }
+}
+
+/* ************************************************************************ */
+void DiscreteBatchSampler::sampleBlock(size_t block, size_t begin, size_t end,
+                                       std::uint64_t seed,
+                                       Samples* samples) const {
+  std::seed_seq seq{static_cast<std::uint32_t>(seed),
+                    static_cast<std::uint32_t>(seed >> 32),
+                    static_cast<std::uint32_t>(block)};
+  std::mt19937_64 rng(seq);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  for (size_t s = begin; s < end; ++s) {
+    size_t* row = samples->row(s).data();
+    for (const Table& table : tables_) {
+      size_t p = 0, stride = 1;
+      for (size_t i = 0; i < table.parents.size(); ++i) {
+        p += stride * row[table.parents[i]];
+        stride *= table.parentCards[i];
+      }
+      const double* cdf = &table.cdfs[p * table.nrFrontalValues];
+      const double u = uniform(rng);
+      size_t f = std::upper_bound(cdf, cdf + table.nrFrontalValues, u) - cdf;
+      f = std::min(f, table.nrFrontalValues - 1);  // guard against round-off
+      for (size_t i = 0; i < table.frontals.size(); ++i) {
+        row[table.frontals[i]] = f % table.frontalCards[i];
+        f /= table.frontalCards[i];
+      }
+    }
+  }
+}
+
+/* ************************************************************************ */
+DiscreteBatchSampler::Samples DiscreteBatchSampler::sampleMatrix(
+    size_t N, std::uint64_t seed) const {
+  gttic(DiscreteBatchSampler_sampleMatrix);
+  Samples samples(N, keys_.size());
+  const size_t nrBlocks = (N + kBlockSize - 1) / kBlockSize;
+  auto sampleBlocks = [&](size_t firstBlock, size_t lastBlock) {
+    for (size_t block = firstBlock; block < lastBlock; ++block)
+      sampleBlock(block, block * kBlockSize,
+                  std::min(N, (block + 1) * kBlockSize), seed, &samples);
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, nrBlocks),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      sampleBlocks(range.begin(), range.end());
+                    });
+#else
+  sampleBlocks(0, nrBlocks);
+#endif
+  return samples;
+}
+
+/* ************************************************************************ */
+vector<DiscreteValues> DiscreteBatchSampler::sample(size_t N,
+                                                    std::uint64_t seed) const {
+  const Samples samples = sampleMatrix(N, seed);
+  vector<DiscreteValues> result(N);
+  for (size_t s = 0; s < N; ++s)
+    for (size_t j = 0; j < keys_.size(); ++j)
+      result[s][keys_[j]] = samples(s, j);
+  return result;
+}
+
+}  // namespace gtsam
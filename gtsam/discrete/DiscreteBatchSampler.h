@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteBatchSampler.h
+ * @brief Draw many joint samples from a discrete Bayes net or Bayes tree.
+ * @date October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/discrete/DiscreteBayesNet.h>
+#include <gtsam/discrete/DiscreteBayesTree.h>
+#include <gtsam/discrete/DiscreteValues.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * @brief Batch sampler for discrete Bayes nets and Bayes trees.
+ *
+ * `DiscreteBayesNet::sample` walks the conditionals for one joint sample at a
+ * time, evaluating decision trees and building a std::discrete_distribution
+ * for every variable. This class instead converts every conditional once into
+ * a table of cumulative distributions, one row per parent assignment, so that
+ * drawing a sample from a conditional is a binary search.
+ *
+ * Samples are drawn in blocks of `kBlockSize`, and every block uses its own
+ * random number generator seeded from the user seed and the block index. With
+ * TBB, blocks are sampled in parallel; the result only depends on the seed,
+ * not on the number of threads.
+ */
+class GTSAM_EXPORT DiscreteBatchSampler {
+ public:
+  /// Dense samples: row s holds sample s, one column per variable in keys().
+  using Samples =
+      Eigen::Matrix<size_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  /// Number of samples drawn with the same random number generator.
+  static const size_t kBlockSize = 256;
+
+  /// Construct from a Bayes net, sampled in topological order (parents first).
+  explicit DiscreteBatchSampler(const DiscreteBayesNet& bayesNet);
+
+  /// Construct from a Bayes tree, sampled from the roots down.
+  explicit DiscreteBatchSampler(const DiscreteBayesTree& bayesTree);
+
+  /// Keys of all variables, sorted, defining the columns of `Samples`.
+  const KeyVector& keys() const { return keys_; }
+
+  /// Draw N joint samples as a dense matrix.
+  Samples sampleMatrix(size_t N, std::uint64_t seed = 42u) const;
+
+  /// Draw N joint samples.
+  std::vector<DiscreteValues> sample(size_t N, std::uint64_t seed = 42u) const;
+
+ private:
+  /// Cumulative distribution tables for one conditional.
+  struct Table {
+    std::vector<size_t> frontals, parents;  ///< dense variable indices
+    std::vector<size_t> frontalCards, parentCards;
+    size_t nrFrontalValues;    ///< product of frontal cardinalities
+    std::vector<double> cdfs;  ///< one CDF of that size per parent assignment
+  };
+
+  KeyVector keys_;             ///< sorted keys of all variables
+  std::vector<Table> tables_;  ///< in sampling order, parents first
+
+  /// Convert conditionals, given in sampling order.
+  void initialize(
+      const std::vector<DiscreteConditional::shared_ptr>& conditionals);
+
+  /// Draw samples [begin, end) into the given matrix.
+  void sampleBlock(size_t block, size_t begin, size_t end, std::uint64_t seed,
+                   Samples* samples) const;
+};
+
+}  // namespace gtsam
@@ -0,0 +1,221 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteViterbi.cpp
+ * @brief Log-space, batched max-product for chain and tree-structured graphs.
+ * @date October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/discrete/DiscreteViterbi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
+using std::vector;
+
+namespace gtsam {
+
+static const double kNegInf = -std::numeric_limits<double>::infinity();
+
+/* ************************************************************************ */
+DiscreteViterbi::DiscreteViterbi(const DiscreteFactorGraph& graph) {
+  gttic(DiscreteViterbi_constructor);
+
+  // Collect variables and their cardinalities.
+  std::map<Key, size_t> cardinalities;
+  vector<DecisionTreeFactor> tables;
+  tables.reserve(graph.size());
+  for (const auto& factor : graph) {
+    if (!factor) continue;
+    if (factor->size() > 2)
+      throw std::invalid_argument(
+          "DiscreteViterbi: only unary and pairwise factors are supported.");
+    tables.push_back(factor->toDecisionTreeFactor());
+    for (const DiscreteKey& dkey : tables.back().discreteKeys())
+      cardinalities.emplace(dkey.first, dkey.second);
+  }
+
+  for (auto&& kv : cardinalities) {
+    keys_.push_back(kv.first);
+    cardinalities_.push_back(kv.second);
+    logUnary_.push_back(Vector::Zero(kv.second));
+  }
+  const size_t n = keys_.size();
+
+  // Convert all factors to log-space. Pairwise tables are stored as
+  // card(i)*card(j) with i<j, and multiple factors on the same pair combined.
+  std::map<std::pair<Index, Index>, Matrix> pairwise;
+  for (const DecisionTreeFactor& table : tables) {
+    if (table.size() == 0) continue;
+    if (table.size() == 1) {
+      const Key key = table.front();
+      Vector& logUnary = logUnary_[indexOf(key)];
+      for (auto&& kv : table.enumerate())
+        logUnary(kv.first.at(key)) += std::log(kv.second);
+    } else {
+      Key key1 = table.keys()[0], key2 = table.keys()[1];
+      if (key1 > key2) std::swap(key1, key2);
+      const Index i = indexOf(key1), j = indexOf(key2);
+      auto it = pairwise.find({i, j});
+      if (it == pairwise.end())
+        it = pairwise
+                 .emplace(std::make_pair(i, j),
+                          Matrix::Zero(cardinalities_[i], cardinalities_[j]))
+                 .first;
+      for (auto&& kv : table.enumerate())
+        it->second(kv.first.at(key1), kv.first.at(key2)) += std::log(kv.second);
+    }
+  }
+
+  // Adjacency lists of the pairwise structure.
+  vector<vector<Index>> neighbors(n);
+  for (auto&& kv : pairwise) {
+    neighbors[kv.first.first].push_back(kv.first.second);
+    neighbors[kv.first.second].push_back(kv.first.first);
+  }
+
+  // Breadth-first search from the smallest unvisited key, so every tree in the
+  // forest gets rooted. Any edge to an already visited vertex other than the
+  // parent closes a loop.
+  parent_.assign(n, -1);
+  logPairwise_.resize(n);
+  order_.reserve(n);
+  vector<bool> visited(n, false);
+  for (size_t root = 0; root < n; ++root) {
+    if (visited[root]) continue;
+    visited[root] = true;
+    std::queue<Index> queue;
+    queue.push(root);
+    while (!queue.empty()) {
+      const Index p = queue.front();
+      queue.pop();
+      order_.push_back(p);
+      for (Index c : neighbors[p]) {
+        if (c == parent_[p]) continue;
+        if (visited[c])
+          throw std::invalid_argument(
+              "DiscreteViterbi: pairwise factors do not form a chain or tree.");
+        visited[c] = true;
+        parent_[c] = p;
+        // Orient the table as card(child)*card(parent).
+        logPairwise_[c] = (c < p) ? pairwise.at({c, p})
+                                  : Matrix(pairwise.at({p, c}).transpose());
+        queue.push(c);
+      }
+    }
+  }
+}
+
+/* ************************************************************************ */
+DiscreteViterbi::Index DiscreteViterbi::indexOf(Key key) const {
+  auto it = std::lower_bound(keys_.begin(), keys_.end(), key);
+  if (it == keys_.end() || *it != key)
+    throw std::out_of_range("DiscreteViterbi: unknown key " +
+                            DefaultKeyFormatter(key));
+  return static_cast<Index>(it - keys_.begin());
+}
+
+/* ************************************************************************ */
+DiscreteViterbi::Assignments DiscreteViterbi::argmax(
+    const LogEvidence& evidence, size_t batchSize, Vector* logValues) const {
+  gttic(DiscreteViterbi_argmax);
+  const size_t n = size();
+  if (!evidence.empty()) batchSize = evidence.begin()->second.rows();
+  const Eigen::Index B = batchSize;
+
+  // Initialize beliefs: B*card(j) matrices, one column per state, so that all
+  // kernels below work on contiguous columns across the batch.
+  vector<Matrix> beliefs(n);
+  for (size_t j = 0; j < n; ++j)
+    beliefs[j] = logUnary_[j].transpose().replicate(B, 1);
+  for (auto&& kv : evidence) {
+    const Index j = indexOf(kv.first);
+    if (kv.second.rows() != B ||
+        kv.second.cols() != static_cast<Eigen::Index>(cardinalities_[j]))
+      throw std::invalid_argument(
+          "DiscreteViterbi::argmax: evidence for " +
+          DefaultKeyFormatter(kv.first) + " has wrong dimensions.");
+    beliefs[j] += kv.second;
+  }
+
+  // Upward pass: leaves to roots, max-marginalizing every child into its
+  // parent and storing the argmax for every parent state.
+  vector<Eigen::ArrayXXi> backPointers(n);
+  Eigen::ArrayXd best(B), candidate(B);
+  Eigen::ArrayXi arg(B);
+  for (auto it = order_.rbegin(); it != order_.rend(); ++it) {
+    const Index c = *it, p = parent_[c];
+    if (p < 0) continue;
+    const Matrix& W = logPairwise_[c];
+    const Matrix& belief = beliefs[c];
+    Eigen::ArrayXXi& bp = backPointers[c];
+    bp.resize(B, W.cols());
+    for (Eigen::Index xp = 0; xp < W.cols(); ++xp) {
+      best.setConstant(kNegInf);
+      arg.setZero();
+      for (Eigen::Index xc = 0; xc < W.rows(); ++xc) {
+        candidate = belief.col(xc).array() + W(xc, xp);
+        arg = (candidate > best).select(static_cast<int>(xc), arg);
+        best = best.max(candidate);
+      }
+      beliefs[p].col(xp).array() += best;
+      bp.col(xp) = arg;
+    }
+  }
+
+  // Downward pass: pick the best root states, then follow back-pointers.
+  Assignments result(B, n);
+  if (logValues) logValues->setZero(B);
+  for (Index j : order_) {
+    const Index p = parent_[j];
+    if (p < 0) {
+      const Matrix& belief = beliefs[j];
+      for (Eigen::Index b = 0; b < B; ++b) {
+        Eigen::Index x = 0;
+        const double value = belief.row(b).maxCoeff(&x);
+        result(b, j) = x;
+        if (logValues) (*logValues)(b) += value;
+      }
+    } else {
+      const Eigen::ArrayXXi& bp = backPointers[j];
+      for (Eigen::Index b = 0; b < B; ++b)
+        result(b, j) = bp(b, result(b, p));
+    }
+  }
+  return result;
+}
+
+/* ************************************************************************ */
+DiscreteValues DiscreteViterbi::optimize() const {
+  const Assignments assignments = argmax(LogEvidence());
+  DiscreteValues values;
+  for (size_t j = 0; j < size(); ++j) values[keys_[j]] = assignments(0, j);
+  return values;
+}
+
+/* ************************************************************************ */
+vector<DiscreteValues> DiscreteViterbi::optimize(
+    const LogEvidence& evidence) const {
+  const Assignments assignments = argmax(evidence);
+  vector<DiscreteValues> result(assignments.rows());
+  for (Eigen::Index b = 0; b < assignments.rows(); ++b)
+    for (size_t j = 0; j < size(); ++j)
+      result[b][keys_[j]] = assignments(b, j);
+  return result;
+}
+
+}  // namespace gtsam
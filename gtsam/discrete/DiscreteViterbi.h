@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file DiscreteViterbi.h
+ * @brief Log-space, batched max-product for chain and tree-structured graphs.
+ * @date October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/base/Matrix.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/discrete/DiscreteValues.h>
+
+#include <map>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * @brief Viterbi (max-sum) engine for discrete graphs without loops.
+ *
+ * `DiscreteFactorGraph::maxProduct` eliminates with decision-tree factors in
+ * probability space, which underflows on long chains and pays tree overhead
+ * for every product. When the graph only contains unary and pairwise factors
+ * that form a chain or, more generally, a forest, the MPE can be computed by
+ * max-sum message passing on dense log-probability tables instead.
+ *
+ * The structure (and all factors in the graph) is converted once at
+ * construction. Afterwards, many sequences can be decoded in a single batch:
+ * each sequence supplies additional unary log-potentials (e.g., observation
+ * log-likelihoods of an HMM), and the max/argmax kernels operate on all
+ * sequences at once, as contiguous Eigen columns.
+ *
+ * Example, decoding B sequences of an HMM with transition graph `graph`:
+ * @code
+ *   DiscreteViterbi viterbi(graph);
+ *   DiscreteViterbi::LogEvidence evidence;
+ *   for (size_t k = 0; k < T; k++) evidence[k] = logLikelihoods[k];  // B x N
+ *   std::vector<DiscreteValues> mpes = viterbi.optimize(evidence);
+ * @endcode
+ */
+class GTSAM_EXPORT DiscreteViterbi {
+ public:
+  /**
+   * Per-variable log-potentials for a batch of sequences: for a variable with
+   * cardinality N and a batch of size B, a B*N matrix with row b holding the
+   * log-potentials for sequence b.
+   */
+  using LogEvidence = std::map<Key, Matrix>;
+
+  /**
+   * Dense argmax assignments for a batch: row b holds the MPE of sequence b,
+   * with one column per variable in the order given by `keys()`.
+   */
+  using Assignments =
+      Eigen::Matrix<size_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  /**
+   * @brief Construct from a graph of unary and pairwise factors.
+   *
+   * Factors are converted to log-space tables, and factors on the same
+   * variables are combined. Throws std::invalid_argument if the graph contains
+   * factors on more than two variables, or if the pairwise factors contain a
+   * loop.
+   */
+  explicit DiscreteViterbi(const DiscreteFactorGraph& graph);
+
+  /// Keys of all variables, sorted, defining the columns of `Assignments`.
+  const KeyVector& keys() const { return keys_; }
+
+  /// Cardinality of the variable with index i in `keys()`.
+  size_t cardinality(size_t i) const { return cardinalities_[i]; }
+
+  /// Number of variables.
+  size_t size() const { return keys_.size(); }
+
+  /**
+   * @brief Decode a batch of sequences into a dense assignment matrix.
+   *
+   * @param evidence unary log-potentials for some or all variables, all with
+   * the same number of rows (the batch size). Pass an empty map and
+   * batchSize=1 to find the MPE of the graph itself.
+   * @param batchSize only used when evidence is empty.
+   * @param logValues optional output: maximal log-value of each sequence.
+   * @return batchSize*size() matrix of optimal assignments.
+   */
+  Assignments argmax(const LogEvidence& evidence, size_t batchSize = 1,
+                     Vector* logValues = nullptr) const;
+
+  /// Find the MPE of the graph itself, as DiscreteValues.
+  DiscreteValues optimize() const;
+
+  /// Decode a batch of sequences, returning one DiscreteValues per sequence.
+  std::vector<DiscreteValues> optimize(const LogEvidence& evidence) const;
+
+ private:
+  /// Dense index of the parent of every variable, or -1 for roots.
+  using Index = int;
+
+  KeyVector keys_;                     ///< sorted keys
+  std::vector<size_t> cardinalities_;  ///< cardinality per variable
+  std::vector<Vector> logUnary_;       ///< log of product of unary factors
+  std::vector<Index> order_;           ///< BFS order, parents before children
+  std::vector<Index> parent_;          ///< parent per variable, -1 for roots
+  /// For every non-root variable c: log table of size card(c)*card(parent).
+  std::vector<Matrix> logPairwise_;
+
+  /// Dense index for a key, throws std::out_of_range if not present.
+  Index indexOf(Key key) const;
+};
+
+}  // namespace gtsam
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/*
+ *  @file testDiscreteBatchSampler.cpp
+ *  @date October, 2026
+ */
+
+#include <gtsam/discrete/DiscreteBatchSampler.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+static const DiscreteKey Parent(0, 2), Child(1, 3), Other(2, 2);
+
+namespace {
+DiscreteBayesNet createBayesNet() {
+  DiscreteBayesNet bayesNet;
+  bayesNet.add(Child | Parent = "7/2/1 2/3/5");
+  bayesNet.add(Other | Parent = "1/3 1/1");
+  bayesNet.add(Parent % "6/4");
+  return bayesNet;
+}
+
+// Fraction of samples with the given value in column j.
+double frequency(const DiscreteBatchSampler::Samples& samples, size_t j,
+                 size_t value) {
+  return (samples.col(j).array() == value).cast<double>().mean();
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(DiscreteBatchSampler, BayesNet) {
+  DiscreteBatchSampler sampler(createBayesNet());
+  EXPECT_LONGS_EQUAL(3, sampler.keys().size());
+
+  // Expected marginals.
+  const double pChild0 = 0.6 * 0.7 + 0.4 * 0.2;
+  const double pChild2 = 0.6 * 0.1 + 0.4 * 0.5;
+  const double pOther0 = 0.6 * 0.25 + 0.4 * 0.5;
+
+  const auto samples = sampler.sampleMatrix(20000);
+  EXPECT_LONGS_EQUAL(20000, samples.rows());
+  EXPECT_DOUBLES_EQUAL(0.6, frequency(samples, 0, 0), 0.02);
+  EXPECT_DOUBLES_EQUAL(pChild0, frequency(samples, 1, 0), 0.02);
+  EXPECT_DOUBLES_EQUAL(pChild2, frequency(samples, 1, 2), 0.02);
+  EXPECT_DOUBLES_EQUAL(pOther0, frequency(samples, 2, 0), 0.02);
+
+  // Joint P(Parent=1, Child=2) = 0.4 * 0.5
+  const double joint =
+      ((samples.col(0).array() == size_t(1)) &&
+       (samples.col(1).array() == size_t(2)))
+          .cast<double>()
+          .mean();
+  EXPECT_DOUBLES_EQUAL(0.2, joint, 0.02);
+}
+
+/* ************************************************************************* */
+TEST(DiscreteBatchSampler, BayesTree) {
+  DiscreteFactorGraph graph(createBayesNet());
+  auto bayesTree = graph.eliminateMultifrontal();
+  DiscreteBatchSampler sampler(*bayesTree);
+
+  const auto samples = sampler.sampleMatrix(20000, 7);
+  EXPECT_DOUBLES_EQUAL(0.6, frequency(samples, 0, 0), 0.02);
+  EXPECT_DOUBLES_EQUAL(0.6 * 0.7 + 0.4 * 0.2, frequency(samples, 1, 0), 0.02);
+  EXPECT_DOUBLES_EQUAL(0.6 * 0.25 + 0.4 * 0.5, frequency(samples, 2, 0), 0.02);
+}
+
+/* ************************************************************************* */
+TEST(DiscreteBatchSampler, Reproducible) {
+  DiscreteBatchSampler sampler(createBayesNet());
+  const size_t N = 3 * DiscreteBatchSampler::kBlockSize + 5;
+  const auto samples1 = sampler.sampleMatrix(N, 123);
+  const auto samples2 = sampler.sampleMatrix(N, 123);
+  const auto samples3 = sampler.sampleMatrix(N, 321);
+  EXPECT(samples1 == samples2);
+  EXPECT(samples1 != samples3);
+
+  // Sampling fewer than N gives a prefix of the same samples.
+  const auto prefix = sampler.sampleMatrix(N - 10, 123);
+  EXPECT(prefix == samples1.topRows(N - 10));
+
+  const vector<DiscreteValues> values = sampler.sample(N, 123);
+  EXPECT_LONGS_EQUAL(N, values.size());
+  EXPECT_LONGS_EQUAL(samples1(N - 1, 1), values.back().at(Child.first));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
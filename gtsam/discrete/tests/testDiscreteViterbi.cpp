@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/*
+ *  @file testDiscreteViterbi.cpp
+ *  @date October, 2026
+ */
+
+#include <gtsam/discrete/DiscreteBayesNet.h>
+#include <gtsam/discrete/DiscreteFactorGraph.h>
+#include <gtsam/discrete/DiscreteViterbi.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <cmath>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// Create an HMM with the given number of steps and 3 states.
+DiscreteBayesNet createHMM(size_t nrSteps, vector<DiscreteKey>* keys) {
+  for (size_t k = 0; k < nrSteps; k++) keys->emplace_back(k, 3);
+  DiscreteBayesNet hmm;
+  hmm.add((*keys)[0] % "7/2/1");
+  for (size_t k = 1; k < nrSteps; k++)
+    hmm.add((*keys)[k] | (*keys)[k - 1] = "8/1/1 1/8/1 1/1/8");
+  return hmm;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(DiscreteViterbi, HMM) {
+  vector<DiscreteKey> keys;
+  DiscreteBayesNet hmm = createHMM(4, &keys);
+  hmm.add(keys[1] % "1/9/0");
+  hmm.add(keys.back() % "1/4/5");
+  DiscreteFactorGraph graph(hmm);
+
+  DiscreteViterbi viterbi(graph);
+  EXPECT_LONGS_EQUAL(4, viterbi.size());
+  EXPECT(assert_equal(graph.optimize(), viterbi.optimize()));
+}
+
+/* ************************************************************************* */
+TEST(DiscreteViterbi, Tree) {
+  // Star-shaped tree plus a disconnected variable.
+  DiscreteKey A(0, 2), B(1, 3), C(2, 2), D(3, 2), E(4, 3);
+  DiscreteFactorGraph graph;
+  graph.add(A, "0.4 0.6");
+  graph.add(A & B, "1 2 3  4 1 2");
+  graph.add(C & A, "5 1  1 3");
+  graph.add(A & D, "2 3  9 1");
+  graph.add(C, "1 2");
+  graph.add(C & A, "1 2  3 4");  // second factor on the same pair
+  graph.add(E, "3 4 1");
+
+  DiscreteViterbi viterbi(graph);
+  Vector logValues;
+  auto assignments = viterbi.argmax(DiscreteViterbi::LogEvidence(), 1,
+                                    &logValues);
+  EXPECT_LONGS_EQUAL(1, assignments.rows());
+  const DiscreteValues expected = graph.optimize();
+  EXPECT(assert_equal(expected, viterbi.optimize()));
+  EXPECT_DOUBLES_EQUAL(std::log(graph(expected)), logValues(0), 1e-9);
+}
+
+/* ************************************************************************* */
+TEST(DiscreteViterbi, Batch) {
+  vector<DiscreteKey> keys;
+  const size_t T = 5, B = 4;
+  DiscreteFactorGraph graph(createHMM(T, &keys));
+  DiscreteViterbi viterbi(graph);
+
+  // Observation likelihoods for B sequences.
+  DiscreteViterbi::LogEvidence evidence;
+  for (size_t k = 0; k < T; k++) {
+    Matrix likelihoods(B, 3);
+    for (size_t b = 0; b < B; b++)
+      for (size_t x = 0; x < 3; x++)
+        likelihoods(b, x) = 1.0 + ((3 * k + 5 * b + 7 * x) % 11);
+    evidence[k] = likelihoods.array().log().matrix();
+  }
+
+  const auto actual = viterbi.optimize(evidence);
+  EXPECT_LONGS_EQUAL(B, actual.size());
+  for (size_t b = 0; b < B; b++) {
+    // Compare with max-product on the graph with the evidence added.
+    DiscreteFactorGraph withEvidence = graph;
+    for (size_t k = 0; k < T; k++) {
+      const Vector p = evidence[k].row(b).transpose().array().exp();
+      withEvidence.add(keys[k], vector<double>{p(0), p(1), p(2)});
+    }
+    EXPECT(assert_equal(withEvidence.optimize(), actual[b]));
+  }
+}
+
+/* ************************************************************************* */
+TEST(DiscreteViterbi, LongChain) {
+  // A chain long enough that the joint probability underflows.
+  vector<DiscreteKey> keys;
+  const size_t T = 2000;
+  DiscreteBayesNet hmm = createHMM(T, &keys);
+  hmm.add(keys.back() % "1/1/8");
+  DiscreteViterbi viterbi{DiscreteFactorGraph(hmm)};
+
+  Vector logValues;
+  auto assignments = viterbi.argmax(DiscreteViterbi::LogEvidence(), 1,
+                                    &logValues);
+  // Staying in state 2 throughout is most likely.
+  for (size_t k = 0; k < T; k++) EXPECT_LONGS_EQUAL(2, assignments(0, k));
+  const double expected = std::log(0.1) + (T - 1) * std::log(0.8) +
+                          std::log(0.8);
+  EXPECT_DOUBLES_EQUAL(expected, logValues(0), 1e-6);
+}
+
+/* ************************************************************************* */
+TEST(DiscreteViterbi, Exceptions) {
+  DiscreteKey A(0, 2), B(1, 2), C(2, 2);
+  DiscreteFactorGraph loop;
+  loop.add(A & B, "1 2 3 4");
+  loop.add(B & C, "1 2 3 4");
+  loop.add(C & A, "1 2 3 4");
+  CHECK_EXCEPTION(DiscreteViterbi{loop}, std::invalid_argument);
+
+  DiscreteFactorGraph ternary;
+  ternary.add(A & B & C, "1 2 3 4 5 6 7 8");
+  CHECK_EXCEPTION(DiscreteViterbi{ternary}, std::invalid_argument);
+
+  DiscreteFactorGraph chain;
+  chain.add(A & B, "1 2 3 4");
+  DiscreteViterbi viterbi(chain);
+  DiscreteViterbi::LogEvidence evidence;
+  evidence[0] = Matrix::Zero(2, 3);  // wrong cardinality
+  CHECK_EXCEPTION(viterbi.optimize(evidence), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
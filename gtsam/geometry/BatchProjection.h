@@ -0,0 +1,402 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   BatchProjection.h
+ * @brief  Structure-of-arrays projection kernels for pinhole cameras
+ * @date   October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/CalibratedCamera.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Cal3DS2.h>
+#include <gtsam/geometry/Point2.h>
+#include <gtsam/geometry/Point3.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+namespace gtsam {
+
+namespace internal {
+/// Number of projections computed together, each in one lane of the arrays
+static const int kProjectionLanes = 4;
+
+/// One scalar quantity for all lanes, a fixed-size array Eigen vectorizes
+typedef Eigen::Array<double, kProjectionLanes, 1> ProjectionLane;
+}  // namespace internal
+
+/**
+ * Vectorized uncalibrate, for calibration models that support it.
+ * A specialization stores the parameters of one calibration in one lane of
+ * nrParameters arrays, and uncalibrates all lanes at once, computing the 2*2
+ * derivative Dp with respect to the point and, optionally, the 2*dimension
+ * derivative Dcal with respect to the calibration, both row-major.
+ */
+template <class CALIBRATION>
+struct BatchCalibration {
+  static const bool supported = false;
+};
+
+/// Vectorized Cal3_S2::uncalibrate
+template <>
+struct BatchCalibration<Cal3_S2> {
+  typedef internal::ProjectionLane Lane;
+  static const bool supported = true;
+  static const int dimension = 5;
+  static const int nrParameters = 5;
+
+  static void Load(const Cal3_S2& K, Lane* k, int lane) {
+    k[0](lane) = K.fx();
+    k[1](lane) = K.fy();
+    k[2](lane) = K.skew();
+    k[3](lane) = K.px();
+    k[4](lane) = K.py();
+  }
+
+  static void Uncalibrate(const Lane* k, const Lane& x, const Lane& y,
+                          Lane& u, Lane& v, Lane* Dp, Lane* Dcal) {
+    u = k[0] * x + k[2] * y + k[3];
+    v = k[1] * y + k[4];
+    Dp[0] = k[0];
+    Dp[1] = k[2];
+    Dp[2].setZero();
+    Dp[3] = k[1];
+    if (Dcal) {
+      Dcal[0] = x;
+      Dcal[1].setZero();
+      Dcal[2] = y;
+      Dcal[3].setOnes();
+      Dcal[4].setZero();
+      Dcal[5].setZero();
+      Dcal[6] = y;
+      Dcal[7].setZero();
+      Dcal[8].setZero();
+      Dcal[9].setOnes();
+    }
+  }
+};
+
+/// Vectorized Cal3Bundler::uncalibrate
+template <>
+struct BatchCalibration<Cal3Bundler> {
+  typedef internal::ProjectionLane Lane;
+  static const bool supported = true;
+  static const int dimension = 3;
+  static const int nrParameters = 5;
+
+  static void Load(const Cal3Bundler& K, Lane* k, int lane) {
+    k[0](lane) = K.fx();
+    k[1](lane) = K.k1();
+    k[2](lane) = K.k2();
+    k[3](lane) = K.px();
+    k[4](lane) = K.py();
+  }
+
+  static void Uncalibrate(const Lane* k, const Lane& x, const Lane& y,
+                          Lane& u, Lane& v, Lane* Dp, Lane* Dcal) {
+    const Lane& f = k[0];
+    const Lane r = x * x + y * y;
+    const Lane g = 1.0 + (k[1] + k[2] * r) * r;
+    const Lane gx = g * x, gy = g * y;
+    if (Dcal) {
+      const Lane frx = f * r * x, fry = f * r * y;
+      Dcal[0] = gx;
+      Dcal[1] = frx;
+      Dcal[2] = r * frx;
+      Dcal[3] = gy;
+      Dcal[4] = fry;
+      Dcal[5] = r * fry;
+    }
+    const Lane a = 2.0 * (k[1] + 2.0 * k[2] * r);
+    const Lane faxy = f * a * x * y;
+    Dp[0] = f * (g + a * x * x);
+    Dp[1] = faxy;
+    Dp[2] = faxy;
+    Dp[3] = f * (g + a * y * y);
+    u = k[3] + f * gx;
+    v = k[4] + f * gy;
+  }
+};
+
+/// Vectorized Cal3DS2::uncalibrate
+template <>
+struct BatchCalibration<Cal3DS2> {
+  typedef internal::ProjectionLane Lane;
+  static const bool supported = true;
+  static const int dimension = 9;
+  static const int nrParameters = 9;
+
+  static void Load(const Cal3DS2& K, Lane* k, int lane) {
+    k[0](lane) = K.fx();
+    k[1](lane) = K.fy();
+    k[2](lane) = K.skew();
+    k[3](lane) = K.px();
+    k[4](lane) = K.py();
+    k[5](lane) = K.k1();
+    k[6](lane) = K.k2();
+    k[7](lane) = K.p1();
+    k[8](lane) = K.p2();
+  }
+
+  static void Uncalibrate(const Lane* k, const Lane& x, const Lane& y,
+                          Lane& u, Lane& v, Lane* Dp, Lane* Dcal) {
+    const Lane &fx = k[0], &fy = k[1], &s = k[2];
+    const Lane &k1 = k[5], &k2 = k[6], &p1 = k[7], &p2 = k[8];
+    const Lane xy = x * y, xx = x * x, yy = y * y;
+    const Lane rr = xx + yy;
+    const Lane r4 = rr * rr;
+    const Lane g = 1.0 + k1 * rr + k2 * r4;
+
+    // Radial and tangential distortion applied
+    const Lane pnx = g * x + 2.0 * p1 * xy + p2 * (rr + 2.0 * xx);
+    const Lane pny = g * y + 2.0 * p2 * xy + p1 * (rr + 2.0 * yy);
+
+    if (Dcal) {
+      // [DR1, DK * DR2], see Cal3DS2_Base::uncalibrate
+      const Lane xrr = x * rr, xr4 = x * r4, yrr = y * rr, yr4 = y * r4;
+      const Lane xy2 = 2.0 * xy, rrxx = rr + 2.0 * xx, rryy = rr + 2.0 * yy;
+      Dcal[0] = pnx;
+      Dcal[1].setZero();
+      Dcal[2] = pny;
+      Dcal[3].setOnes();
+      Dcal[4].setZero();
+      Dcal[5] = fx * xrr + s * yrr;
+      Dcal[6] = fx * xr4 + s * yr4;
+      Dcal[7] = fx * xy2 + s * rryy;
+      Dcal[8] = fx * rrxx + s * xy2;
+      Dcal[9].setZero();
+      Dcal[10] = pny;
+      Dcal[11].setZero();
+      Dcal[12].setZero();
+      Dcal[13].setOnes();
+      Dcal[14] = fy * yrr;
+      Dcal[15] = fy * yr4;
+      Dcal[16] = fy * rryy;
+      Dcal[17] = fy * xy2;
+    }
+
+    // DK * DR, see D2dintrinsic in Cal3DS2_Base.cpp
+    const Lane dgdx = 2.0 * x * (k1 + 2.0 * k2 * rr);
+    const Lane dgdy = 2.0 * y * (k1 + 2.0 * k2 * rr);
+    const Lane DR00 = g + x * dgdx + 2.0 * p1 * y + 6.0 * p2 * x;
+    const Lane DR01 = x * dgdy + 2.0 * p1 * x + 2.0 * p2 * y;
+    const Lane DR10 = y * dgdx + 2.0 * p2 * y + 2.0 * p1 * x;
+    const Lane DR11 = g + y * dgdy + 2.0 * p2 * x + 6.0 * p1 * y;
+    Dp[0] = fx * DR00 + s * DR10;
+    Dp[1] = fx * DR01 + s * DR11;
+    Dp[2] = fy * DR10;
+    Dp[3] = fy * DR11;
+
+    u = fx * pnx + s * pny + k[3];
+    v = fy * pny + k[4];
+  }
+};
+
+/**
+ * Pinhole projection of kProjectionLanes points, each into its own camera,
+ * with the same derivatives as PinholeBase::project2 followed by
+ * CALIBRATION::uncalibrate. Every quantity is an array with one lane per
+ * projection, so all lanes are computed with the same SIMD instructions.
+ */
+template <class CALIBRATION>
+struct PinholeBatchKernel {
+  typedef internal::ProjectionLane Lane;
+  typedef BatchCalibration<CALIBRATION> Calibration;
+  static const int Lanes = internal::kProjectionLanes;
+  static const int DimK = Calibration::dimension;
+
+  /// Rotation (row-major), translation, point and calibration for all lanes
+  struct Input {
+    Lane R[9], t[3], p[3], K[Calibration::nrParameters];
+  };
+
+  /// Pixel coordinates, and row-major derivatives for all lanes
+  struct Output {
+    Lane u, v, Dpose[12], Dpoint[6], Dcal[2 * DimK];
+  };
+
+  /// Store the pose and calibration of a camera in one lane
+  template <class CAMERA>
+  static void LoadCamera(const CAMERA& camera, Input& in, int lane) {
+    const Pose3& pose = camera.pose();
+    const Matrix3 R = pose.rotation().matrix();
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) in.R[3 * i + j](lane) = R(i, j);
+      in.t[i](lane) = pose.translation()(i);
+    }
+    Calibration::Load(camera.calibration(), in.K, lane);
+  }
+
+  /// Store a point in one lane
+  static void LoadPoint(const Point3& point, Input& in, int lane) {
+    for (int i = 0; i < 3; i++) in.p[i](lane) = point(i);
+  }
+
+  /**
+   * Project all lanes, of which the first nrValid are checked for cheirality.
+   * Derivatives are computed only if asked for, and Dcal only if also dcal.
+   */
+  static void Run(const Input& in, Output& out, int nrValid, bool derivatives,
+                  bool dcal) {
+    const Lane dx = in.p[0] - in.t[0], dy = in.p[1] - in.t[1],
+               dz = in.p[2] - in.t[2];
+    const Lane* R = in.R;
+
+    // q = R' * (p - t), see Pose3::transformTo
+    const Lane qx = R[0] * dx + R[3] * dy + R[6] * dz;
+    const Lane qy = R[1] * dx + R[4] * dy + R[7] * dz;
+    const Lane qz = R[2] * dx + R[5] * dy + R[8] * dz;
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+    if ((qz.head(nrValid) <= 0).any())
+      throw CheiralityException();
+#endif
+    const Lane d = qz.inverse();
+    const Lane x = qx * d, y = qy * d;
+
+    if (!derivatives) {
+      Lane Dp[4];
+      Calibration::Uncalibrate(in.K, x, y, out.u, out.v, Dp, nullptr);
+      return;
+    }
+
+    Lane Dp[4];
+    Calibration::Uncalibrate(in.K, x, y, out.u, out.v, Dp,
+                             dcal ? out.Dcal : nullptr);
+
+    // Dpn_pose, see PinholeBase::Dpose
+    const Lane xy = x * y;
+    const Lane P0[6] = {xy, -1.0 - x * x, y, -d, Lane::Zero(), d * x};
+    const Lane P1[6] = {1.0 + y * y, -xy, -x, Lane::Zero(), -d, d * y};
+    for (int c = 0; c < 6; c++) {
+      out.Dpose[c] = Dp[0] * P0[c] + Dp[1] * P1[c];
+      out.Dpose[6 + c] = Dp[2] * P0[c] + Dp[3] * P1[c];
+    }
+
+    // Dpn_point, see PinholeBase::Dpoint, with Rt(i, j) = R(j, i)
+    for (int c = 0; c < 3; c++) {
+      const Lane N0 = d * (R[3 * c] - x * R[3 * c + 2]);
+      const Lane N1 = d * (R[3 * c + 1] - y * R[3 * c + 2]);
+      out.Dpoint[c] = Dp[0] * N0 + Dp[1] * N1;
+      out.Dpoint[3 + c] = Dp[2] * N0 + Dp[3] * N1;
+    }
+  }
+
+  /// Copy the derivative with respect to a camera of dimension D from a lane
+  template <int D>
+  static void StoreDcamera(const Output& out, int lane,
+                           Eigen::Matrix<double, 2, D>& F) {
+    for (int r = 0; r < 2; r++) {
+      for (int c = 0; c < 6; c++) F(r, c) = out.Dpose[6 * r + c](lane);
+      for (int c = 6; c < D; c++) F(r, c) = out.Dcal[DimK * r + c - 6](lane);
+    }
+  }
+
+  /// Copy the derivative with respect to the point into rows of E
+  static void StoreDpoint(const Output& out, int lane, Matrix& E, size_t row) {
+    for (int r = 0; r < 2; r++)
+      for (int c = 0; c < 3; c++) E(row + r, c) = out.Dpoint[3 * r + c](lane);
+  }
+};
+
+/**
+ * Vectorized projection for a camera type, used by CameraSet::project2 when
+ * value is true. Specialized for PinholePose and PinholeCamera, with the
+ * calibration models that BatchCalibration supports.
+ */
+template <class CAMERA>
+struct BatchProjection : std::false_type {};
+
+/**
+ * Implementation of BatchProjection for pinhole cameras with a pose() and a
+ * calibration(), and a derivative of the pose followed by the calibration.
+ */
+template <class CAMERA, class CALIBRATION>
+struct PinholeBatchProjection
+    : std::integral_constant<bool, BatchCalibration<CALIBRATION>::supported> {
+  typedef PinholeBatchKernel<CALIBRATION> Kernel;
+  static const int Lanes = Kernel::Lanes;
+  static const int D = traits<CAMERA>::dimension;
+  typedef Eigen::Matrix<double, 2, D> MatrixZD;
+
+  /**
+   * Project one point into all cameras, as CameraSet::project2, filling the
+   * m blocks of Fs and the 2m*3 matrix E if given.
+   */
+  template <class CAMERAS, class FBLOCKS>
+  static Point2Vector Project(const CAMERAS& cameras, const Point3& point,
+                              FBLOCKS* Fs, Matrix* E) {
+    const size_t m = cameras.size();
+    Point2Vector z(m);
+    if (Fs) Fs->resize(m);
+    if (E) E->resize(2 * m, 3);
+
+    typename Kernel::Input in;
+    typename Kernel::Output out;
+    for (int lane = 0; lane < Lanes; lane++) Kernel::LoadPoint(point, in, lane);
+    for (size_t begin = 0; begin < m; begin += Lanes) {
+      // Pad the last block with copies of its last camera
+      const int n = std::min<size_t>(Lanes, m - begin);
+      for (int lane = 0; lane < Lanes; lane++)
+        Kernel::LoadCamera(cameras[begin + std::min(lane, n - 1)], in, lane);
+      Kernel::Run(in, out, n, Fs || E, Fs && D > 6);
+      for (int lane = 0; lane < n; lane++) {
+        const size_t i = begin + lane;
+        z[i] = Point2(out.u(lane), out.v(lane));
+        if (Fs) Kernel::StoreDcamera(out, lane, (*Fs)[i]);
+        if (E) Kernel::StoreDpoint(out, lane, *E, 2 * i);
+      }
+    }
+    return z;
+  }
+
+  /**
+   * Project N points into one camera, filling the 2N*D matrix Dcamera and the
+   * 2N*3 matrix Dpoints with the derivatives of every projection, if given.
+   */
+  static Point2Vector ProjectPoints(const CAMERA& camera,
+                                    const std::vector<Point3>& points,
+                                    Matrix* Dcamera = nullptr,
+                                    Matrix* Dpoints = nullptr) {
+    const size_t N = points.size();
+    Point2Vector z(N);
+    if (Dcamera) Dcamera->resize(2 * N, D);
+    if (Dpoints) Dpoints->resize(2 * N, 3);
+
+    typename Kernel::Input in;
+    typename Kernel::Output out;
+    for (int lane = 0; lane < Lanes; lane++)
+      Kernel::LoadCamera(camera, in, lane);
+    MatrixZD F;
+    for (size_t begin = 0; begin < N; begin += Lanes) {
+      const int n = std::min<size_t>(Lanes, N - begin);
+      for (int lane = 0; lane < Lanes; lane++)
+        Kernel::LoadPoint(points[begin + std::min(lane, n - 1)], in, lane);
+      Kernel::Run(in, out, n, Dcamera || Dpoints, Dcamera && D > 6);
+      for (int lane = 0; lane < n; lane++) {
+        const size_t j = begin + lane;
+        z[j] = Point2(out.u(lane), out.v(lane));
+        if (Dcamera) {
+          Kernel::StoreDcamera(out, lane, F);
+          Dcamera->block<2, D>(2 * j, 0) = F;
+        }
+        if (Dpoints) Kernel::StoreDpoint(out, lane, *Dpoints, 2 * j);
+      }
+    }
+    return z;
+  }
+};
+
+}  // namespace gtsam
@@ -20,6 +20,7 @@
 
 #include <gtsam/geometry/Point3.h>
 #include <gtsam/geometry/CalibratedCamera.h>  // for Cheirality exception
+#include <gtsam/geometry/BatchProjection.h>
 #include <gtsam/base/Testable.h>
 #include <gtsam/base/SymmetricBlockMatrix.h>
 #include <gtsam/base/FastMap.h>
@@ -104,12 +105,31 @@ public:
    * Project a point (possibly Unit3 at infinity), with derivatives
    * Note that F is a sparse block-diagonal matrix, so instead of a large dense
    * matrix this function returns the diagonal blocks.
+   * Points are projected into all cameras at once if BatchProjection<CAMERA>
+   * supports the camera type.
    * throws CheiralityException
    */
   template<class POINT>
   ZVector project2(const POINT& point, //
       boost::optional<FBlocks&> Fs = boost::none, //
       boost::optional<Matrix&> E = boost::none) const {
+    typedef std::integral_constant<bool, BatchProjection<CAMERA>::value &&
+        std::is_same<POINT, Point3>::value> Batch;
+    return project2(point, Fs, E, Batch());
+  }
+
+ private:
+  /// Project into all cameras with BatchProjection
+  ZVector project2(const Point3& point, boost::optional<FBlocks&> Fs,
+      boost::optional<Matrix&> E, std::true_type) const {
+    return BatchProjection<CAMERA>::Project(*this, point, Fs.get_ptr(),
+                                            E.get_ptr());
+  }
+
+  /// Project into the cameras one by one
+  template<class POINT>
+  ZVector project2(const POINT& point, boost::optional<FBlocks&> Fs,
+      boost::optional<Matrix&> E, std::false_type) const {
 
     static const int N = FixedDimension<POINT>::value;
 
@@ -134,6 +154,8 @@ public:
     return z;
   }
 
+ public:
+
   /// Calculate vector [project2(point)-z] of re-projection errors
   template<class POINT>
   Vector reprojectionError(const POINT& point, const ZVector& measured,
@@ -369,35 +391,55 @@ public:
     for (size_t slot = 0; slot < allKeys.size(); slot++)
       KeySlotMap.insert(std::make_pair(allKeys[slot], slot));
 
+    // allKeys are the list of all camera keys in the group, e.g, (1,3,4,5,7)
+    // we should map those to a slot in the local (grouped) hessian (0,1,2,3,4)
+    std::vector<size_t> slots(keys.size());
+    for (size_t i = 0; i < keys.size(); i++)
+      slots[i] = KeySlotMap.at(keys[i]);
+
+    UpdateSchurComplement<N>(Fs, E, P, b, slots, augmentedHessian);
+  }
+
+  /**
+   * Same as above, but with the block of camera i in the augmented Hessian
+   * given directly as slots[i], so callers that add many factors into the same
+   * Hessian can compute the slots once. Several cameras may share a slot, e.g.,
+   * cameras on the same body pose; their contributions are summed.
+   */
+  template<int N> // N = 2 or 3 (point dimension)
+  static void UpdateSchurComplement(const FBlocks& Fs, const Matrix& E,
+      const Eigen::Matrix<double, N, N>& P, const Vector& b,
+      const std::vector<size_t>& slots,
+      /*output ->*/SymmetricBlockMatrix& augmentedHessian) {
+
+    assert(slots.size()==Fs.size());
+
     // Schur complement trick
     // G = F' * F - F' * E * P * E' * F
     // g = F' * (b - E * P * E' * b)
 
     // a single point is observed in m cameras
     size_t m = Fs.size(); // cameras observing current point
-    size_t M = (augmentedHessian.rows() - 1) / D; // all cameras in the group
-    assert(allKeys.size()==M);
+    size_t M = augmentedHessian.nBlocks() - 1; // all cameras in the group
+
+    // P * E' * b is shared by all information vector blocks
+    const Eigen::Matrix<double, N, 1> PEtb = P * (E.transpose() * b);
 
     // Blockwise Schur complement
     for (size_t i = 0; i < m; i++) { // for each camera in the current factor
 
       const MatrixZD& Fi = Fs[i];
       const auto FiT = Fi.transpose();
-      const Eigen::Matrix<double, 2, N> Ei_P = E.template block<ZDim, N>(
+      const Eigen::Matrix<double, ZDim, N> Ei_P = E.template block<ZDim, N>(
           ZDim * i, 0) * P;
 
-      // D = (DxZDim) * (ZDim)
-      // allKeys are the list of all camera keys in the group, e.g, (1,3,4,5,7)
-      // we should map those to a slot in the local (grouped) hessian (0,1,2,3,4)
-      // Key cameraKey_i = this->keys_[i];
-      DenseIndex aug_i = KeySlotMap.at(keys[i]);
+      const DenseIndex aug_i = slots[i];
+      assert(aug_i < (DenseIndex)M);
 
-      // information vector - store previous vector
-      // vectorBlock = augmentedHessian(aug_i, aug_m).knownOffDiagonal();
-      // add contribution of current factor
+      // information vector: (DxZDim) * ( (ZDimx1) - (ZDimxN) * (Nx1) )
       augmentedHessian.updateOffDiagonalBlock(aug_i, M,
-          FiT * b.segment<ZDim>(ZDim * i)      // F' * b
-        - FiT * (Ei_P * (E.transpose() * b))); // D = (DxZDim) * (ZDimx3) * (N*ZDimm) * (ZDimm x 1)
+          FiT * (b.segment<ZDim>(ZDim * i) - E.template block<ZDim, N>(
+              ZDim * i, 0) * PEtb));
 
       // (DxD) += (DxZDim) * ( (ZDimxD) - (ZDimx3) * (3xZDim) * (ZDimxD) )
       // add contribution of current factor
@@ -408,15 +450,16 @@ public:
       // upper triangular part of the hessian
       for (size_t j = i + 1; j < m; j++) { // for each camera
         const MatrixZD& Fj = Fs[j];
-
-        DenseIndex aug_j = KeySlotMap.at(keys[j]);
+        const DenseIndex aug_j = slots[j];
 
         // (DxD) = (DxZDim) * ( (ZDimxZDim) * (ZDimxD) )
-        // off diagonal block - store previous block
-        // matrixBlock = augmentedHessian(aug_i, aug_j).knownOffDiagonal();
-        // add contribution of current factor
-        augmentedHessian.updateOffDiagonalBlock(aug_i, aug_j,
-                -FiT * (Ei_P * E.template block<ZDim, N>(ZDim * j, 0).transpose() * Fj));
+        const Eigen::Matrix<double, D, D> Gij =
+            -FiT * (Ei_P * E.template block<ZDim, N>(ZDim * j, 0).transpose() * Fj);
+        if (aug_i == aug_j)
+          augmentedHessian.updateDiagonalBlock(aug_i,
+              (Gij + Gij.transpose()).eval());
+        else
+          augmentedHessian.updateOffDiagonalBlock(aug_i, aug_j, Gij);
       }
     } // end of for over cameras
 
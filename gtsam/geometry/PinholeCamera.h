@@ -348,6 +348,11 @@ template <typename Calibration>
 struct traits<const PinholeCamera<Calibration> >
     : public internal::Manifold<PinholeCamera<Calibration> > {};
 
+// vectorized projection, used in CameraSet
+template <typename Calibration>
+struct BatchProjection<PinholeCamera<Calibration> >
+    : PinholeBatchProjection<PinholeCamera<Calibration>, Calibration> {};
+
 // range traits, used in RangeFactor
 template <typename Calibration, typename T>
 struct Range<PinholeCamera<Calibration>, T> : HasRange<PinholeCamera<Calibration>, T, double> {};
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <gtsam/geometry/CalibratedCamera.h>
+#include <gtsam/geometry/BatchProjection.h>
 #include <gtsam/geometry/Point2.h>
 #include <boost/make_shared.hpp>
 
@@ -455,4 +456,10 @@ struct traits<const PinholePose<CALIBRATION> > : public internal::Manifold<
     PinholePose<CALIBRATION> > {
 };
 
+// vectorized projection, used in CameraSet
+template<typename CALIBRATION>
+struct BatchProjection<PinholePose<CALIBRATION> > : PinholeBatchProjection<
+    PinholePose<CALIBRATION>, CALIBRATION> {
+};
+
 } // \ gtsam
@@ -0,0 +1,551 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   Pose3Batch.cpp
+ * @brief  Rot3 and Pose3 operations on many elements at once, in
+ *         structure-of-arrays layout
+ * @date   October, 2026
+ */
+
+#include <gtsam/geometry/Pose3Batch.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace gtsam {
+
+namespace {
+
+/// Number of elements processed together
+const int kBlock = 16;
+
+/// One scalar quantity for a block of elements, a fixed-size array Eigen
+/// vectorizes
+typedef Eigen::Array<double, kBlock, 1> Lane;
+typedef Eigen::Array<bool, kBlock, 1> Mask;
+
+const double kEpsilon = std::numeric_limits<double>::epsilon();
+
+/// Call f(begin, size) for consecutive blocks of at most kBlock rows
+template <class FUNCTION>
+void forEachBlock(size_t n, FUNCTION f) {
+  for (size_t begin = 0; begin < n; begin += kBlock)
+    f(begin, std::min<size_t>(kBlock, n - begin));
+}
+
+/**
+ * Load rows [begin, begin + size) of every column of M into lanes. A partial
+ * block is padded with copies of its last row.
+ */
+template <class MATRIX>
+void load(const MATRIX& M, size_t begin, size_t size, Lane* x) {
+  for (int c = 0; c < M.cols(); c++) {
+    if (size == kBlock) {
+      x[c] = M.col(c).template segment<kBlock>(begin).array();
+    } else {
+      x[c].head(size) = M.col(c).segment(begin, size).array();
+      x[c].tail(kBlock - size).setConstant(M(begin + size - 1, c));
+    }
+  }
+}
+
+/// Store the first size lanes into rows [begin, begin + size) of M
+template <class MATRIX>
+void store(const Lane* x, size_t begin, size_t size, MATRIX& M) {
+  for (int c = 0; c < M.cols(); c++)
+    M.col(c).segment(begin, size) = x[c].head(size).matrix();
+}
+
+/// C = A * B, for row-major 3*3 matrices
+void multiply(const Lane* A, const Lane* B, Lane* C) {
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      C[3 * i + j] = A[3 * i] * B[j] + A[3 * i + 1] * B[3 + j] +
+                     A[3 * i + 2] * B[6 + j];
+}
+
+/// q = R * p
+void rotate(const Lane* R, const Lane* p, Lane* q) {
+  for (int i = 0; i < 3; i++)
+    q[i] = R[3 * i] * p[0] + R[3 * i + 1] * p[1] + R[3 * i + 2] * p[2];
+}
+
+/// q = R' * p
+void unrotate(const Lane* R, const Lane* p, Lane* q) {
+  for (int i = 0; i < 3; i++)
+    q[i] = R[i] * p[0] + R[3 + i] * p[1] + R[6 + i] * p[2];
+}
+
+/// W = skewSymmetric(w)
+void skew(const Lane* w, Lane* W) {
+  W[0].setZero();
+  W[1] = -w[2];
+  W[2] = w[1];
+  W[3] = w[2];
+  W[4].setZero();
+  W[5] = -w[0];
+  W[6] = -w[1];
+  W[7] = w[0];
+  W[8].setZero();
+}
+
+/// M = I + a * W + b * W * W, with W = skewSymmetric(w)
+void rodrigues(const Lane* w, const Lane& a, const Lane& b, Lane* M) {
+  const Lane theta2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  Lane W[9];
+  skew(w, W);
+  // W * W = w * w' - theta2 * I
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) {
+      M[3 * i + j] = a * W[3 * i + j] + b * (w[i] * w[j]);
+      if (i == j) M[3 * i + j] += 1.0 - b * theta2;
+    }
+}
+
+/// Copy a row-major 3*3 block into a row-major Jacobian with cols columns
+void setBlock(const Lane* B, int row, int col, int cols, Lane* H) {
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) H[cols * (row + i) + col + j] = B[3 * i + j];
+}
+
+/// Set a 3*3 block of a row-major Jacobian to a multiple of the identity
+void setIdentityBlock(double s, int row, int col, int cols, Lane* H) {
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      H[cols * (row + i) + col + j].setConstant(i == j ? s : 0.0);
+}
+
+/// R = Rot3::Expmap(w) and, if H, H = Rot3::ExpmapDerivative(w)
+void expmap(const Lane* w, Lane* R, Lane* H) {
+  const Lane theta2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  const Mask nearZero = theta2 <= kEpsilon;
+  const Lane safe2 = nearZero.select(1.0, theta2);
+  const Lane theta = safe2.sqrt();
+  const Lane sinTheta = theta.sin();
+  const Lane s2 = (0.5 * theta).sin();
+  const Lane oneMinusCos = 2.0 * s2 * s2;
+
+  // See so3::ExpmapFunctor and so3::DexpFunctor
+  rodrigues(w, nearZero.select(1.0, sinTheta / theta),
+            nearZero.select(0.0, oneMinusCos / safe2), R);
+  if (H)
+    rodrigues(w, nearZero.select(-0.5, -oneMinusCos / safe2),
+              nearZero.select(0.0, (1.0 - sinTheta / theta) / safe2), H);
+}
+
+/// H = Rot3::LogmapDerivative(w)
+void logmapDerivative(const Lane* w, Lane* H) {
+  const Lane theta2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  const Mask nearZero = theta2 <= kEpsilon;
+  const Lane safe2 = nearZero.select(1.0, theta2);
+  const Lane theta = safe2.sqrt();
+  rodrigues(w, nearZero.select(0.0, Lane::Constant(0.5)),
+            nearZero.select(0.0, 1.0 / safe2 - (1.0 + theta.cos()) /
+                                                   (2.0 * theta * theta.sin())),
+            H);
+}
+
+/// w = Rot3::Logmap(R)
+void logmap(const Lane* R, Lane* w) {
+  const Lane tr = R[0] + R[4] + R[8];
+  const Lane tr3 = tr - 3.0;
+  const Lane theta = (0.5 * (tr - 1.0)).max(-1.0).min(1.0).acos();
+  const Lane magnitude =
+      (tr3 < -1e-6)
+          .select(theta / (2.0 * theta.sin()),
+                  0.5 - tr3 / 12.0 + tr3 * tr3 / 60.0);
+  w[0] = magnitude * (R[7] - R[5]);
+  w[1] = magnitude * (R[2] - R[6]);
+  w[2] = magnitude * (R[3] - R[1]);
+
+  // Rotations by angles close to pi are rare, and handled one by one
+  const Mask nearPi = tr + 1.0 < 1e-3;
+  if (!nearPi.any()) return;
+  for (Eigen::Index l = 0; l < tr.size(); l++) {
+    if (!nearPi(l)) continue;
+    Matrix3 M;
+    for (int i = 0; i < 9; i++) M(i / 3, i % 3) = R[i](l);
+    const Vector3 omega = Rot3::Logmap(Rot3(M));
+    for (int i = 0; i < 3; i++) w[i](l) = omega(i);
+  }
+}
+
+/// Q = Pose3::ComputeQforExpmapDerivative((w, v))
+void computeQ(const Lane* w, const Lane* v, Lane* Q) {
+  Lane W[9], V[9], WV[9], VW[9], WVW[9], WWV[9], VWW[9], WVWW[9], WWVW[9];
+  skew(w, W);
+  skew(v, V);
+  multiply(W, V, WV);
+  multiply(V, W, VW);
+  multiply(WV, W, WVW);
+  multiply(W, WV, WWV);
+  multiply(VW, W, VWW);
+  multiply(WVW, W, WVWW);
+  multiply(W, WVW, WWVW);
+
+  const Lane phi2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+  const Mask nearZero = phi2.sqrt() <= 1e-5;
+  const Lane phi = nearZero.select(1.0, phi2.sqrt());
+  const Lane s = phi.sin(), c = phi.cos();
+  const Lane phi3 = phi * phi * phi, phi4 = phi3 * phi, phi5 = phi4 * phi;
+  const Lane a = (1.0 - 0.5 * phi * phi - c) / phi4;
+  const Lane c1 = nearZero.select(1. / 6., (phi - s) / phi3);
+  const Lane c2 = nearZero.select(-1. / 24., a);
+  const Lane c3 = nearZero.select(
+      1. / 120., -0.5 * (a - 3.0 * (phi - s - phi3 / 6.) / phi5));
+  for (int k = 0; k < 9; k++)
+    Q[k] = -0.5 * V[k] + c1 * (WV[k] + VW[k] - WVW[k]) +
+           c2 * (WWV[k] + VWW[k] - 3.0 * WVW[k]) + c3 * (WVWW[k] + WWVW[k]);
+}
+
+void checkSize(size_t expected, size_t actual, const char* function) {
+  if (expected != actual)
+    throw std::invalid_argument(std::string(function) +
+                                ": batches have different sizes");
+}
+
+}  // namespace
+
+/* ************************************************************************* */
+Rot3Batch::Rot3Batch(size_t n) : R_(Storage::Zero(n, 9)) {
+  R_.col(0).setOnes();
+  R_.col(4).setOnes();
+  R_.col(8).setOnes();
+}
+
+/* ************************************************************************* */
+Rot3Batch::Rot3Batch(const std::vector<Rot3>& rotations)
+    : R_(rotations.size(), 9) {
+  for (size_t k = 0; k < rotations.size(); k++) set(k, rotations[k]);
+}
+
+/* ************************************************************************* */
+Rot3 Rot3Batch::at(size_t k) const {
+  Matrix3 M;
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) M(i, j) = R_(k, 3 * i + j);
+  return Rot3(M);
+}
+
+/* ************************************************************************* */
+void Rot3Batch::set(size_t k, const Rot3& R) {
+  const Matrix3 M = R.matrix();
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) R_(k, 3 * i + j) = M(i, j);
+}
+
+/* ************************************************************************* */
+std::vector<Rot3> Rot3Batch::rotations() const {
+  std::vector<Rot3> result;
+  result.reserve(size());
+  for (size_t k = 0; k < size(); k++) result.push_back(at(k));
+  return result;
+}
+
+/* ************************************************************************* */
+Rot3Batch Rot3Batch::inverse() const {
+  Storage Rt(size(), 9);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) Rt.col(3 * i + j) = R_.col(3 * j + i);
+  return Rot3Batch(Rt);
+}
+
+/* ************************************************************************* */
+Rot3Batch Rot3Batch::compose(const Rot3Batch& other) const {
+  checkSize(size(), other.size(), "Rot3Batch::compose");
+  Storage C(size(), 9);
+  forEachBlock(size(), [&](size_t begin, size_t n) {
+    Lane A[9], B[9], AB[9];
+    load(R_, begin, n, A);
+    load(other.R_, begin, n, B);
+    multiply(A, B, AB);
+    store(AB, begin, n, C);
+  });
+  return Rot3Batch(C);
+}
+
+/* ************************************************************************* */
+Point3Batch Rot3Batch::rotate(const Point3Batch& p) const {
+  checkSize(size(), p.rows(), "Rot3Batch::rotate");
+  Point3Batch q(size(), 3);
+  forEachBlock(size(), [&](size_t begin, size_t n) {
+    Lane R[9], x[3], y[3];
+    load(R_, begin, n, R);
+    load(p, begin, n, x);
+    gtsam::rotate(R, x, y);
+    store(y, begin, n, q);
+  });
+  return q;
+}
+
+/* ************************************************************************* */
+Point3Batch Rot3Batch::unrotate(const Point3Batch& p) const {
+  checkSize(size(), p.rows(), "Rot3Batch::unrotate");
+  Point3Batch q(size(), 3);
+  forEachBlock(size(), [&](size_t begin, size_t n) {
+    Lane R[9], x[3], y[3];
+    load(R_, begin, n, R);
+    load(p, begin, n, x);
+    gtsam::unrotate(R, x, y);
+    store(y, begin, n, q);
+  });
+  return q;
+}
+
+/* ************************************************************************* */
+Rot3Batch Rot3Batch::Expmap(const Vector3Batch& omega,
+                            JacobianBatch<3, 3>* H) {
+  const size_t N = omega.rows();
+  Storage R(N, 9);
+  if (H) H->resize(N, 9);
+  forEachBlock(N, [&](size_t begin, size_t n) {
+    Lane w[3], Rk[9], Hk[9];
+    load(omega, begin, n, w);
+    expmap(w, Rk, H ? Hk : nullptr);
+    store(Rk, begin, n, R);
+    if (H) store(Hk, begin, n, *H);
+  });
+  return Rot3Batch(R);
+}
+
+/* ************************************************************************* */
+Vector3Batch Rot3Batch::Logmap(const Rot3Batch& R, JacobianBatch<3, 3>* H) {
+  const size_t N = R.size();
+  Vector3Batch omega(N, 3);
+  if (H) H->resize(N, 9);
+  forEachBlock(N, [&](size_t begin, size_t n) {
+    Lane Rk[9], w[3], Hk[9];
+    load(R.R_, begin, n, Rk);
+    logmap(Rk, w);
+    store(w, begin, n, omega);
+    if (H) {
+      logmapDerivative(w, Hk);
+      store(Hk, begin, n, *H);
+    }
+  });
+  return omega;
+}
+
+/* ************************************************************************* */
+Pose3Batch::Pose3Batch(size_t n) : R_(n), t_(Point3Batch::Zero(n, 3)) {}
+
+/* ************************************************************************* */
+Pose3Batch::Pose3Batch(const std::vector<Pose3>& poses)
+    : R_(poses.size()), t_(poses.size(), 3) {
+  for (size_t k = 0; k < poses.size(); k++) set(k, poses[k]);
+}
+
+/* ************************************************************************* */
+Pose3Batch::Pose3Batch(const Rot3Batch& R, const Point3Batch& t)
+    : R_(R), t_(t) {
+  checkSize(R.size(), t.rows(), "Pose3Batch");
+}
+
+/* ************************************************************************* */
+Pose3 Pose3Batch::at(size_t k) const {
+  return Pose3(R_.at(k), t_.row(k).transpose());
+}
+
+/* ************************************************************************* */
+void Pose3Batch::set(size_t k, const Pose3& pose) {
+  R_.set(k, pose.rotation());
+  t_.row(k) = pose.translation().transpose();
+}
+
+/* ************************************************************************* */
+std::vector<Pose3> Pose3Batch::poses() const {
+  std::vector<Pose3> result;
+  result.reserve(size());
+  for (size_t k = 0; k < size(); k++) result.push_back(at(k));
+  return result;
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::inverse() const {
+  const Rot3Batch Rt = R_.inverse();
+  return Pose3Batch(Rt, -Rt.rotate(t_));
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::compose(const Pose3Batch& other) const {
+  checkSize(size(), other.size(), "Pose3Batch::compose");
+  Rot3Batch::Storage R(size(), 9);
+  Point3Batch t(size(), 3);
+  forEachBlock(size(), [&](size_t begin, size_t n) {
+    Lane R1[9], R2[9], R12[9], t1[3], t2[3], t12[3];
+    load(R_.matrix(), begin, n, R1);
+    load(other.R_.matrix(), begin, n, R2);
+    load(t_, begin, n, t1);
+    load(other.t_, begin, n, t2);
+    multiply(R1, R2, R12);
+    rotate(R1, t2, t12);
+    for (int i = 0; i < 3; i++) t12[i] += t1[i];
+    store(R12, begin, n, R);
+    store(t12, begin, n, t);
+  });
+  return Pose3Batch(Rot3Batch(R), t);
+}
+
+/* ************************************************************************* */
+Point3Batch Pose3Batch::transformFrom(const Point3Batch& p,
+                                      JacobianBatch<3, 6>* Hself,
+                                      JacobianBatch<3, 3>* Hpoint) const {
+  checkSize(size(), p.rows(), "Pose3Batch::transformFrom");
+  Point3Batch q(size(), 3);
+  if (Hself) Hself->resize(size(), 18);
+  if (Hpoint) Hpoint->resize(size(), 9);
+  forEachBlock(size(), [&](size_t begin, size_t n) {
+    Lane R[9], t[3], x[3], y[3];
+    load(R_.matrix(), begin, n, R);
+    load(t_, begin, n, t);
+    load(p, begin, n, x);
+    rotate(R, x, y);
+    for (int i = 0; i < 3; i++) y[i] += t[i];
+    store(y, begin, n, q);
+    if (Hself) {
+      // [R * skewSymmetric(-p), R]
+      Lane P[9], RP[9], H[18];
+      skew(x, P);
+      multiply(R, P, RP);
+      for (int k = 0; k < 9; k++) RP[k] = -RP[k];
+      setBlock(RP, 0, 0, 6, H);
+      setBlock(R, 0, 3, 6, H);
+      store(H, begin, n, *Hself);
+    }
+    if (Hpoint) store(R, begin, n, *Hpoint);
+  });
+  return q;
+}
+
+/* ************************************************************************* */
+Point3Batch Pose3Batch::transformTo(const Point3Batch& p,
+                                    JacobianBatch<3, 6>* Hself,
+                                    JacobianBatch<3, 3>* Hpoint) const {
+  checkSize(size(), p.rows(), "Pose3Batch::transformTo");
+  Point3Batch q(size(), 3);
+  if (Hself) Hself->resize(size(), 18);
+  if (Hpoint) Hpoint->resize(size(), 9);
+  forEachBlock(size(), [&](size_t begin, size_t n) {
+    Lane R[9], t[3], x[3], y[3];
+    load(R_.matrix(), begin, n, R);
+    load(t_, begin, n, t);
+    load(p, begin, n, x);
+    for (int i = 0; i < 3; i++) x[i] -= t[i];
+    unrotate(R, x, y);
+    store(y, begin, n, q);
+    if (Hself) {
+      // [skewSymmetric(q), -I]
+      Lane Q[9], H[18];
+      skew(y, Q);
+      setBlock(Q, 0, 0, 6, H);
+      setIdentityBlock(-1.0, 0, 3, 6, H);
+      store(H, begin, n, *Hself);
+    }
+    if (Hpoint) {
+      Lane Rt[9];
+      for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++) Rt[3 * i + j] = R[3 * j + i];
+      store(Rt, begin, n, *Hpoint);
+    }
+  });
+  return q;
+}
+
+/* ************************************************************************* */
+Pose3Batch Pose3Batch::Expmap(const Vector6Batch& xi, JacobianBatch<6, 6>* H) {
+  const size_t N = xi.rows();
+  Rot3Batch::Storage R(N, 9);
+  Point3Batch t(N, 3);
+  if (H) H->resize(N, 36);
+  forEachBlock(N, [&](size_t begin, size_t n) {
+    Lane x[6], Rk[9], Jw[9];
+    load(xi, begin, n, x);
+    const Lane* w = x;
+    const Lane* v = x + 3;
+    expmap(w, Rk, H ? Jw : nullptr);
+    store(Rk, begin, n, R);
+
+    // t = (w x v - R * (w x v) + w * w'v) / theta2, or v if w is small
+    const Lane theta2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+    const Mask nearZero = theta2 <= kEpsilon;
+    const Lane inverseTheta2 = nearZero.select(0.0, 1.0 / theta2);
+    const Lane wv = w[0] * v[0] + w[1] * v[1] + w[2] * v[2];
+    Lane c[3], Rc[3], tk[3];
+    c[0] = w[1] * v[2] - w[2] * v[1];
+    c[1] = w[2] * v[0] - w[0] * v[2];
+    c[2] = w[0] * v[1] - w[1] * v[0];
+    rotate(Rk, c, Rc);
+    for (int i = 0; i < 3; i++)
+      tk[i] = nearZero.select(v[i], (c[i] - Rc[i] + w[i] * wv) * inverseTheta2);
+    store(tk, begin, n, t);
+
+    if (H) {
+      Lane Q[9], Hk[36];
+      computeQ(w, v, Q);
+      setBlock(Jw, 0, 0, 6, Hk);
+      setIdentityBlock(0.0, 0, 3, 6, Hk);
+      setBlock(Q, 3, 0, 6, Hk);
+      setBlock(Jw, 3, 3, 6, Hk);
+      store(Hk, begin, n, *H);
+    }
+  });
+  return Pose3Batch(Rot3Batch(R), t);
+}
+
+/* ************************************************************************* */
+Vector6Batch Pose3Batch::Logmap(const Pose3Batch& poses,
+                                JacobianBatch<6, 6>* H) {
+  const size_t N = poses.size();
+  Vector6Batch xi(N, 6);
+  if (H) H->resize(N, 36);
+  forEachBlock(N, [&](size_t begin, size_t n) {
+    Lane R[9], T[3], x[6];
+    load(poses.R_.matrix(), begin, n, R);
+    load(poses.t_, begin, n, T);
+    Lane* w = x;
+    Lane* u = x + 3;
+    logmap(R, w);
+
+    // u = T - W * T / 2 + b * W * W * T, see Pose3::Logmap
+    const Lane t2 = w[0] * w[0] + w[1] * w[1] + w[2] * w[2];
+    const Mask nearZero = t2.sqrt() < 1e-10;
+    const Lane t = nearZero.select(1.0, t2.sqrt());
+    const Lane a = nearZero.select(0.0, Lane::Constant(0.5));
+    const Lane b =
+        nearZero.select(0.0, (1.0 - t / (2.0 * (0.5 * t).tan())) / (t * t));
+    Lane W[9], WT[3], WWT[3];
+    skew(w, W);
+    rotate(W, T, WT);
+    rotate(W, WT, WWT);
+    for (int i = 0; i < 3; i++) u[i] = T[i] - a * WT[i] + b * WWT[i];
+    store(x, begin, n, xi);
+
+    if (H) {
+      // [Jw, 0; -Jw * Q * Jw, Jw], see Pose3::LogmapDerivative
+      Lane Jw[9], Q[9], QJ[9], JQJ[9], Hk[36];
+      logmapDerivative(w, Jw);
+      computeQ(w, u, Q);
+      multiply(Q, Jw, QJ);
+      multiply(Jw, QJ, JQJ);
+      for (int k = 0; k < 9; k++) JQJ[k] = -JQJ[k];
+      setBlock(Jw, 0, 0, 6, Hk);
+      setIdentityBlock(0.0, 0, 3, 6, Hk);
+      setBlock(JQJ, 3, 0, 6, Hk);
+      setBlock(Jw, 3, 3, 6, Hk);
+      store(Hk, begin, n, *H);
+    }
+  });
+  return xi;
+}
+
+}  // namespace gtsam
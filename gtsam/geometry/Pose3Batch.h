@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   Pose3Batch.h
+ * @brief  Rot3 and Pose3 operations on many elements at once, in
+ *         structure-of-arrays layout
+ * @date   October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/geometry/Rot3.h>
+
+#include <vector>
+
+namespace gtsam {
+
+/// N points, one per row: column i holds coordinate i of all points
+typedef Eigen::Matrix<double, Eigen::Dynamic, 3> Point3Batch;
+
+/// N tangent vectors of Rot3, one per row
+typedef Eigen::Matrix<double, Eigen::Dynamic, 3> Vector3Batch;
+
+/// N tangent vectors of Pose3, one per row
+typedef Eigen::Matrix<double, Eigen::Dynamic, 6> Vector6Batch;
+
+/**
+ * N Jacobians of size ROWS*COLS, one per row: entry (i, j) of Jacobian k is
+ * stored at (k, COLS * i + j), i.e., every Jacobian is flattened row-major.
+ */
+template <int ROWS, int COLS>
+using JacobianBatch = Eigen::Matrix<double, Eigen::Dynamic, ROWS * COLS>;
+
+/// Extract Jacobian k from a JacobianBatch
+template <int ROWS, int COLS>
+Eigen::Matrix<double, ROWS, COLS> jacobianAt(
+    const JacobianBatch<ROWS, COLS>& H, size_t k) {
+  Eigen::Matrix<double, ROWS, COLS> Hk;
+  for (int i = 0; i < ROWS; i++)
+    for (int j = 0; j < COLS; j++) Hk(i, j) = H(k, COLS * i + j);
+  return Hk;
+}
+
+/**
+ * N rotations in structure-of-arrays layout: entry (i, j) of all rotation
+ * matrices is stored contiguously, in column 3 * i + j of an N*9 matrix.
+ *
+ * The operations below compute the same results (and Jacobians) as the
+ * corresponding Rot3 methods applied to every element, but process the
+ * elements a block of rows at a time, with every scalar quantity an array
+ * over the block. Eigen then evaluates the arithmetic with SIMD packets (AVX2
+ * or AVX-512 when compiled for them) instead of one rotation at a time.
+ */
+class GTSAM_EXPORT Rot3Batch {
+ public:
+  typedef Eigen::Matrix<double, Eigen::Dynamic, 9> Storage;
+
+ private:
+  Storage R_;
+
+ public:
+  /// @name Constructors
+  /// @{
+
+  /// n identity rotations
+  explicit Rot3Batch(size_t n = 0);
+
+  /// Copy rotations into structure-of-arrays layout
+  explicit Rot3Batch(const std::vector<Rot3>& rotations);
+
+  /// Construct from N*9 storage, see class documentation
+  explicit Rot3Batch(const Storage& R) : R_(R) {}
+
+  /// @}
+  /// @name Access
+  /// @{
+
+  /// Number of rotations
+  size_t size() const { return R_.rows(); }
+
+  /// Rotation k
+  Rot3 at(size_t k) const;
+
+  /// Set rotation k
+  void set(size_t k, const Rot3& R);
+
+  /// Copy all rotations out
+  std::vector<Rot3> rotations() const;
+
+  /// The N*9 storage
+  const Storage& matrix() const { return R_; }
+
+  /// @}
+  /// @name Group
+  /// @{
+
+  /// Inverse of every rotation
+  Rot3Batch inverse() const;
+
+  /// Element-wise composition, this[k] * other[k]
+  Rot3Batch compose(const Rot3Batch& other) const;
+
+  /// Element-wise composition
+  Rot3Batch operator*(const Rot3Batch& other) const { return compose(other); }
+
+  /// Rotate point k by rotation k
+  Point3Batch rotate(const Point3Batch& p) const;
+
+  /// Rotate point k by the inverse of rotation k
+  Point3Batch unrotate(const Point3Batch& p) const;
+
+  /// @}
+  /// @name Lie Group
+  /// @{
+
+  /// Rot3::Expmap of every row of omega, with Rot3::ExpmapDerivative in H
+  static Rot3Batch Expmap(const Vector3Batch& omega,
+                          JacobianBatch<3, 3>* H = nullptr);
+
+  /// Rot3::Logmap of every rotation, with Rot3::LogmapDerivative in H
+  static Vector3Batch Logmap(const Rot3Batch& R,
+                             JacobianBatch<3, 3>* H = nullptr);
+
+  /// @}
+};
+
+/**
+ * N poses in structure-of-arrays layout: a Rot3Batch with the rotations and
+ * an N*3 matrix with the translations. As for Rot3Batch, every operation is
+ * the element-wise equivalent of the Pose3 method with the same name.
+ */
+class GTSAM_EXPORT Pose3Batch {
+  Rot3Batch R_;
+  Point3Batch t_;
+
+ public:
+  /// @name Constructors
+  /// @{
+
+  /// n identity poses
+  explicit Pose3Batch(size_t n = 0);
+
+  /// Copy poses into structure-of-arrays layout
+  explicit Pose3Batch(const std::vector<Pose3>& poses);
+
+  /// Construct from rotations and translations, which must have equal size
+  Pose3Batch(const Rot3Batch& R, const Point3Batch& t);
+
+  /// @}
+  /// @name Access
+  /// @{
+
+  /// Number of poses
+  size_t size() const { return R_.size(); }
+
+  /// Pose k
+  Pose3 at(size_t k) const;
+
+  /// Set pose k
+  void set(size_t k, const Pose3& pose);
+
+  /// Copy all poses out
+  std::vector<Pose3> poses() const;
+
+  /// Rotations of all poses
+  const Rot3Batch& rotations() const { return R_; }
+
+  /// Translations of all poses
+  const Point3Batch& translations() const { return t_; }
+
+  /// @}
+  /// @name Group
+  /// @{
+
+  /// Inverse of every pose
+  Pose3Batch inverse() const;
+
+  /// Element-wise composition, this[k] * other[k]
+  Pose3Batch compose(const Pose3Batch& other) const;
+
+  /// Element-wise composition
+  Pose3Batch operator*(const Pose3Batch& other) const { return compose(other); }
+
+  /**
+   * Transform point k from the frame of pose k to world coordinates, as
+   * Pose3::transformFrom, with derivatives with respect to pose and point.
+   */
+  Point3Batch transformFrom(const Point3Batch& p,
+                            JacobianBatch<3, 6>* Hself = nullptr,
+                            JacobianBatch<3, 3>* Hpoint = nullptr) const;
+
+  /**
+   * Transform point k from world coordinates to the frame of pose k, as
+   * Pose3::transformTo, with derivatives with respect to pose and point.
+   */
+  Point3Batch transformTo(const Point3Batch& p,
+                          JacobianBatch<3, 6>* Hself = nullptr,
+                          JacobianBatch<3, 3>* Hpoint = nullptr) const;
+
+  /// @}
+  /// @name Lie Group
+  /// @{
+
+  /// Pose3::Expmap of every row of xi, with Pose3::ExpmapDerivative in H
+  static Pose3Batch Expmap(const Vector6Batch& xi,
+                           JacobianBatch<6, 6>* H = nullptr);
+
+  /// Pose3::Logmap of every pose, with Pose3::LogmapDerivative in H
+  static Vector6Batch Logmap(const Pose3Batch& poses,
+                             JacobianBatch<6, 6>* H = nullptr);
+
+  /// @}
+};
+
+}  // namespace gtsam
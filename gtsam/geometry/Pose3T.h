@@ -0,0 +1,251 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   Pose3T.h
+ * @brief  3D pose templated on the representation of its rotation
+ * @date   October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/geometry/Quaternion.h>
+#include <gtsam/geometry/Rot3.h>
+#include <gtsam/geometry/SO3.h>
+#include <gtsam/base/Lie.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+
+namespace gtsam {
+
+/**
+ * Operations on a rotation representation that Pose3T needs beyond its Lie
+ * group traits. Specialized for SO3, a 3*3 matrix as in Rot3M, and for unit
+ * quaternions, as in Rot3Q.
+ */
+template <class ROTATION>
+struct RotationRepresentation;
+
+/// Rotation matrix representation
+template <>
+struct RotationRepresentation<SO3> {
+  static Vector3 Rotate(const SO3& R, const Vector3& p) {
+    return R.matrix() * p;
+  }
+  static Vector3 Unrotate(const SO3& R, const Vector3& p) {
+    return R.matrix().transpose() * p;
+  }
+  static Matrix3 Matrix(const SO3& R) { return R.matrix(); }
+  static SO3 FromRot3(const Rot3& R) { return SO3(R.matrix()); }
+};
+
+/**
+ * Unit quaternion representation. Compose is a quaternion product and points
+ * are rotated without converting to a matrix, which makes compose and
+ * retract cheaper than with SO3; only the Adjoint needs the matrix.
+ */
+template <>
+struct RotationRepresentation<gtsam::Quaternion> {
+  static Vector3 Rotate(const gtsam::Quaternion& q, const Vector3& p) {
+    return q._transformVector(p);
+  }
+  static Vector3 Unrotate(const gtsam::Quaternion& q, const Vector3& p) {
+    return q.conjugate()._transformVector(p);
+  }
+  static Matrix3 Matrix(const gtsam::Quaternion& q) {
+    return q.toRotationMatrix();
+  }
+  static gtsam::Quaternion FromRot3(const Rot3& R) { return R.toQuaternion(); }
+};
+
+/**
+ * A 3D pose (R,t) with the rotation stored as ROTATION, either SO3 or
+ * gtsam::Quaternion. The group operations, Expmap and Logmap (and hence
+ * retract and localCoordinates) are those of Pose3 with GTSAM_POSE3_EXPMAP.
+ *
+ * Pose3 uses Rot3, whose representation is chosen at configure time with
+ * GTSAM_USE_QUATERNIONS. Pose3T<SO3> and Pose3T<Quaternion> can be used side
+ * by side in one binary, e.g., in Values and BetweenFactor, to compare the
+ * two representations on the same workload.
+ */
+template <class ROTATION>
+class Pose3T : public LieGroup<Pose3T<ROTATION>, 6> {
+ public:
+  typedef ROTATION Rotation;
+  typedef Vector3 Translation;
+  typedef RotationRepresentation<ROTATION> Representation;
+
+ private:
+  ROTATION R_;
+  Vector3 t_;
+
+ public:
+  /// @name Standard Constructors
+  /// @{
+
+  /// Default constructor is identity
+  Pose3T() : R_(traits<ROTATION>::Identity()), t_(0, 0, 0) {}
+
+  /// Construct from rotation and translation
+  Pose3T(const ROTATION& R, const Vector3& t) : R_(R), t_(t) {}
+
+  /// Convert from Pose3
+  explicit Pose3T(const Pose3& pose)
+      : R_(Representation::FromRot3(pose.rotation())),
+        t_(pose.translation()) {}
+
+  /// @}
+  /// @name Testable
+  /// @{
+
+  void print(const std::string& s = "") const {
+    std::cout << (s.empty() ? s : s + " ") << "R: [\n"
+              << matrix3() << "]\nt: " << t_.transpose() << std::endl;
+  }
+
+  bool equals(const Pose3T& other, double tol = 1e-9) const {
+    return equal_with_abs_tol(matrix3(), other.matrix3(), tol) &&
+           equal_with_abs_tol(t_, other.t_, tol);
+  }
+
+  /// @}
+  /// @name Group
+  /// @{
+
+  static Pose3T identity() { return Pose3T(); }
+
+  /// Group composition
+  Pose3T operator*(const Pose3T& T) const {
+    return Pose3T(traits<ROTATION>::Compose(R_, T.R_),
+                  t_ + Representation::Rotate(R_, T.t_));
+  }
+
+  /// Group inverse
+  Pose3T inverse() const {
+    const ROTATION Rt = traits<ROTATION>::Inverse(R_);
+    return Pose3T(Rt, -Representation::Rotate(Rt, t_));
+  }
+
+  using LieGroup<Pose3T<ROTATION>, 6>::inverse;  // version with derivative
+
+  /// @}
+  /// @name Lie Group
+  /// @{
+
+  /// Exponential map at identity, as Pose3::Expmap
+  static Pose3T Expmap(const Vector6& xi,
+                       OptionalJacobian<6, 6> Hxi = boost::none) {
+    if (Hxi) *Hxi = Pose3::ExpmapDerivative(xi);
+    const Vector3 w = xi.head<3>(), v = xi.tail<3>();
+    const ROTATION R = traits<ROTATION>::Expmap(w);
+    const double theta2 = w.dot(w);
+    if (theta2 > std::numeric_limits<double>::epsilon()) {
+      const Vector3 t_parallel = w * w.dot(v);
+      const Vector3 w_cross_v = w.cross(v);
+      return Pose3T(R, (w_cross_v - Representation::Rotate(R, w_cross_v) +
+                        t_parallel) / theta2);
+    }
+    return Pose3T(R, v);
+  }
+
+  /// Log map at identity, as Pose3::Logmap
+  static Vector6 Logmap(const Pose3T& pose,
+                        OptionalJacobian<6, 6> Hpose = boost::none) {
+    const Vector3 w = traits<ROTATION>::Logmap(pose.R_);
+    const Vector3& T = pose.t_;
+    const double t = w.norm();
+    Vector6 xi;
+    if (t < 1e-10) {
+      xi << w, T;
+    } else {
+      const Matrix3 W = skewSymmetric(w / t);
+      const double Tan = tan(0.5 * t);
+      const Vector3 WT = W * T;
+      xi << w, T - (0.5 * t) * WT + (1 - t / (2. * Tan)) * (W * WT);
+    }
+    if (Hpose) {
+      // See Pose3::LogmapDerivative
+      const Matrix3 Jw = SO3::LogmapDerivative(w);
+      const Matrix3 Q = Pose3::ComputeQforExpmapDerivative(xi);
+      *Hpose << Jw, Z_3x3, -Jw * Q * Jw, Jw;
+    }
+    return xi;
+  }
+
+  /// Adjoint map, see Pose3::AdjointMap
+  Matrix6 AdjointMap() const {
+    const Matrix3 R = matrix3();
+    Matrix6 adj;
+    adj << R, Z_3x3, skewSymmetric(t_) * R, R;
+    return adj;
+  }
+
+  /// Chart at the origin is Expmap/Logmap, as for Pose3 by default
+  struct ChartAtOrigin {
+    static Pose3T Retract(const Vector6& xi,
+                          OptionalJacobian<6, 6> Hxi = boost::none) {
+      return Expmap(xi, Hxi);
+    }
+    static Vector6 Local(const Pose3T& pose,
+                         OptionalJacobian<6, 6> Hpose = boost::none) {
+      return Logmap(pose, Hpose);
+    }
+  };
+
+  /// @}
+  /// @name Standard Interface
+  /// @{
+
+  const ROTATION& rotation() const { return R_; }
+
+  const Vector3& translation() const { return t_; }
+
+  /// Rotation matrix
+  Matrix3 matrix3() const { return Representation::Matrix(R_); }
+
+  /// Transform a point from pose coordinates to world coordinates
+  Point3 transformFrom(const Point3& p) const {
+    return Representation::Rotate(R_, p) + t_;
+  }
+
+  /// Transform a point from world coordinates to pose coordinates
+  Point3 transformTo(const Point3& p) const {
+    return Representation::Unrotate(R_, p - t_);
+  }
+
+  /// Convert to Pose3
+  Pose3 pose3() const { return Pose3(Rot3(matrix3()), t_); }
+
+  /// @}
+
+ public:
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Pose with the rotation stored as a matrix, as Pose3 with Rot3M
+typedef Pose3T<SO3> Pose3M;
+
+/// Pose with the rotation stored as a unit quaternion, as Pose3 with Rot3Q
+typedef Pose3T<gtsam::Quaternion> Pose3Q;
+
+template <class ROTATION>
+struct traits<Pose3T<ROTATION> >
+    : public internal::LieGroup<Pose3T<ROTATION> > {};
+
+template <class ROTATION>
+struct traits<const Pose3T<ROTATION> >
+    : public internal::LieGroup<Pose3T<ROTATION> > {};
+
+}  // namespace gtsam
@@ -110,6 +110,8 @@ namespace gtsam {
   /* ************************************************************************* */
   Point3 Rot3::rotate(const Point3& p,
         OptionalJacobian<3,3> H1,  OptionalJacobian<3,3> H2) const {
+    // Without derivatives, avoid converting to a matrix
+    if (!H1 && !H2) return quaternion_._transformVector(p);
     const Matrix3 R = matrix();
     if (H1) *H1 = R * skewSymmetric(-p.x(), -p.y(), -p.z());
     if (H2) *H2 = R;
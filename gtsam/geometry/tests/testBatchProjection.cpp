@@ -0,0 +1,139 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   testBatchProjection.cpp
+ * @brief  Unit tests for the vectorized projection in CameraSet
+ * @date   October, 2026
+ */
+
+#include <gtsam/geometry/CameraSet.h>
+#include <gtsam/geometry/Cal3Unified.h>
+#include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/PinholePose.h>
+#include <gtsam/base/Testable.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// m cameras around the origin, all looking at the points below.
+template <class CAMERA, class CALIBRATION>
+CameraSet<CAMERA> createCameras(const CALIBRATION& K, size_t m) {
+  CameraSet<CAMERA> cameras;
+  for (size_t i = 0; i < m; i++) {
+    const Pose3 pose(Rot3::Ypr(0.1 * i, -0.05 * i, 0.02),
+                     Point3(0.3 * i, -0.1 * i, -5.0 + 0.2 * i));
+    cameras.push_back(CAMERA(pose, K));
+  }
+  return cameras;
+}
+
+const Point3 kPoint(0.2, -0.3, 1.0);
+
+// Compare CameraSet::project2 with projecting into the cameras one by one.
+template <class CAMERA>
+bool compareWithCameras(const CameraSet<CAMERA>& cameras) {
+  typename CameraSet<CAMERA>::FBlocks Fs;
+  Matrix E;
+  const Point2Vector z = cameras.project2(kPoint, Fs, E);
+  const Point2Vector zOnly = cameras.project2(kPoint);
+  bool ok = z.size() == cameras.size() && zOnly.size() == cameras.size();
+  for (size_t i = 0; i < cameras.size(); i++) {
+    Eigen::Matrix<double, 2, traits<CAMERA>::dimension> Fi;
+    Matrix23 Ei;
+    const Point2 expected = cameras[i].project2(kPoint, Fi, Ei);
+    ok = ok && assert_equal(expected, z[i], 1e-9) &&
+         assert_equal(expected, zOnly[i], 1e-9) &&
+         assert_equal(Matrix(Fi), Matrix(Fs[i]), 1e-9) &&
+         assert_equal(Matrix(Ei), Matrix(E.block<2, 3>(2 * i, 0)), 1e-9);
+  }
+  return ok;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(BatchProjection, Supported) {
+  EXPECT(BatchProjection<PinholePose<Cal3_S2> >::value);
+  EXPECT(BatchProjection<PinholeCamera<Cal3Bundler> >::value);
+  EXPECT(BatchProjection<PinholeCamera<Cal3DS2> >::value);
+  EXPECT(!BatchProjection<PinholeCamera<Cal3Unified> >::value);
+  EXPECT(!BatchProjection<CalibratedCamera>::value);
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3_S2) {
+  const Cal3_S2 K(500, 510, 0.1, 320, 240);
+  for (size_t m : {1, 4, 6})
+    EXPECT(compareWithCameras(createCameras<PinholePose<Cal3_S2> >(
+        boost::make_shared<Cal3_S2>(K), m)));
+  EXPECT(compareWithCameras(createCameras<PinholeCamera<Cal3_S2> >(K, 7)));
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3Bundler) {
+  const Cal3Bundler K(500, 1e-2, 1e-3, 320, 240);
+  EXPECT(compareWithCameras(createCameras<PinholePose<Cal3Bundler> >(
+      boost::make_shared<Cal3Bundler>(K), 5)));
+  EXPECT(compareWithCameras(createCameras<PinholeCamera<Cal3Bundler> >(K, 6)));
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, Cal3DS2) {
+  const Cal3DS2 K(500, 510, 0.1, 320, 240, 1e-2, 1e-3, 2e-3, -3e-3);
+  EXPECT(compareWithCameras(createCameras<PinholePose<Cal3DS2> >(
+      boost::make_shared<Cal3DS2>(K), 5)));
+  EXPECT(compareWithCameras(createCameras<PinholeCamera<Cal3DS2> >(K, 6)));
+}
+
+/* ************************************************************************* */
+TEST(BatchProjection, ProjectPoints) {
+  typedef PinholeCamera<Cal3DS2> Camera;
+  const Camera camera(Pose3(Rot3::Ypr(0.1, 0.2, 0.3), Point3(0, 0, -5)),
+                      Cal3DS2(500, 510, 0.1, 320, 240, 1e-2, 1e-3, 2e-3, 0));
+  vector<Point3> points;
+  for (size_t j = 0; j < 7; j++)
+    points.emplace_back(0.1 * j, -0.2 + 0.05 * j, 0.3 * j);
+
+  Matrix Dcamera, Dpoints;
+  const Point2Vector z = BatchProjection<Camera>::ProjectPoints(
+      camera, points, &Dcamera, &Dpoints);
+  EXPECT_LONGS_EQUAL(7, z.size());
+  for (size_t j = 0; j < points.size(); j++) {
+    Eigen::Matrix<double, 2, 15> expectedF;
+    Matrix23 expectedE;
+    const Point2 expected = camera.project2(points[j], expectedF, expectedE);
+    EXPECT(assert_equal(expected, z[j], 1e-9));
+    EXPECT(assert_equal(Matrix(expectedF),
+                        Matrix(Dcamera.block<2, 15>(2 * j, 0)), 1e-9));
+    EXPECT(assert_equal(Matrix(expectedE),
+                        Matrix(Dpoints.block<2, 3>(2 * j, 0)), 1e-9));
+  }
+}
+
+/* ************************************************************************* */
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+TEST(BatchProjection, Cheirality) {
+  auto cameras = createCameras<PinholeCamera<Cal3_S2> >(Cal3_S2(), 3);
+  cameras.push_back(
+      PinholeCamera<Cal3_S2>(Pose3(Rot3(), Point3(0, 0, 5)), Cal3_S2()));
+  CHECK_EXCEPTION(cameras.project2(kPoint), CheiralityException);
+}
+#endif
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   testPose3Batch.cpp
+ * @brief  Unit tests for structure-of-arrays Rot3 and Pose3 operations
+ * @date   October, 2026
+ */
+
+#include <gtsam/geometry/Pose3Batch.h>
+#include <gtsam/base/TestableAssertions.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+// More than one block, with tangent vectors near zero and angles near pi.
+const size_t N = 150;
+
+Vector6Batch createTangents() {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  Vector6Batch xi(N, 6);
+  for (size_t k = 0; k < N; k++)
+    for (int i = 0; i < 6; i++) xi(k, i) = 2.0 * uniform(rng);
+  xi.row(3) << 0, 0, 0, 1, 2, 3;
+  xi.row(4) << 1e-9, -2e-9, 1e-9, 1, 2, 3;
+  xi.row(5) << 1e-6, 2e-6, -1e-6, 1, 2, 3;
+  xi.row(6) << M_PI, 0, 0, 1, 2, 3;
+  xi.row(7) << 0, 0.6 * (M_PI - 1e-4), 0.8 * (M_PI - 1e-4), 1, 2, 3;
+  xi.row(N - 1) << 0, 0, -M_PI + 1e-3, -1, 0, 1;
+  return xi;
+}
+
+const Vector6Batch kTangents = createTangents();
+const Pose3Batch kPoses = Pose3Batch::Expmap(kTangents);
+
+Point3Batch createPoints() {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> uniform(-10.0, 10.0);
+  Point3Batch p(N, 3);
+  for (size_t k = 0; k < N; k++)
+    for (int i = 0; i < 3; i++) p(k, i) = uniform(rng);
+  return p;
+}
+
+const Point3Batch kPoints = createPoints();
+}  // namespace
+
+/* ************************************************************************* */
+TEST(Pose3Batch, Access) {
+  vector<Pose3> poses;
+  for (size_t k = 0; k < 3; k++)
+    poses.push_back(Pose3::Expmap(kTangents.row(k)));
+  Pose3Batch batch(poses);
+  LONGS_EQUAL(3, batch.size());
+  EXPECT(assert_equal(poses[1], batch.at(1)));
+  batch.set(1, poses[2]);
+  EXPECT(assert_equal(poses[2], batch.poses()[1]));
+  EXPECT(assert_equal(Pose3(), Pose3Batch(2).at(1)));
+  CHECK_EXCEPTION(batch.compose(Pose3Batch(2)), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(Rot3Batch, ExpmapLogmap) {
+  const Vector3Batch omega = kTangents.leftCols<3>();
+  JacobianBatch<3, 3> Hexp, Hlog;
+  const Rot3Batch R = Rot3Batch::Expmap(omega, &Hexp);
+  const Vector3Batch actual = Rot3Batch::Logmap(R, &Hlog);
+  for (size_t k = 0; k < N; k++) {
+    Matrix3 H;
+    const Vector3 w = omega.row(k);
+    const Rot3 expected = Rot3::Expmap(w, H);
+    EXPECT(assert_equal(expected, R.at(k), 1e-9));
+    EXPECT(assert_equal(H, jacobianAt<3, 3>(Hexp, k), 1e-9));
+    // Compare with the same rotation, as the logmap is unstable near pi
+    const Vector3 log = Rot3::Logmap(R.at(k), H);
+    EXPECT(assert_equal(log, Vector3(actual.row(k)), 1e-9));
+    EXPECT(assert_equal(H, jacobianAt<3, 3>(Hlog, k), 1e-6));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Rot3Batch, Group) {
+  const Rot3Batch& R = kPoses.rotations();
+  const Rot3Batch S = R.inverse();
+  vector<Rot3> reversed = S.rotations();
+  std::reverse(reversed.begin(), reversed.end());
+  const Rot3Batch RS = R * Rot3Batch(reversed);
+  const Point3Batch rotated = R.rotate(kPoints);
+  const Point3Batch unrotated = R.unrotate(kPoints);
+  for (size_t k = 0; k < N; k++) {
+    EXPECT(assert_equal(R.at(k).inverse(), S.at(k), 1e-12));
+    EXPECT(assert_equal(R.at(k) * S.at(N - 1 - k), RS.at(k), 1e-12));
+    const Point3 p = kPoints.row(k);
+    EXPECT(assert_equal(R.at(k).rotate(p), Point3(rotated.row(k)), 1e-12));
+    EXPECT(assert_equal(R.at(k).unrotate(p), Point3(unrotated.row(k)), 1e-12));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Pose3Batch, Group) {
+  const Pose3Batch inverse = kPoses.inverse();
+  const Pose3Batch composed = kPoses * inverse.compose(kPoses);
+  for (size_t k = 0; k < N; k++) {
+    const Pose3 T = kPoses.at(k);
+    EXPECT(assert_equal(T.inverse(), inverse.at(k), 1e-12));
+    EXPECT(assert_equal(T * (T.inverse() * T), composed.at(k), 1e-12));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Pose3Batch, Transform) {
+  JacobianBatch<3, 6> HfromPose, HtoPose;
+  JacobianBatch<3, 3> HfromPoint, HtoPoint;
+  const Point3Batch from =
+      kPoses.transformFrom(kPoints, &HfromPose, &HfromPoint);
+  const Point3Batch to = kPoses.transformTo(kPoints, &HtoPose, &HtoPoint);
+  for (size_t k = 0; k < N; k++) {
+    const Pose3 T = kPoses.at(k);
+    const Point3 p = kPoints.row(k);
+    Matrix36 Hpose;
+    Matrix3 Hpoint;
+    EXPECT(assert_equal(T.transformFrom(p, Hpose, Hpoint), Point3(from.row(k)),
+                        1e-12));
+    EXPECT(assert_equal(Hpose, jacobianAt<3, 6>(HfromPose, k), 1e-12));
+    EXPECT(assert_equal(Hpoint, jacobianAt<3, 3>(HfromPoint, k), 1e-12));
+    EXPECT(assert_equal(T.transformTo(p, Hpose, Hpoint), Point3(to.row(k)),
+                        1e-12));
+    EXPECT(assert_equal(Hpose, jacobianAt<3, 6>(HtoPose, k), 1e-12));
+    EXPECT(assert_equal(Hpoint, jacobianAt<3, 3>(HtoPoint, k), 1e-12));
+  }
+}
+
+/* ************************************************************************* */
+TEST(Pose3Batch, ExpmapLogmap) {
+  JacobianBatch<6, 6> Hexp, Hlog;
+  const Pose3Batch poses = Pose3Batch::Expmap(kTangents, &Hexp);
+  const Vector6Batch actual = Pose3Batch::Logmap(poses, &Hlog);
+  for (size_t k = 0; k < N; k++) {
+    Matrix6 H;
+    const Vector6 xi = kTangents.row(k);
+    const Pose3 expected = Pose3::Expmap(xi, H);
+    EXPECT(assert_equal(expected, poses.at(k), 1e-9));
+    EXPECT(assert_equal(H, jacobianAt<6, 6>(Hexp, k), 1e-9));
+    const Vector6 log = Pose3::Logmap(poses.at(k), H);
+    EXPECT(assert_equal(log, Vector6(actual.row(k)), 1e-9));
+    EXPECT(assert_equal(H, jacobianAt<6, 6>(Hlog, k), 1e-6));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   testPose3T.cpp
+ * @brief  Unit tests for poses with matrix and quaternion rotations
+ * @date   October, 2026
+ */
+
+#include <gtsam/geometry/Pose3T.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/base/testLie.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+GTSAM_CONCEPT_TESTABLE_INST(Pose3M)
+GTSAM_CONCEPT_LIE_INST(Pose3M)
+GTSAM_CONCEPT_TESTABLE_INST(Pose3Q)
+GTSAM_CONCEPT_LIE_INST(Pose3Q)
+
+namespace {
+const Pose3 T1(Rot3::Rodrigues(0.3, -0.2, 0.5), Point3(1, 2, 3));
+const Pose3 T2(Rot3::Rodrigues(-0.7, 0.4, 0.1), Point3(-1, 0.5, 2));
+const Pose3 T3(Rot3::Rodrigues(0, 0, M_PI - 1e-4), Point3(0, 1, 0));
+const Vector6 kXi = (Vector6() << 0.1, -0.2, 0.3, 1.0, -2.0, 0.5).finished();
+const Vector6 kXiSmall = (Vector6() << 1e-9, 0, -1e-9, 1, 2, 3).finished();
+
+// Check every operation against Pose3.
+template <class POSE>
+bool checkAgainstPose3() {
+  bool ok = true;
+  const POSE A(T1), B(T2), C(T3);
+  ok &= assert_equal(T1, A.pose3());
+  ok &= assert_equal(T1 * T2, (A * B).pose3());
+  ok &= assert_equal(T1.inverse(), A.inverse().pose3());
+  ok &= assert_equal(T1.AdjointMap(), A.AdjointMap());
+
+  Matrix6 H1, H2, expectedH1, expectedH2;
+  ok &= assert_equal(T1.between(T2, expectedH1, expectedH2),
+                     A.between(B, H1, H2).pose3());
+  ok &= assert_equal(expectedH1, H1);
+  ok &= assert_equal(expectedH2, H2);
+
+  const Point3 p(0.4, -1.0, 2.0);
+  ok &= assert_equal(T1.transformFrom(p), A.transformFrom(p));
+  ok &= assert_equal(T1.transformTo(p), A.transformTo(p));
+
+  for (const Vector6& xi : {kXi, kXiSmall}) {
+    Matrix6 H, expectedH;
+    ok &= assert_equal(Pose3::Expmap(xi, expectedH),
+                       POSE::Expmap(xi, H).pose3());
+    ok &= assert_equal(expectedH, H);
+  }
+  for (const Pose3& T : {T1, T3, Pose3::Expmap(kXiSmall)}) {
+    Matrix6 H, expectedH;
+    ok &= assert_equal(Pose3::Logmap(T, expectedH), POSE::Logmap(POSE(T), H),
+                       1e-7);
+    ok &= assert_equal(expectedH, H, 1e-5);
+  }
+  ok &= assert_equal(T1.retract(kXi), A.retract(kXi).pose3());
+  ok &= assert_equal(T1.localCoordinates(T2), A.localCoordinates(B));
+  return ok;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(Pose3T, Matrix) { EXPECT(checkAgainstPose3<Pose3M>()); }
+
+/* ************************************************************************* */
+TEST(Pose3T, Quaternion) { EXPECT(checkAgainstPose3<Pose3Q>()); }
+
+/* ************************************************************************* */
+TEST(Pose3T, Invariants) {
+  for (const Pose3& T : {T1, T2, T3}) {
+    EXPECT(check_group_invariants(Pose3Q(T), Pose3Q(T2)));
+    EXPECT(check_manifold_invariants(Pose3Q(T), Pose3Q(T2)));
+    EXPECT(check_group_invariants(Pose3M(T), Pose3M(T2)));
+    EXPECT(check_manifold_invariants(Pose3M(T), Pose3M(T2)));
+  }
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -696,6 +696,130 @@ TEST(triangulation, reprojectionError_cameraComparison) {
   EXPECT(assert_equal(expectedErrorSpherical, actualErrorSpherical, 1e-7));
 }
 
+//******************************************************************************
+TEST(triangulation, refineTriangulation) {
+  Pose3 pose3 = pose1 * Pose3(Rot3::Ypr(0.1, 0.2, 0.1), Point3(0.1, -2, -.1));
+  CameraSet<PinholeCamera<Cal3_S2> > cameras;
+  cameras += camera1, camera2,
+      PinholeCamera<Cal3_S2>(pose3, *sharedCal);
+  Point2Vector measurements;
+  for (const auto& camera : cameras)
+    measurements.push_back(camera.project(landmark));
+  measurements.at(0) += Point2(0.5, -0.7);
+  measurements.at(2) += Point2(-0.3, 0.2);
+
+  // Same minimum as triangulateNonlinear, from a perturbed estimate
+  const Point3 initial = landmark + Point3(0.1, -0.1, 0.05);
+  const Point3 expected = triangulateNonlinear(cameras, measurements, initial);
+  const Point3 actual = refineTriangulation(cameras, measurements, initial);
+  EXPECT(assert_equal(expected, actual, 1e-4));
+
+  // Starting at the minimum returns it
+  EXPECT(assert_equal(actual,
+                      refineTriangulation(cameras, measurements, actual), 1e-9));
+
+  // With a robust loss, the outlier is down-weighted as in triangulatePoint3
+  measurements.at(0) += Point2(100, 120);
+  auto model = noiseModel::Robust::Create(
+      noiseModel::mEstimator::Huber::Create(1.345), noiseModel::Unit::Create(2));
+  const Point3 robust =
+      refineTriangulation(cameras, measurements, landmark, model, 50);
+  EXPECT(assert_equal(landmark, robust, 0.05));
+}
+
+//******************************************************************************
+TEST(triangulation, triangulateSafeWarmStart) {
+  CameraSet<PinholeCamera<Cal3_S2> > cameras;
+  cameras += camera1, camera2;
+  Point2Vector measurements;
+  measurements += z1 + Point2(0.3, -0.2), z2;
+
+  TriangulationParameters params(1.0, true);
+  const TriangulationResult cold = triangulateSafe(cameras, measurements, params);
+  CHECK(cold.valid());
+
+  // Warm-started from a nearby point, the refinement finds the same point
+  const TriangulationResult warm = triangulateSafe(
+      cameras, measurements, params, Point3(*cold + Point3(0.01, 0.02, -0.01)));
+  CHECK(warm.valid());
+  EXPECT(assert_equal(*cold, *warm, 1e-4));
+
+  // The initial estimate is ignored without nonlinear refinement
+  params.enableEPI = false;
+  const TriangulationResult dlt = triangulateSafe(
+      cameras, measurements, params, Point3(10, 10, 10));
+  EXPECT(assert_equal(triangulatePoint3(cameras, measurements), *dlt, 1e-9));
+
+  // A rotation-only configuration is degenerate even when warm-started
+  params.enableEPI = true;
+  CameraSet<PinholeCamera<Cal3_S2> > rotated;
+  rotated += camera1,
+      PinholeCamera<Cal3_S2>(pose1 * Pose3(Rot3::Ypr(0.1, 0.05, 0), Point3()),
+                             *sharedCal);
+  Point2Vector rotatedMeasurements;
+  for (const auto& camera : rotated)
+    rotatedMeasurements.push_back(camera.project(landmark));
+  EXPECT(triangulateSafe(rotated, rotatedMeasurements, params, landmark)
+             .degenerate());
+}
+
+//******************************************************************************
+TEST(triangulation, triangulateTracks) {
+  typedef PinholeCamera<Cal3_S2> Camera;
+  const Pose3 pose3 =
+      pose1 * Pose3(Rot3::Ypr(0.1, 0.2, 0.1), Point3(0.1, -2, -.1));
+  const vector<Camera> cameras{camera1, camera2, Camera(pose3, *sharedCal)};
+  const Point3 landmark2(6, -0.5, 1.5);
+
+  vector<TrackMeasurements<Camera> > tracks(4);
+  for (size_t i = 0; i < cameras.size(); i++) {
+    tracks[0].emplace_back(i, cameras[i].project(landmark));
+    tracks[2].emplace_back(i, cameras[i].project(landmark2));
+  }
+  tracks[1].emplace_back(1, z2);  // single measurement
+  tracks[3] = tracks[2];
+  tracks[3][1].second += Point2(30, -20);  // outlier
+
+  TriangulationParameters params(1.0, false, -1, 10);
+  const auto results = triangulateTracks(cameras, tracks, params);
+  EXPECT_LONGS_EQUAL(4, results.size());
+  CHECK(results[0].valid());
+  EXPECT(assert_equal(landmark, *results[0], 1e-7));
+  EXPECT(results[1].degenerate());
+  CHECK(results[2].valid());
+  EXPECT(assert_equal(landmark2, *results[2], 1e-7));
+  EXPECT(results[3].outlier());
+
+  // Refinement keeps noise-free points and handles the same tracks
+  params.enableEPI = true;
+  const auto refined = triangulateTracks(cameras, tracks, params);
+  CHECK(refined[0].valid());
+  EXPECT(assert_equal(landmark, *refined[0], 1e-7));
+  EXPECT(refined[1].degenerate());
+
+  // Same as triangulateSafe on every track, with and without refinement, on
+  // noisy tracks as well
+  tracks[0][0].second += Point2(0.5, -0.4);
+  tracks[2][2].second += Point2(-0.3, 0.6);
+  for (bool enableEPI : {false, true}) {
+    params.enableEPI = enableEPI;
+    const auto actual = triangulateTracks(cameras, tracks, params);
+    for (size_t j = 0; j < tracks.size(); j++) {
+      CameraSet<Camera> trackCameras;
+      Point2Vector measured;
+      for (const auto& measurement : tracks[j]) {
+        trackCameras.push_back(cameras[measurement.first]);
+        measured.push_back(measurement.second);
+      }
+      const auto expected = triangulateSafe(trackCameras, measured, params);
+      EXPECT(expected.valid() == actual[j].valid());
+      EXPECT(expected.degenerate() == actual[j].degenerate());
+      EXPECT(expected.outlier() == actual[j].outlier());
+      if (expected) EXPECT(assert_equal(*expected, *actual[j], 1e-9));
+    }
+  }
+}
+
 //******************************************************************************
 int main() {
   TestResult tr;
@@ -23,6 +23,34 @@
 
 namespace gtsam {
 
+namespace {
+typedef Eigen::Matrix<double, Eigen::Dynamic, 4> DLTMatrix;
+
+// Right null vector of the DLT matrix A. A QR decomposition first reduces the
+// 2m*4 matrix A to a 4*4 triangular matrix R with the same singular values and
+// right singular vectors, so that the SVD itself is done on a fixed-size
+// matrix, without allocation.
+Vector4 nullVector(const DLTMatrix& A, double rank_tol) {
+  Matrix4 R = Matrix4::Zero();
+  if (A.rows() >= 4) {
+    Eigen::HouseholderQR<DLTMatrix> qr(A);
+    R = qr.matrixQR().topRows<4>().triangularView<Eigen::Upper>();
+  } else {
+    R.topRows(A.rows()) = A;
+  }
+
+  Eigen::JacobiSVD<Matrix4> svd(R, Eigen::ComputeFullV);
+  int rank = 0;
+  for (size_t j = 0; j < 4; j++)
+    if (svd.singularValues()(j) > rank_tol) rank++;
+
+  if (rank < 3)
+    throw(TriangulationUnderconstrainedException());
+
+  return svd.matrixV().col(3);
+}
+}  // namespace
+
 Vector4 triangulateHomogeneousDLT(
     const std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>>& projection_matrices,
     const Point2Vector& measurements, double rank_tol) {
@@ -31,7 +59,7 @@ Vector4 triangulateHomogeneousDLT(
   size_t m = projection_matrices.size();
 
   // Allocate DLT matrix
-  Matrix A = Matrix::Zero(m * 2, 4);
+  DLTMatrix A(m * 2, 4);
 
   for (size_t i = 0; i < m; i++) {
     size_t row = i * 2;
@@ -42,15 +70,7 @@ Vector4 triangulateHomogeneousDLT(
     A.row(row) = p.x() * projection.row(2) - projection.row(0);
     A.row(row + 1) = p.y() * projection.row(2) - projection.row(1);
   }
-  int rank;
-  double error;
-  Vector v;
-  boost::tie(rank, error, v) = DLT(A, rank_tol);
-
-  if (rank < 3)
-    throw(TriangulationUnderconstrainedException());
-
-  return v;
+  return nullVector(A, rank_tol);
 }
 
 Vector4 triangulateHomogeneousDLT(
@@ -61,7 +81,7 @@ Vector4 triangulateHomogeneousDLT(
   size_t m = projection_matrices.size();
 
   // Allocate DLT matrix
-  Matrix A = Matrix::Zero(m * 2, 4);
+  DLTMatrix A(m * 2, 4);
 
   for (size_t i = 0; i < m; i++) {
     size_t row = i * 2;
@@ -72,15 +92,7 @@ Vector4 triangulateHomogeneousDLT(
     A.row(row) = p.x() * projection.row(2) - p.z() * projection.row(0);
     A.row(row + 1) = p.y() * projection.row(2) - p.z() * projection.row(1);
   }
-  int rank;
-  double error;
-  Vector v;
-  boost::tie(rank, error, v) = DLT(A, rank_tol);
-
-  if (rank < 3)
-    throw(TriangulationUnderconstrainedException());
-
-  return v;
+  return nullVector(A, rank_tol);
 }
 
 Point3 triangulateDLT(
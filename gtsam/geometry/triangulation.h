@@ -30,6 +30,15 @@
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/slam/TriangulationFactor.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <utility>
+#include <vector>
 
 namespace gtsam {
 
@@ -205,6 +214,66 @@ Point3 triangulateNonlinear(
   return optimize(graph, values, Symbol('p', 0));
 }
 
+/**
+ * Refine a point with Gauss-Newton on the same reprojection errors as
+ * triangulateNonlinear, but solving the 3*3 normal equations directly instead
+ * of building and optimizing a factor graph. Meant for good initial estimates,
+ * e.g., the point triangulated at a nearby linearization point: iterations
+ * stop as soon as the error does not decrease.
+ * @param cameras pinhole cameras (monocular or stereo)
+ * @param measurements 2D measurements
+ * @param initialEstimate
+ * @param model noise model of the measurements, unit if not given
+ * @param maxIterations maximum number of Gauss-Newton iterations
+ * @param tolerance stop when the update is smaller than this
+ * @return refined Point3
+ */
+template<class CAMERA>
+Point3 refineTriangulation(
+    const CameraSet<CAMERA>& cameras,
+    const typename CAMERA::MeasurementVector& measurements,
+    const Point3& initialEstimate, const SharedNoiseModel& model = nullptr,
+    size_t maxIterations = 10, double tolerance = 1e-9) {
+  static SharedNoiseModel unit(noiseModel::Unit::Create(
+      traits<typename CAMERA::Measurement>::dimension));
+  const SharedNoiseModel& noiseModel = model ? model : unit;
+
+  std::vector<TriangulationFactor<CAMERA> > factors;
+  factors.reserve(measurements.size());
+  for (size_t i = 0; i < measurements.size(); i++)
+    factors.emplace_back(cameras[i], measurements[i], noiseModel, 0);
+
+  Point3 point = initialEstimate, previous = initialEstimate;
+  double previousError = std::numeric_limits<double>::infinity();
+  Matrix A;
+  for (size_t iteration = 0; iteration <= maxIterations; iteration++) {
+    // Linearize all reprojection errors at the current point
+    Matrix3 H = Matrix3::Zero();
+    Vector3 g = Vector3::Zero();
+    double error = 0.0;
+    for (const auto& factor : factors) {
+      Vector b = -factor.evaluateError(point, A);
+      noiseModel->WhitenSystem(A, b);
+      H.noalias() += A.transpose() * A;
+      g.noalias() += A.transpose() * b;
+      error += b.squaredNorm();
+    }
+
+    // Keep the previous point if the error did not decrease
+    if (error >= previousError) return previous;
+    if (iteration == maxIterations) break;
+
+    Eigen::LDLT<Matrix3> ldlt(H);
+    if (ldlt.info() != Eigen::Success) break;
+    const Vector3 delta = ldlt.solve(g);
+    previous = point;
+    previousError = error;
+    point += delta;
+    if (delta.norm() < tolerance) break;
+  }
+  return point;
+}
+
 template<class CAMERA>
 std::vector<Matrix34, Eigen::aligned_allocator<Matrix34>>
 projectionMatricesFromCameras(const CameraSet<CAMERA> &cameras) {
@@ -467,11 +536,63 @@ private:
   }
 };
 
-/// triangulateSafe: extensive checking of the outcome
+/**
+ * Check a triangulated point as triangulateSafe does: flag it if it is too far
+ * from any of the cameras, behind any of them, or if the largest reprojection
+ * error is too large, according to params.
+ */
+template<class CAMERA>
+TriangulationResult checkTriangulation(const CameraSet<CAMERA>& cameras,
+    const typename CAMERA::MeasurementVector& measured, const Point3& point,
+    const TriangulationParameters& params) {
+  // Check landmark distance and re-projection errors to avoid outliers
+  size_t i = 0;
+  double maxReprojError = 0.0;
+  for(const CAMERA& camera: cameras) {
+    const Pose3& pose = camera.pose();
+    if (params.landmarkDistanceThreshold > 0
+        && distance3(pose.translation(), point)
+            > params.landmarkDistanceThreshold)
+      return TriangulationResult::FarPoint();
+#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
+    // verify that the triangulated point lies in front of all cameras
+    // Only needed if this was not yet handled by exception
+    const Point3& p_local = pose.transformTo(point);
+    if (p_local.z() <= 0)
+      return TriangulationResult::BehindCamera();
+#endif
+    // Check reprojection error
+    if (params.dynamicOutlierRejectionThreshold > 0) {
+      const typename CAMERA::Measurement& zi = measured.at(i);
+      Point2 reprojectionError = camera.reprojectionError(point, zi);
+      maxReprojError = std::max(maxReprojError, reprojectionError.norm());
+    }
+    i += 1;
+  }
+  // Flag as degenerate if average reprojection error is too large
+  if (params.dynamicOutlierRejectionThreshold > 0
+      && maxReprojError > params.dynamicOutlierRejectionThreshold)
+    return TriangulationResult::Outlier();
+
+  // all good!
+  return TriangulationResult(point);
+}
+
+/**
+ * triangulateSafe: extensive checking of the outcome
+ * @param cameras pinhole cameras (monocular or stereo)
+ * @param measured measurements in the cameras
+ * @param params triangulation parameters
+ * @param initialEstimate if given and params.enableEPI is set, the point is
+ *        refined with refineTriangulation starting from this estimate, e.g.,
+ *        the point at a previous linearization point, instead of from the DLT
+ *        point. The DLT rank test still applies.
+ */
 template<class CAMERA>
 TriangulationResult triangulateSafe(const CameraSet<CAMERA>& cameras,
     const typename CAMERA::MeasurementVector& measured,
-    const TriangulationParameters& params) {
+    const TriangulationParameters& params,
+    const boost::optional<Point3>& initialEstimate = boost::none) {
 
   size_t m = cameras.size();
 
@@ -481,41 +602,21 @@ TriangulationResult triangulateSafe(const CameraSet<CAMERA>& cameras,
   else
     // We triangulate the 3D position of the landmark
     try {
-      Point3 point =
-          triangulatePoint3<CAMERA>(cameras, measured, params.rankTolerance,
-                                    params.enableEPI, params.noiseModel);
-
-      // Check landmark distance and re-projection errors to avoid outliers
-      size_t i = 0;
-      double maxReprojError = 0.0;
-      for(const CAMERA& camera: cameras) {
-        const Pose3& pose = camera.pose();
-        if (params.landmarkDistanceThreshold > 0
-            && distance3(pose.translation(), point)
-                > params.landmarkDistanceThreshold)
-          return TriangulationResult::FarPoint();
-#ifdef GTSAM_THROW_CHEIRALITY_EXCEPTION
-        // verify that the triangulated point lies in front of all cameras
-        // Only needed if this was not yet handled by exception
-        const Point3& p_local = pose.transformTo(point);
-        if (p_local.z() <= 0)
-          return TriangulationResult::BehindCamera();
-#endif
-        // Check reprojection error
-        if (params.dynamicOutlierRejectionThreshold > 0) {
-          const typename CAMERA::Measurement& zi = measured.at(i);
-          Point2 reprojectionError = camera.reprojectionError(point, zi);
-          maxReprojError = std::max(maxReprojError, reprojectionError.norm());
-        }
-        i += 1;
+      Point3 point;
+      if (initialEstimate && params.enableEPI) {
+        // The DLT is still needed for its rank test, which flags rotation-only
+        // and other degenerate configurations the refinement cannot detect
+        triangulateDLT(projectionMatricesFromCameras(cameras), measured,
+                       params.rankTolerance);
+        point = refineTriangulation<CAMERA>(cameras, measured, *initialEstimate,
+                                            params.noiseModel);
+      } else {
+        point = triangulatePoint3<CAMERA>(cameras, measured,
+                                          params.rankTolerance,
+                                          params.enableEPI, params.noiseModel);
       }
-      // Flag as degenerate if average reprojection error is too large
-      if (params.dynamicOutlierRejectionThreshold > 0
-          && maxReprojError > params.dynamicOutlierRejectionThreshold)
-        return TriangulationResult::Outlier();
 
-      // all good!
-      return TriangulationResult(point);
+      return checkTriangulation(cameras, measured, point, params);
     } catch (TriangulationUnderconstrainedException&) {
       // This exception is thrown if
       // 1) There is a single pose for triangulation - this should not happen because we checked the number of poses before
@@ -527,6 +628,97 @@ TriangulationResult triangulateSafe(const CameraSet<CAMERA>& cameras,
     }
 }
 
+/// Measurements of a track, as pairs of camera index and measurement
+template<class CAMERA>
+using TrackMeasurements =
+    std::vector<std::pair<size_t, typename CAMERA::Measurement> >;
+
+namespace internal {
+/**
+ * Triangulate nrTracks tracks in parallel, where track(j) returns the
+ * TrackMeasurements of track j. The projection matrices of the cameras are
+ * computed once, and every task reuses its own buffers for the cameras and
+ * measurements of a track.
+ */
+template<class CAMERA, class TRACK>
+std::vector<TriangulationResult> triangulateTracks(
+    const std::vector<CAMERA>& cameras, size_t nrTracks, const TRACK& track,
+    const TriangulationParameters& params) {
+  typedef std::vector<Matrix34, Eigen::aligned_allocator<Matrix34> >
+      ProjectionMatrices;
+  ProjectionMatrices projectionMatrices;
+  projectionMatrices.reserve(cameras.size());
+  for (const CAMERA& camera : cameras)
+    projectionMatrices.push_back(camera.cameraProjectionMatrix());
+
+  std::vector<TriangulationResult> results(nrTracks);
+  auto triangulateRange = [&](size_t begin, size_t end) {
+    ProjectionMatrices trackProjections;
+    CameraSet<CAMERA> trackCameras;
+    typename CAMERA::MeasurementVector measured;
+    for (size_t j = begin; j < end; j++) {
+      trackProjections.clear();
+      trackCameras.clear();
+      measured.clear();
+      for (const auto& measurement : track(j)) {
+        trackProjections.push_back(projectionMatrices.at(measurement.first));
+        trackCameras.push_back(cameras[measurement.first]);
+        measured.push_back(measurement.second);
+      }
+      if (measured.size() < 2) {
+        results[j] = TriangulationResult::Degenerate();
+        continue;
+      }
+      try {
+        // Same steps as triangulatePoint3 in triangulateSafe
+        Point3 point = triangulateDLT(trackProjections, measured,
+                                      params.rankTolerance);
+        if (params.enableEPI)
+          point = triangulateNonlinear<CAMERA>(trackCameras, measured, point,
+                                               params.noiseModel);
+        results[j] = checkTriangulation(trackCameras, measured, point, params);
+      } catch (TriangulationUnderconstrainedException&) {
+        results[j] = TriangulationResult::Degenerate();
+      } catch (TriangulationCheiralityException&) {
+        results[j] = TriangulationResult::BehindCamera();
+      }
+    }
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, nrTracks, 64),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      triangulateRange(range.begin(), range.end());
+                    });
+#else
+  triangulateRange(0, nrTracks);
+#endif
+  return results;
+}
+}  // namespace internal
+
+/**
+ * Triangulate many tracks seen by a shared array of cameras, in parallel.
+ * Every track is triangulated with the DLT and, if params.enableEPI is set,
+ * refined with triangulateNonlinear, then checked, so that the results are
+ * those of triangulateSafe without an initial estimate.
+ * @param cameras all cameras
+ * @param tracks for every track, pairs of camera index and measurement
+ * @param params triangulation parameters
+ * @return a TriangulationResult for every track
+ */
+template<class CAMERA>
+std::vector<TriangulationResult> triangulateTracks(
+    const std::vector<CAMERA>& cameras,
+    const std::vector<TrackMeasurements<CAMERA> >& tracks,
+    const TriangulationParameters& params = TriangulationParameters()) {
+  return internal::triangulateTracks(
+      cameras, tracks.size(),
+      [&tracks](size_t j) -> const TrackMeasurements<CAMERA>& {
+        return tracks[j];
+      },
+      params);
+}
+
 // Vector of Cameras - used by the Python/MATLAB wrapper
 using CameraSetCal3Bundler = CameraSet<PinholeCamera<Cal3Bundler>>;
 using CameraSetCal3_S2 = CameraSet<PinholeCamera<Cal3_S2>>;
@@ -0,0 +1,74 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    KeyIndexMap.cpp
+ * @brief   A flat map from keys to the contiguous indices 0..n-1
+ * @date    October, 2026
+ */
+
+#include <gtsam/inference/KeyIndexMap.h>
+
+#include <stdexcept>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+KeyIndexMap::KeyIndexMap(const KeyVector& keys) : shift_(64) {
+  reserve(keys.size());
+  keys_.reserve(keys.size());
+  for (Key key : keys)
+    if (insert(key) != keys_.size() - 1)
+      throw std::invalid_argument("KeyIndexMap: duplicate key " +
+                                  DefaultKeyFormatter(key));
+}
+
+/* ************************************************************************* */
+size_t KeyIndexMap::at(Key key) const {
+  const size_t i = find(key);
+  if (i == npos)
+    throw std::out_of_range("KeyIndexMap::at: key " +
+                            DefaultKeyFormatter(key) + " not found");
+  return i;
+}
+
+/* ************************************************************************* */
+size_t KeyIndexMap::insert(Key key) {
+  if (2 * (keys_.size() + 1) > table_.size()) reserve(keys_.size() + 1);
+  size_t slot = hash(key);
+  for (; table_[slot] != 0; slot = (slot + 1) & mask())
+    if (keys_[table_[slot] - 1] == key) return table_[slot] - 1;
+  keys_.push_back(key);
+  table_[slot] = keys_.size();
+  return keys_.size() - 1;
+}
+
+/* ************************************************************************* */
+void KeyIndexMap::reserve(size_t n) {
+  size_t size = 8;
+  unsigned shift = 61;
+  while (size < 2 * n) {
+    size *= 2;
+    shift--;
+  }
+  if (size <= table_.size()) return;
+
+  // Re-insert all keys in the larger table
+  table_.assign(size, 0);
+  shift_ = shift;
+  for (size_t i = 0; i < keys_.size(); i++) {
+    size_t slot = hash(keys_[i]);
+    while (table_[slot] != 0) slot = (slot + 1) & mask();
+    table_[slot] = i + 1;
+  }
+}
+
+}  // namespace gtsam
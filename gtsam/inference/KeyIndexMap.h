@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    KeyIndexMap.h
+ * @brief   A flat map from keys to the contiguous indices 0..n-1
+ * @date    October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/dllexport.h>
+#include <gtsam/inference/Key.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * KeyIndexMap numbers a set of keys with the contiguous indices 0..n-1, such
+ * that data about the variables can be kept in plain arrays instead of maps.
+ * Lookups go through an open-addressing hash table, so they take constant time
+ * and touch one or two cache lines, instead of the log(n) tree nodes of a
+ * FastMap. The map is meant to be computed once, e.g., per linearization, and
+ * used in the inner loops; keys are only converted back at API boundaries.
+ */
+class GTSAM_EXPORT KeyIndexMap {
+ public:
+  static const size_t npos = std::numeric_limits<size_t>::max();  ///< not found
+
+  /// Default constructor: no keys
+  KeyIndexMap() : shift_(64) {}
+
+  /**
+   * Number the given keys in the given order.
+   * Throws std::invalid_argument if a key appears more than once.
+   */
+  explicit KeyIndexMap(const KeyVector& keys);
+
+  /// The number of keys
+  size_t size() const { return keys_.size(); }
+
+  /// Whether there are no keys
+  bool empty() const { return keys_.empty(); }
+
+  /// The keys, in the order of their indices
+  const KeyVector& keys() const { return keys_; }
+
+  /// The key with index i
+  Key key(size_t i) const { return keys_[i]; }
+
+  /// The index of a key, or npos if it is not in the map
+  size_t find(Key key) const {
+    if (table_.empty()) return npos;
+    for (size_t slot = hash(key);; slot = (slot + 1) & mask()) {
+      const uint32_t entry = table_[slot];
+      if (entry == 0) return npos;
+      if (keys_[entry - 1] == key) return entry - 1;
+    }
+  }
+
+  /// The index of a key, throws std::out_of_range if it is not in the map
+  size_t at(Key key) const;
+
+  /// Whether the key is in the map
+  bool exists(Key key) const { return find(key) != npos; }
+
+  /// Add a key at the end if it is not in the map yet, and return its index
+  size_t insert(Key key);
+
+ private:
+  KeyVector keys_;               ///< the keys, by index
+  std::vector<uint32_t> table_;  ///< 1 + the index of a key, or 0 if empty
+  unsigned shift_;               ///< 64 - log2 of the table size
+
+  size_t mask() const { return table_.size() - 1; }
+
+  /// Fibonacci hashing, which spreads the consecutive keys of a Symbol
+  size_t hash(Key key) const {
+    return (key * UINT64_C(11400714819323198485)) >> shift_;
+  }
+
+  /// Grow the table such that it is at most half full for n keys
+  void reserve(size_t n);
+};
+
+}  // namespace gtsam
@@ -16,6 +16,7 @@
  * @date    Sep 2, 2010
  */
 
+#include <algorithm>
 #include <vector>
 #include <limits>
 
@@ -202,11 +203,20 @@ Ordering Ordering::ColamdConstrained(const VariableIndex& variableIndex,
   for (auto key_factors: variableIndex)
     keyIndices.insert(keyIndices.end(), make_pair(key_factors.first, j++));
 
+  // Number the groups consecutively, keeping their order, as CCOLAMD requires
+  // group labels smaller than the number of variables. Unassigned variables
+  // are in group 0.
+  std::vector<int> labels;
+  if (groups.size() < n) labels.push_back(0);
+  for (const auto& key_group : groups) labels.push_back(key_group.second);
+  std::sort(labels.begin(), labels.end());
+  labels.erase(std::unique(labels.begin(), labels.end()), labels.end());
+
   // Assign groups
-  typedef FastMap<Key, int>::value_type key_group;
-  for(const key_group& p: groups) {
-    // FIXME: check that no groups are skipped
-    cmember[keyIndices.at(p.first)] = p.second;
+  for (const auto& key_group : groups) {
+    const auto label =
+        std::lower_bound(labels.begin(), labels.end(), key_group.second);
+    cmember[keyIndices.at(key_group.first)] = label - labels.begin();
   }
 
   return Ordering::ColamdConstrained(variableIndex, cmember);
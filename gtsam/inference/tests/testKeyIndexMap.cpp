@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testKeyIndexMap.cpp
+ * @brief   Unit tests for KeyIndexMap
+ * @date    October, 2026
+ */
+
+#include <gtsam/inference/KeyIndexMap.h>
+#include <gtsam/inference/Symbol.h>
+#include <CppUnitLite/TestHarness.h>
+
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::L;
+using symbol_shorthand::X;
+
+/* ************************************************************************* */
+TEST(KeyIndexMap, empty) {
+  const KeyIndexMap index;
+  EXPECT(index.empty());
+  EXPECT(!index.exists(X(0)));
+  EXPECT_LONGS_EQUAL(KeyIndexMap::npos, index.find(X(0)));
+  CHECK_EXCEPTION(index.at(X(0)), std::out_of_range);
+}
+
+/* ************************************************************************* */
+TEST(KeyIndexMap, constructor) {
+  const KeyVector keys{X(3), L(1), X(1), 7};
+  const KeyIndexMap index(keys);
+  EXPECT_LONGS_EQUAL(4, index.size());
+  EXPECT(keys == index.keys());
+  for (size_t i = 0; i < keys.size(); i++) {
+    EXPECT_LONGS_EQUAL(i, index.at(keys[i]));
+    EXPECT_LONGS_EQUAL(keys[i], index.key(i));
+  }
+  EXPECT(!index.exists(X(2)));
+  EXPECT_LONGS_EQUAL(KeyIndexMap::npos, index.find(L(3)));
+  CHECK_EXCEPTION(index.at(8), std::out_of_range);
+
+  CHECK_EXCEPTION(KeyIndexMap(KeyVector{X(1), L(1), X(1)}),
+                  std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(KeyIndexMap, insert) {
+  // Many keys, such that the table has to grow several times
+  KeyIndexMap index;
+  for (size_t j = 0; j < 1000; j++) {
+    EXPECT_LONGS_EQUAL(2 * j, index.insert(X(j)));
+    EXPECT_LONGS_EQUAL(2 * j + 1, index.insert(L(j)));
+  }
+  EXPECT_LONGS_EQUAL(2000, index.size());
+  for (size_t j = 0; j < 1000; j++) {
+    EXPECT_LONGS_EQUAL(2 * j, index.insert(X(j)));
+    EXPECT_LONGS_EQUAL(2 * j + 1, index.at(L(j)));
+    EXPECT(!index.exists(X(j + 1000)));
+  }
+  EXPECT_LONGS_EQUAL(2000, index.size());
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -109,6 +109,20 @@ TEST(Ordering, grouped_constrained_ordering) {
   EXPECT(assert_equal(expected, actual));
 }
 
+/* ************************************************************************* */
+TEST(Ordering, grouped_constrained_ordering_sparse_labels) {
+  // Group labels need not be consecutive, or smaller than the number of
+  // variables: here every variable has a label, in reverse order
+  SymbolicFactorGraph symbolicGraph = example::symbolicChain();
+
+  FastMap<Key, int> constraints;
+  for (Key key = 0; key < 6; key++) constraints[key] = 100 * (6 - key);
+
+  Ordering actual = Ordering::ColamdConstrained(symbolicGraph, constraints);
+  Ordering expected = list_of(5)(4)(3)(2)(1)(0);
+  EXPECT(assert_equal(expected, actual));
+}
+
 /* ************************************************************************* */
 TEST(Ordering, csr_format) {
   // Example in METIS manual
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ContiguousVectorValues.cpp
+ * @brief   Vector-valued variables stored in one contiguous vector
+ * @date    October, 2026
+ */
+
+#include <gtsam/linear/ContiguousVectorValues.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+namespace gtsam {
+
+  namespace {
+  // The keys of a VectorValues in increasing order, also when it is unordered
+  KeyVector sortedKeys(const VectorValues& x) {
+    KeyVector keys;
+    keys.reserve(x.size());
+    for (const auto& key_value : x) keys.push_back(key_value.first);
+    std::sort(keys.begin(), keys.end());
+    return keys;
+  }
+  }  // namespace
+
+  /* ************************************************************************* */
+  ContiguousVectorValues::ContiguousVectorValues()
+      : layout_(boost::make_shared<Layout>(Layout{KeyIndexMap(), {0}})) {}
+
+  /* ************************************************************************* */
+  ContiguousVectorValues::ContiguousVectorValues(const VectorValues& x)
+      : ContiguousVectorValues(x, sortedKeys(x)) {}
+
+  /* ************************************************************************* */
+  ContiguousVectorValues::ContiguousVectorValues(const VectorValues& x,
+                                                 const KeyVector& keys) {
+    auto layout = boost::make_shared<Layout>(Layout{KeyIndexMap(keys), {}});
+    std::vector<const Vector*> items;
+    items.reserve(keys.size());
+    layout->offsets.reserve(keys.size() + 1);
+    layout->offsets.push_back(0);
+    for (Key key : keys) {
+      items.push_back(&x.at(key));
+      layout->offsets.push_back(layout->offsets.back() + items.back()->size());
+    }
+
+    values_.resize(layout->offsets.back());
+    for (size_t i = 0; i < items.size(); i++)
+      values_.segment(layout->offsets[i], items[i]->size()) = *items[i];
+    layout_ = layout;
+  }
+
+  /* ************************************************************************* */
+  ContiguousVectorValues ContiguousVectorValues::Zero(
+      const ContiguousVectorValues& other) {
+    return ContiguousVectorValues(other.layout_, Vector::Zero(other.dim()));
+  }
+
+  /* ************************************************************************* */
+  VectorValues ContiguousVectorValues::vectorValues() const {
+    VectorValues result;
+    const KeyVector& keys = this->keys();
+    const std::vector<size_t>& offsets = layout_->offsets;
+    for (size_t i = 0; i < keys.size(); i++)
+      result.emplace(keys[i],
+                     values_.segment(offsets[i], offsets[i + 1] - offsets[i]));
+    return result;
+  }
+
+  /* ************************************************************************* */
+  void ContiguousVectorValues::print(const string& str,
+                                     const KeyFormatter& formatter) const {
+    cout << str << ": " << size() << " elements\n";
+    for (Key key : keys())
+      cout << "  " << formatter(key) << ": " << at(key).transpose() << "\n";
+    cout.flush();
+  }
+
+  /* ************************************************************************* */
+  bool ContiguousVectorValues::equals(const ContiguousVectorValues& x,
+                                      double tol) const {
+    return hasSameStructure(x) && equal_with_abs_tol(values_, x.values_, tol);
+  }
+
+  /* ************************************************************************* */
+  bool ContiguousVectorValues::hasSameStructure(
+      const ContiguousVectorValues& other) const {
+    return layout_ == other.layout_ ||
+           (keys() == other.keys() &&
+            layout_->offsets == other.layout_->offsets);
+  }
+
+  /* ************************************************************************* */
+  ContiguousVectorValues ContiguousVectorValues::operator+(
+      const ContiguousVectorValues& c) const {
+    assert(hasSameStructure(c));
+    return ContiguousVectorValues(layout_, values_ + c.values_);
+  }
+
+  /* ************************************************************************* */
+  ContiguousVectorValues ContiguousVectorValues::operator-(
+      const ContiguousVectorValues& c) const {
+    assert(hasSameStructure(c));
+    return ContiguousVectorValues(layout_, values_ - c.values_);
+  }
+
+  /* ************************************************************************* */
+  ContiguousVectorValues operator*(const double a,
+                                   const ContiguousVectorValues& v) {
+    return ContiguousVectorValues(v.layout_, a * v.values_);
+  }
+
+}  // namespace gtsam
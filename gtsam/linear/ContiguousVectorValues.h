@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ContiguousVectorValues.h
+ * @brief   Vector-valued variables stored in one contiguous vector
+ * @date    October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/inference/KeyIndexMap.h>
+#include <gtsam/base/Vector.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include <string>
+#include <vector>
+
+namespace gtsam {
+
+  /**
+   * ContiguousVectorValues stores the same data as VectorValues, but all
+   * variables are kept in one contiguous Vector, in the order of a given list
+   * of keys, together with a table of the offsets of the variables.
+   *
+   * The linear algebra operations, like dot products, norms and axpy, are
+   * then single Eigen operations on the whole vector, which vectorize across
+   * variables, and vector() gives access to the storage without copying.
+   * This is meant for iterative solvers, which do many such operations per
+   * iteration: convert the VectorValues once on the way in and once on the
+   * way out.
+   *
+   * The layout, i.e., the keys and offsets, is shared between copies and with
+   * Zero(), so copying a ContiguousVectorValues only copies the Vector.
+   */
+  class GTSAM_EXPORT ContiguousVectorValues {
+  public:
+    typedef ContiguousVectorValues This;
+    typedef Eigen::VectorBlock<Vector> Segment;             ///< a variable
+    typedef Eigen::VectorBlock<const Vector> ConstSegment;  ///< a variable
+
+  private:
+    /// The keys and where their variables are stored
+    struct Layout {
+      KeyIndexMap index;            ///< the keys, numbered 0..n-1
+      std::vector<size_t> offsets;  ///< start of each variable, then total
+    };
+
+    boost::shared_ptr<const Layout> layout_;
+    Vector values_;
+
+    /// Construct from a layout and the concatenated values
+    ContiguousVectorValues(const boost::shared_ptr<const Layout>& layout,
+                           Vector values)
+        : layout_(layout), values_(std::move(values)) {}
+
+  public:
+    /// @name Standard Constructors
+    /// @{
+
+    /** Default constructor creates an empty ContiguousVectorValues. */
+    ContiguousVectorValues();
+
+    /** Copy the variables of a VectorValues, in the order of their keys. */
+    explicit ContiguousVectorValues(const VectorValues& x);
+
+    /** Copy the variables of a VectorValues, in the given order. Throws
+     * std::invalid_argument if a key is repeated, and std::out_of_range if
+     * it is not in x. */
+    ContiguousVectorValues(const VectorValues& x, const KeyVector& keys);
+
+    /** Create a ContiguousVectorValues with the same structure as another,
+     * but filled with zeros. */
+    static ContiguousVectorValues Zero(const ContiguousVectorValues& other);
+
+    /// @}
+    /// @name Standard Interface
+    /// @{
+
+    /** Number of variables stored. */
+    size_t size() const { return layout_->index.size(); }
+
+    /** Total dimension of all variables. */
+    size_t dim() const { return values_.size(); }
+
+    /** Return the dimension of variable \c j. */
+    size_t dim(Key j) const {
+      const size_t i = layout_->index.at(j);
+      return layout_->offsets[i + 1] - layout_->offsets[i];
+    }
+
+    /** Check whether a variable with key \c j exists. */
+    bool exists(Key j) const { return layout_->index.exists(j); }
+
+    /** The keys, in the order of storage. */
+    const KeyVector& keys() const { return layout_->index.keys(); }
+
+    /** Read/write access to the variable with key \c j, without copying.
+     * Throws std::out_of_range if the key does not exist. */
+    Segment at(Key j) {
+      const size_t i = layout_->index.at(j);
+      return values_.segment(layout_->offsets[i],
+                             layout_->offsets[i + 1] - layout_->offsets[i]);
+    }
+
+    /** Read access to the variable with key \c j, without copying.
+     * Throws std::out_of_range if the key does not exist. */
+    ConstSegment at(Key j) const {
+      const size_t i = layout_->index.at(j);
+      return values_.segment(layout_->offsets[i],
+                             layout_->offsets[i + 1] - layout_->offsets[i]);
+    }
+
+    /** The concatenated variables, without copying. The view has a fixed
+     * size, so the storage cannot be resized out of sync with the layout. */
+    Eigen::Ref<Vector> vector() { return values_; }
+
+    /** The concatenated variables, without copying. */
+    const Vector& vector() const { return values_; }
+
+    /** Copy the variables back into a VectorValues. */
+    VectorValues vectorValues() const;
+
+    /** Set all values to zero vectors. */
+    void setZero() { values_.setZero(); }
+
+    /** print required by Testable for unit testing */
+    void print(const std::string& str = "ContiguousVectorValues",
+               const KeyFormatter& formatter = DefaultKeyFormatter) const;
+
+    /** equals required by Testable for unit testing */
+    bool equals(const ContiguousVectorValues& x, double tol = 1e-9) const;
+
+    /** Check if this has the same structure (keys, in the same order, and
+     * dimensions) as another. */
+    bool hasSameStructure(const ContiguousVectorValues& other) const;
+
+    /// @}
+    /// @name Linear algebra operations
+    /// @{
+
+    /** Dot product with another ContiguousVectorValues with the same
+     * structure (checked when NDEBUG is not defined). */
+    double dot(const ContiguousVectorValues& v) const {
+      assert(hasSameStructure(v));
+      return values_.dot(v.values_);
+    }
+
+    /** Vector L2 norm */
+    double norm() const { return values_.norm(); }
+
+    /** Squared vector L2 norm */
+    double squaredNorm() const { return values_.squaredNorm(); }
+
+    /** Element-wise addition.  Both must have the same structure (checked
+     * when NDEBUG is not defined). */
+    ContiguousVectorValues operator+(const ContiguousVectorValues& c) const;
+
+    /** Element-wise subtraction.  Both must have the same structure (checked
+     * when NDEBUG is not defined). */
+    ContiguousVectorValues operator-(const ContiguousVectorValues& c) const;
+
+    /** Element-wise addition in-place.  Both must have the same structure
+     * (checked when NDEBUG is not defined). */
+    ContiguousVectorValues& operator+=(const ContiguousVectorValues& c) {
+      assert(hasSameStructure(c));
+      values_ += c.values_;
+      return *this;
+    }
+
+    /** Element-wise subtraction in-place.  Both must have the same structure
+     * (checked when NDEBUG is not defined). */
+    ContiguousVectorValues& operator-=(const ContiguousVectorValues& c) {
+      assert(hasSameStructure(c));
+      values_ -= c.values_;
+      return *this;
+    }
+
+    /** y += alpha * x, in one pass.  Both must have the same structure
+     * (checked when NDEBUG is not defined). */
+    void axpy(double alpha, const ContiguousVectorValues& x) {
+      assert(hasSameStructure(x));
+      values_ += alpha * x.values_;
+    }
+
+    /** Element-wise scaling by a constant. */
+    friend GTSAM_EXPORT ContiguousVectorValues operator*(
+        const double a, const ContiguousVectorValues& v);
+
+    /** Element-wise scaling by a constant in-place. */
+    ContiguousVectorValues& operator*=(double alpha) {
+      values_ *= alpha;
+      return *this;
+    }
+
+    /// @}
+  };
+
+  /// traits
+  template<>
+  struct traits<ContiguousVectorValues>
+      : public Testable<ContiguousVectorValues> {};
+
+}  // namespace gtsam
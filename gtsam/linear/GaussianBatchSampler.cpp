@@ -0,0 +1,188 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file GaussianBatchSampler.cpp
+ * @brief Draw many joint samples from a Gaussian Bayes net or Bayes tree.
+ * @date October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+#include <gtsam/linear/GaussianBatchSampler.h>
+#include <gtsam/linear/linearExceptions.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <boost/range/adaptor/reversed.hpp>
+
+#include <algorithm>
+#include <map>
+#include <random>
+
+using std::vector;
+
+namespace gtsam {
+
+const size_t GaussianBatchSampler::kBlockSize;
+
+/* ************************************************************************ */
+GaussianBatchSampler::GaussianBatchSampler(const GaussianBayesNet& bayesNet) {
+  vector<GaussianConditional::shared_ptr> conditionals;
+  for (auto conditional : boost::adaptors::reverse(bayesNet))
+    conditionals.push_back(conditional);
+  initialize(conditionals);
+}
+
+/* ************************************************************************ */
+namespace {
+// Collect clique conditionals in pre-order, i.e., parents before children.
+void collectConditionals(
+    const GaussianBayesTree::sharedClique& clique,
+    vector<GaussianConditional::shared_ptr>* conditionals) {
+  if (clique->conditional()) conditionals->push_back(clique->conditional());
+  for (const auto& child : clique->children)
+    collectConditionals(child, conditionals);
+}
+}  // namespace
+
+GaussianBatchSampler::GaussianBatchSampler(const GaussianBayesTree& bayesTree) {
+  vector<GaussianConditional::shared_ptr> conditionals;
+  for (const auto& root : bayesTree.roots())
+    collectConditionals(root, &conditionals);
+  initialize(conditionals);
+}
+
+/* ************************************************************************ */
+void GaussianBatchSampler::initialize(
+    const vector<GaussianConditional::shared_ptr>& conditionals) {
+  gttic(GaussianBatchSampler_initialize);
+
+  // Row offsets for all variables, in key order.
+  std::map<Key, size_t> dims;
+  for (const auto& conditional : conditionals)
+    for (auto it = conditional->begin(); it != conditional->end(); ++it)
+      dims.emplace(*it, conditional->getDim(it));
+  offsets_.push_back(0);
+  for (auto&& kv : dims) {
+    keys_.push_back(kv.first);
+    offsets_.push_back(offsets_.back() + kv.second);
+  }
+  auto slotOf = [&](Key key) {
+    const size_t j =
+        std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin();
+    return Slot{offsets_[j], dims.at(key)};
+  };
+
+  steps_.reserve(conditionals.size());
+  for (const auto& conditional : conditionals) {
+    Step step;
+    step.frontalDim = step.parentDim = 0;
+    for (Key key : conditional->frontals()) {
+      step.frontals.push_back(slotOf(key));
+      step.frontalDim += step.frontals.back().dim;
+    }
+    for (Key key : conditional->parents()) {
+      step.parents.push_back(slotOf(key));
+      step.parentDim += step.parents.back().dim;
+    }
+    step.R = conditional->R();
+    step.S = conditional->S();
+    step.d = conditional->d();
+    if (conditional->get_model())
+      step.sigmas = conditional->get_model()->sigmas();
+    if ((step.R.diagonal().array() == 0.0).any())
+      throw IndeterminantLinearSystemException(conditional->keys().front());
+    steps_.push_back(std::move(step));
+  }
+}
+
+/* ************************************************************************ */
+void GaussianBatchSampler::sampleBlock(size_t block, std::uint64_t seed,
+                                       Eigen::Ref<Matrix> samples) const {
+  std::seed_seq seq{static_cast<std::uint32_t>(seed),
+                    static_cast<std::uint32_t>(seed >> 32),
+                    static_cast<std::uint32_t>(block)};
+  std::mt19937_64 rng(seq);
+  std::normal_distribution<double> normal(0.0, 1.0);
+
+  const Eigen::Index n = samples.cols();
+  Matrix parents, rhs;
+  for (const Step& step : steps_) {
+    // Right-hand side d + sigma .* z for every sample.
+    rhs.resize(step.frontalDim, n);
+    for (Eigen::Index s = 0; s < n; ++s)
+      for (size_t i = 0; i < step.frontalDim; ++i) rhs(i, s) = normal(rng);
+    if (step.sigmas.size() > 0) rhs = step.sigmas.asDiagonal() * rhs;
+    rhs.colwise() += step.d;
+
+    // Subtract S times the already sampled parents.
+    if (step.parentDim > 0) {
+      parents.resize(step.parentDim, n);
+      size_t row = 0;
+      for (const Slot& slot : step.parents) {
+        parents.middleRows(row, slot.dim) =
+            samples.middleRows(slot.offset, slot.dim);
+        row += slot.dim;
+      }
+      rhs.noalias() -= step.S * parents;
+    }
+
+    // Back-substitute all samples at once.
+    step.R.triangularView<Eigen::Upper>().solveInPlace(rhs);
+
+    size_t row = 0;
+    for (const Slot& slot : step.frontals) {
+      samples.middleRows(slot.offset, slot.dim) = rhs.middleRows(row, slot.dim);
+      row += slot.dim;
+    }
+  }
+}
+
+/* ************************************************************************ */
+Matrix GaussianBatchSampler::sampleMatrix(size_t N, std::uint64_t seed) const {
+  gttic(GaussianBatchSampler_sampleMatrix);
+  Matrix samples(dim(), N);
+  const size_t nrBlocks = (N + kBlockSize - 1) / kBlockSize;
+  auto sampleBlocks = [&](size_t firstBlock, size_t lastBlock) {
+    for (size_t block = firstBlock; block < lastBlock; ++block) {
+      const size_t begin = block * kBlockSize;
+      const size_t end = std::min(N, begin + kBlockSize);
+      sampleBlock(block, seed, samples.middleCols(begin, end - begin));
+    }
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, nrBlocks),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      sampleBlocks(range.begin(), range.end());
+                    });
+#else
+  sampleBlocks(0, nrBlocks);
+#endif
+  return samples;
+}
+
+/* ************************************************************************ */
+vector<VectorValues> GaussianBatchSampler::sample(size_t N,
+                                                  std::uint64_t seed) const {
+  const Matrix samples = sampleMatrix(N, seed);
+  vector<VectorValues> result(N);
+  for (size_t s = 0; s < N; ++s)
+    for (size_t j = 0; j < keys_.size(); ++j)
+      result[s].emplace(keys_[j], samples.col(s).segment(
+                                      offsets_[j], offsets_[j + 1] - offsets_[j]));
+  return result;
+}
+
+}  // namespace gtsam
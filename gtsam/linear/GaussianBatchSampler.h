@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file GaussianBatchSampler.h
+ * @brief Draw many joint samples from a Gaussian Bayes net or Bayes tree.
+ * @date October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/linear/GaussianBayesNet.h>
+#include <gtsam/linear/GaussianBayesTree.h>
+#include <gtsam/linear/VectorValues.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * @brief Batch sampler for Gaussian Bayes nets and Bayes trees.
+ *
+ * A Gaussian conditional defines the density
+ * \f$ p(x|s) \propto \exp(-\frac{1}{2} \| (R x + S s - d) ./ \sigma \|^2) \f$,
+ * so a sample is obtained by back-substitution with a perturbed right-hand
+ * side, \f$ x = R^{-1} (d - S s + \sigma .* z) \f$ with \f$ z \sim N(0,I) \f$.
+ * This class performs that back-substitution for a whole block of samples at
+ * once, i.e., with matrix right-hand sides, on a dense sample matrix with one
+ * column per sample.
+ *
+ * As in DiscreteBatchSampler, samples are drawn in blocks of `kBlockSize`
+ * with a random number generator per block, in parallel with TBB, so that the
+ * result only depends on the seed.
+ */
+class GTSAM_EXPORT GaussianBatchSampler {
+ public:
+  /// Number of samples drawn with the same random number generator.
+  static const size_t kBlockSize = 256;
+
+  /// Construct from a Bayes net, sampled in topological order (parents first).
+  explicit GaussianBatchSampler(const GaussianBayesNet& bayesNet);
+
+  /// Construct from a Bayes tree, sampled from the roots down.
+  explicit GaussianBatchSampler(const GaussianBayesTree& bayesTree);
+
+  /// Keys of all variables, sorted, defining the row blocks of sampleMatrix.
+  const KeyVector& keys() const { return keys_; }
+
+  /// Row offset of the variable with index j in keys().
+  size_t offset(size_t j) const { return offsets_[j]; }
+
+  /// Total dimension of all variables.
+  size_t dim() const { return offsets_.back(); }
+
+  /// Draw N joint samples as a dim()*N matrix, one column per sample.
+  Matrix sampleMatrix(size_t N, std::uint64_t seed = 42u) const;
+
+  /// Draw N joint samples.
+  std::vector<VectorValues> sample(size_t N, std::uint64_t seed = 42u) const;
+
+ private:
+  /// Contiguous rows of a variable in the sample matrix.
+  struct Slot {
+    size_t offset, dim;
+  };
+
+  /// One back-substitution step, for one conditional.
+  struct Step {
+    std::vector<Slot> frontals, parents;
+    size_t frontalDim, parentDim;
+    Matrix R, S;
+    Vector d, sigmas;  ///< sigmas is empty for unit noise
+  };
+
+  KeyVector keys_;               ///< sorted keys of all variables
+  std::vector<size_t> offsets_;  ///< row offsets, with total dim at the end
+  std::vector<Step> steps_;      ///< in sampling order, parents first
+
+  /// Convert conditionals, given in sampling order.
+  void initialize(
+      const std::vector<GaussianConditional::shared_ptr>& conditionals);
+
+  /// Draw the samples in the given block of columns.
+  void sampleBlock(size_t block, std::uint64_t seed,
+                   Eigen::Ref<Matrix> samples) const;
+};
+
+}  // namespace gtsam
@@ -23,6 +23,7 @@
 #include <gtsam/linear/GaussianEliminationTree.h>
 #include <gtsam/linear/GaussianJunctionTree.h>
 #include <gtsam/linear/HessianFactor.h>
+#include <gtsam/inference/KeyIndexMap.h>
 #include <gtsam/inference/FactorGraph-inst.h>
 #include <gtsam/inference/EliminateableFactorGraph-inst.h>
 #include <gtsam/base/debug.h>
@@ -104,23 +105,23 @@ namespace gtsam {
                                                      size_t& nrows,
                                                      size_t& ncols) const {
     gttic_(GaussianFactorGraph_sparseJacobian);
-    // First find dimensions of each variable
-    typedef std::map<Key, size_t> KeySizeMap;
-    KeySizeMap dims;
+    // Number the variables in the ordering, and find their dimensions
+    const KeyIndexMap index(ordering);
+    std::vector<size_t> dims(index.size(), 0);
     for (const auto& factor : *this) {
       if (!static_cast<bool>(factor)) continue;
 
       for (auto it = factor->begin(); it != factor->end(); ++it) {
-        dims[*it] = factor->getDim(it);
+        dims[index.at(*it)] = factor->getDim(it);
       }
     }
 
     // Compute first scalar column of each variable
     ncols = 0;
-    KeySizeMap columnIndices = dims;
-    for (const auto key : ordering) {
-      columnIndices[key] = ncols;
-      ncols += dims[key];
+    std::vector<size_t> columnIndices(index.size());
+    for (size_t i = 0; i < index.size(); i++) {
+      columnIndices[i] = ncols;
+      ncols += dims[i];
     }
 
     // Iterate over all factors, adding sparse scalar entries
@@ -150,7 +151,7 @@ namespace gtsam {
       for (auto key = whitened.begin(); key < whitened.end(); ++key) {
         JacobianFactor::constABlock whitenedA = whitened.getA(key);
         // find first column index for this key
-        size_t column_start = columnIndices[*key];
+        size_t column_start = columnIndices[index.at(*key)];
         for (size_t i = 0; i < (size_t)whitenedA.rows(); i++)
           for (size_t j = 0; j < (size_t)whitenedA.cols(); j++) {
             double s = whitenedA(i, j);
@@ -407,6 +408,35 @@ namespace gtsam {
      f->multiplyHessianAdd(alpha, x, y);
   }
 
+  /* ************************************************************************* */
+  void GaussianFactorGraph::multiplyHessianAdd(double alpha, const double* x,
+      double* y, const KeyIndexMap& index,
+      const std::vector<size_t>& accumulatedDims) const {
+    for (const GaussianFactor::shared_ptr& f : *this) {
+      if (!f) continue;
+      if (auto jacobian = dynamic_cast<const JacobianFactor*>(f.get())) {
+        jacobian->multiplyHessianAdd(alpha, x, y, index, accumulatedDims);
+      } else if (auto hessian = dynamic_cast<const HessianFactor*>(f.get())) {
+        hessian->multiplyHessianAdd(alpha, x, y, index, accumulatedDims);
+      } else {
+        // Other factors only know about VectorValues
+        VectorValues xf, yf;
+        for (Key key : f->keys()) {
+          const size_t i = index.at(key);
+          const size_t d = accumulatedDims[i + 1] - accumulatedDims[i];
+          xf.insert(key, Eigen::Map<const Vector>(x + accumulatedDims[i], d));
+          yf.insert(key, Vector::Zero(d));
+        }
+        f->multiplyHessianAdd(alpha, xf, yf);
+        for (const auto& kv : yf) {
+          const size_t i = index.at(kv.first);
+          Eigen::Map<Vector>(y + accumulatedDims[i], kv.second.size()) +=
+              kv.second;
+        }
+      }
+    }
+  }
+
   /* ************************************************************************* */
   void GaussianFactorGraph::multiplyInPlace(const VectorValues& x, Errors& e) const {
     multiplyInPlace(x, e.begin());
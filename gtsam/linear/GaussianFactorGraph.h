@@ -377,6 +377,16 @@ namespace gtsam {
     void multiplyHessianAdd(double alpha, const VectorValues& x,
         VectorValues& y) const;
 
+    /**
+     * Raw memory access version of y += alpha*A'A*x: x and y are contiguous
+     * vectors in which the variables are numbered by index, and
+     * accumulatedDims has the offsets of the variables by index, followed by
+     * the total dimension.
+     */
+    void multiplyHessianAdd(double alpha, const double* x, double* y,
+        const KeyIndexMap& index,
+        const std::vector<size_t>& accumulatedDims) const;
+
     ///** In-place version e <- A*x that overwrites e. */
     void multiplyInPlace(const VectorValues& x, Errors& e) const;
 
@@ -22,6 +22,7 @@
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/JacobianFactor.h>
 #include <gtsam/linear/linearExceptions.h>
+#include <gtsam/inference/KeyIndexMap.h>
 #include <gtsam/base/cholesky.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/FastMap.h>
@@ -425,6 +426,37 @@ void HessianFactor::multiplyHessianAdd(double alpha, const VectorValues& x,
   }
 }
 
+/* ************************************************************************* */
+void HessianFactor::multiplyHessianAdd(double alpha, const double* x, double* y,
+    const KeyIndexMap& index, const std::vector<size_t>& accumulatedDims) const {
+  typedef Eigen::Map<Vector> VectorMap;
+  typedef Eigen::Map<const Vector> ConstVectorMap;
+
+  // Find the offsets of the variables once, as the blocks are visited in pairs
+  const size_t n = size();
+  FastVector<size_t> offsets(n), dims(n);
+  for (size_t j = 0; j < n; ++j) {
+    const size_t i = index.at(keys_[j]);
+    offsets[j] = accumulatedDims[i];
+    dims[j] = accumulatedDims[i + 1] - accumulatedDims[i];
+  }
+
+  // Loop over columns to access x only once per column
+  for (DenseIndex j = 0; j < (DenseIndex) n; ++j) {
+    const Vector xj = alpha * ConstVectorMap(x + offsets[j], dims[j]);
+    DenseIndex i = 0;
+    for (; i < j; ++i)
+      VectorMap(y + offsets[i], dims[i]) += info_.aboveDiagonalBlock(i, j) * xj;
+
+    // blocks on the diagonal are only half
+    VectorMap(y + offsets[i], dims[i]) += info_.diagonalBlock(j) * xj;
+    // for below diagonal, we take transpose block from upper triangular part
+    for (i = j + 1; i < (DenseIndex) n; ++i)
+      VectorMap(y + offsets[i], dims[i]) +=
+          info_.aboveDiagonalBlock(j, i).transpose() * xj;
+  }
+}
+
 /* ************************************************************************* */
 VectorValues HessianFactor::gradientAtZero() const {
   VectorValues g;
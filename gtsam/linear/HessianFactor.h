@@ -29,6 +29,7 @@ namespace gtsam {
 
   // Forward declarations
   class Ordering;
+  class KeyIndexMap;
   class JacobianFactor;
   class HessianFactor;
   class GaussianConditional;
@@ -330,6 +331,14 @@ namespace gtsam {
     /** y += alpha * A'*A*x */
     void multiplyHessianAdd(double alpha, const VectorValues& x, VectorValues& y) const override;
 
+    /**
+     * Raw memory access version of multiplyHessianAdd y += alpha * A'*A*x: the
+     * variables are numbered by index, and accumulatedDims has the offsets of
+     * the variables by index, followed by the total dimension.
+     */
+    void multiplyHessianAdd(double alpha, const double* x, double* y,
+        const KeyIndexMap& index, const std::vector<size_t>& accumulatedDims) const;
+
     /// eta for Hessian
     VectorValues gradientAtZero() const override;
 
@@ -24,6 +24,7 @@
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/VectorValues.h>
 #include <gtsam/inference/VariableSlots.h>
+#include <gtsam/inference/KeyIndexMap.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/timing.h>
@@ -697,6 +698,41 @@ void JacobianFactor::multiplyHessianAdd(double alpha, const double* x, double* y
   }
 }
 
+/* ************************************************************************* */
+void JacobianFactor::multiplyHessianAdd(double alpha, const double* x, double* y,
+    const KeyIndexMap& index, const std::vector<size_t>& accumulatedDims) const {
+
+  /// Use Eigen magic to access raw memory
+  typedef Eigen::Map<Vector> VectorMap;
+  typedef Eigen::Map<const Vector> ConstVectorMap;
+
+  if (empty())
+    return;
+  Vector Ax = Vector::Zero(Ab_.rows());
+
+  /// Ax = A0 x0 + A1 x1 + A2 x2, with xj at the offset of its index
+  for (size_t pos = 0; pos < size(); ++pos) {
+    const size_t i = index.at(keys_[pos]);
+    Ax += Ab_(pos) * ConstVectorMap(x + accumulatedDims[i],
+        accumulatedDims[i + 1] - accumulatedDims[i]);
+  }
+  /// Deal with noise properly, need to Double* whiten as we are dividing by variance
+  if (model_) {
+    model_->whitenInPlace(Ax);
+    model_->whitenInPlace(Ax);
+  }
+
+  /// multiply with alpha
+  Ax *= alpha;
+
+  /// Again iterate over all A matrices and insert Ai^T into y
+  for (size_t pos = 0; pos < size(); ++pos) {
+    const size_t i = index.at(keys_[pos]);
+    VectorMap(y + accumulatedDims[i],
+        accumulatedDims[i + 1] - accumulatedDims[i]) += Ab_(pos).transpose() * Ax;
+  }
+}
+
 /* ************************************************************************* */
 VectorValues JacobianFactor::gradientAtZero() const {
   VectorValues g;
@@ -38,6 +38,7 @@ namespace gtsam {
   class HessianFactor;
   class VectorValues;
   class Ordering;
+  class KeyIndexMap;
   class JacobianFactor;
 
   /**
@@ -336,6 +337,16 @@ namespace gtsam {
     void multiplyHessianAdd(double alpha, const double* x, double* y,
         const std::vector<size_t>& accumulatedDims) const;
 
+    /**
+     * Raw memory access version of multiplyHessianAdd y += alpha * A'*A*x,
+     * for any keys: the variables are numbered by index, and accumulatedDims
+     * has the offsets of the variables by index, followed by the total
+     * dimension, as above.
+     */
+    void multiplyHessianAdd(double alpha, const double* x, double* y,
+        const KeyIndexMap& index,
+        const std::vector<size_t>& accumulatedDims) const;
+
     /// A'*b for Jacobian
     VectorValues gradientAtZero() const override;
 
@@ -408,6 +419,7 @@ namespace gtsam {
 
     // be very selective on who can access these private methods:
     template<typename T> friend class ExpressionFactor;
+    template<typename T> friend class ExpressionFactorBatch;
 
     /** Serialization function */
     friend class boost::serialization::access;
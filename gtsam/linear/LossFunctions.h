@@ -70,6 +70,9 @@ class GTSAM_EXPORT Base {
   Base(const ReweightScheme reweight = Block) : reweight_(reweight) {}
   virtual ~Base() {}
 
+  /// Whether rows are weighted independently, or all with the norm
+  ReweightScheme reweightScheme() const { return reweight_; }
+
   /*
    * This method is responsible for returning the total penalty for a given
    * amount of error. For example, this method is responsible for implementing
@@ -31,6 +31,9 @@
 
 namespace gtsam {
 
+  // Forward declaration, for the friend of noiseModel::Gaussian
+  class NoiseModelFactor;
+
   /// All noise models live in the noiseModel namespace
   namespace noiseModel {
 
@@ -169,7 +172,9 @@ namespace gtsam {
     private:
 
       /**
-       * Return R itself, but note that Whiten(H) is cheaper than R*H
+       * Return R itself, without copying, but note that Whiten(H) is cheaper
+       * than R*H. Throws for derived classes like Diagonal, which do not
+       * store R.
        */
       const Matrix& thisR() const {
         // should never happen
@@ -177,6 +182,8 @@ namespace gtsam {
         return *sqrt_information_;
       }
 
+      /// Whitens Jacobians with thisR(), see fillFixedSizeJacobianFactor
+      friend class gtsam::NoiseModelFactor;
 
     public:
 
@@ -76,7 +76,11 @@ GaussianFactorGraphSystem::GaussianFactorGraphSystem(
     const GaussianFactorGraph &gfg, const Preconditioner &preconditioner,
     const KeyInfo &keyInfo, const std::map<Key, Vector> &lambda) :
     gfg_(gfg), preconditioner_(preconditioner), keyInfo_(keyInfo), lambda_(
-        lambda) {
+        lambda), index_(keyInfo.ordering()) {
+  accumulatedDims_.reserve(index_.size() + 1);
+  accumulatedDims_.push_back(0);
+  for (Key key : index_.keys())
+    accumulatedDims_.push_back(accumulatedDims_.back() + keyInfo.at(key).dim);
 }
 
 /*****************************************************************************/
@@ -96,17 +100,9 @@ void GaussianFactorGraphSystem::residual(const Vector &x, Vector &r) const {
 void GaussianFactorGraphSystem::multiply(const Vector &x, Vector& AtAx) const {
   /* implement A^T*(A*x), assume x and AtAx are pre-allocated */
 
-  // Build a VectorValues for Vector x
-  VectorValues vvX = buildVectorValues(x, keyInfo_);
-
-  // VectorValues form of A'Ax for multiplyHessianAdd
-  VectorValues vvAtAx = keyInfo_.x0(); // crucial for performance
-
-  // vvAtAx += 1.0 * A'Ax for each factor
-  gfg_.multiplyHessianAdd(1.0, vvX, vvAtAx);
-
-  // Make the result as Vector form
-  AtAx = vvAtAx.vector(keyInfo_.ordering());
+  // AtAx += 1.0 * A'Ax for each factor, directly on the contiguous vectors
+  AtAx = Vector::Zero(accumulatedDims_.back());
+  gfg_.multiplyHessianAdd(1.0, x.data(), AtAx.data(), index_, accumulatedDims_);
 }
 
 /*****************************************************************************/
@@ -20,7 +20,9 @@
 #pragma once
 
 #include <gtsam/linear/ConjugateGradientSolver.h>
+#include <gtsam/inference/KeyIndexMap.h>
 #include <string>
+#include <vector>
 
 namespace gtsam {
 
@@ -98,6 +100,10 @@ public:
   const KeyInfo &keyInfo_;
   const std::map<Key, Vector> &lambda_;
 
+  /// Dense numbering of the variables in the ordering, and their offsets
+  const KeyIndexMap index_;
+  std::vector<size_t> accumulatedDims_;
+
   void residual(const Vector &x, Vector &r) const;
   void multiply(const Vector &x, Vector& y) const;
   void leftPrecondition(const Vector &x, Vector &y) const;
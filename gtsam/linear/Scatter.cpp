@@ -18,6 +18,7 @@
 
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/Scatter.h>
+#include <gtsam/inference/KeyIndexMap.h>
 #include <gtsam/inference/Ordering.h>
 
 #include <algorithm>
@@ -36,6 +37,14 @@ string SlotEntry::toString() const {
 Scatter::Scatter(const GaussianFactorGraph& gfg) : Scatter(gfg, Ordering()) {}
 
 /* ************************************************************************* */
+namespace {
+// Scatters are mostly built for the few keys of a clique, which a linear scan
+// of the slots finds faster than a hash map that has to be allocated first.
+// Above this many keys the scan is quadratic, and slots are found in a
+// KeyIndexMap instead.
+const size_t kMaxLinearScan = 32;
+}  // namespace
+
 Scatter::Scatter(const GaussianFactorGraph& gfg,
     const Ordering& ordering) {
   gttic(Scatter_Constructor);
@@ -44,6 +53,8 @@ Scatter::Scatter(const GaussianFactorGraph& gfg,
   for (Key key : ordering) {
     add(key, 0);
   }
+  KeyIndexMap slots;
+  if (size() > kMaxLinearScan) slots = KeyIndexMap(ordering);
 
   // Now, find dimensions of variables and/or extend
   for (const auto& factor : gfg) {
@@ -58,9 +69,23 @@ Scatter::Scatter(const GaussianFactorGraph& gfg,
     for (GaussianFactor::const_iterator variable = factor->begin();
          variable != factor->end(); ++variable) {
       const Key key = *variable;
-      iterator it = find(key); // theoretically expensive, yet cache friendly
-      if (it!=end())
-        it->dimension = factor->getDim(variable);
+      size_t slot;
+      if (slots.empty()) {
+        slot = 0;
+        while (slot < size() && (*this)[slot].key != key) ++slot;
+        if (slot == size() && size() == kMaxLinearScan) {
+          // Too many keys for a linear scan, switch to the map
+          KeyVector keys;
+          keys.reserve(2 * size());
+          for (const SlotEntry& entry : *this) keys.push_back(entry.key);
+          slots = KeyIndexMap(keys);
+          slots.insert(key);
+        }
+      } else {
+        slot = slots.insert(key);
+      }
+      if (slot < size())
+        (*this)[slot].dimension = factor->getDim(variable);
       else
         add(key, factor->getDim(variable));
     }
@@ -77,17 +102,6 @@ void Scatter::add(Key key, size_t dim) {
   emplace_back(SlotEntry(key, dim));
 }
 
-/* ************************************************************************* */
-FastVector<SlotEntry>::iterator Scatter::find(Key key) {
-  iterator it = begin();
-  while(it != end()) {
-    if (it->key == key)
-      return it;
-    ++it;
-  }
-  return it; // end()
-}
-
 /* ************************************************************************* */
 
 } // gtsam
@@ -59,10 +59,6 @@ class Scatter : public FastVector<SlotEntry> {
 
   /// Add a key/dim pair
    GTSAM_EXPORT void add(Key key, size_t dim);
-
- private:
-  /// Find the SlotEntry with the right key (linear time worst case)
-  iterator find(Key key);
 };
 
 }  // \ namespace gtsam
@@ -20,6 +20,7 @@
 #include <gtsam/base/Vector.h>
 #include <gtsam/base/Matrix.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/ContiguousVectorValues.h>
 #include <gtsam/linear/IterativeSolver.h>
 
 #include <iostream>
@@ -61,16 +62,95 @@ namespace gtsam {
   }
 
   /* ************************************************************************* */
+  namespace {
+  /**
+   * A GaussianFactorGraph as a linear system on ContiguousVectorValues, with
+   * the same operations as GaussianFactorGraph provides for VectorValues. The
+   * factors are converted to JacobianFactors once, up front.
+   */
+  class ContiguousSystem {
+    std::vector<JacobianFactor::shared_ptr> factors_;
+
+    // Unwhitened A*x for one factor
+    static Vector multiply(const JacobianFactor& Ai,
+                           const ContiguousVectorValues& x) {
+      Vector Ax = Vector::Zero(Ai.rows());
+      for (auto it = Ai.begin(); it != Ai.end(); ++it)
+        Ax.noalias() += Ai.getA(it) * x.at(*it);
+      return Ax;
+    }
+
+    // x += alpha*A'*e for one factor, with whitening as in JacobianFactor
+    static void transposeMultiplyAdd(const JacobianFactor& Ai, double alpha,
+                                     const Vector& e,
+                                     ContiguousVectorValues& x) {
+      Vector E = alpha * e;
+      if (Ai.get_model()) Ai.get_model()->whitenInPlace(E);
+      for (auto it = Ai.begin(); it != Ai.end(); ++it)
+        x.at(*it).noalias() += Ai.getA(it).transpose() * E;
+    }
+
+   public:
+    explicit ContiguousSystem(const GaussianFactorGraph& fg) {
+      factors_.reserve(fg.size());
+      for (const GaussianFactor::shared_ptr& factor : fg) {
+        auto jacobian = boost::dynamic_pointer_cast<JacobianFactor>(factor);
+        factors_.push_back(jacobian ? jacobian
+                                    : boost::make_shared<JacobianFactor>(*factor));
+      }
+    }
+
+    ContiguousVectorValues gradient(const ContiguousVectorValues& x) const {
+      ContiguousVectorValues g = ContiguousVectorValues::Zero(x);
+      for (const JacobianFactor::shared_ptr& Ai : factors_) {
+        Vector e = multiply(*Ai, x) - Ai->getb();
+        if (Ai->get_model()) Ai->get_model()->whitenInPlace(e);
+        transposeMultiplyAdd(*Ai, 1.0, e, g);
+      }
+      return g;
+    }
+
+    Errors operator*(const ContiguousVectorValues& x) const {
+      Errors e;
+      for (const JacobianFactor::shared_ptr& Ai : factors_) {
+        e.push_back(multiply(*Ai, x));
+        if (Ai->get_model()) Ai->get_model()->whitenInPlace(e.back());
+      }
+      return e;
+    }
+
+    void multiplyInPlace(const ContiguousVectorValues& x, Errors& e) const {
+      Errors::iterator ei = e.begin();
+      for (const JacobianFactor::shared_ptr& Ai : factors_) {
+        *ei = multiply(*Ai, x);
+        if (Ai->get_model()) Ai->get_model()->whitenInPlace(*ei);
+        ei++;
+      }
+    }
+
+    void transposeMultiplyAdd(double alpha, const Errors& e,
+                              ContiguousVectorValues& x) const {
+      Errors::const_iterator ei = e.begin();
+      for (const JacobianFactor::shared_ptr& Ai : factors_)
+        transposeMultiplyAdd(*Ai, alpha, *(ei++), x);
+    }
+  };
+  }  // namespace
+
+  // The iterations run on contiguous storage, such that the vector operations
+  // in CGState are single Eigen operations; we only convert x in and out.
   VectorValues steepestDescent(const GaussianFactorGraph& fg,
       const VectorValues& x, const ConjugateGradientParameters & parameters) {
-    return conjugateGradients<GaussianFactorGraph, VectorValues, Errors>(
-        fg, x, parameters, true);
+    const ContiguousSystem system(fg);
+    return conjugateGradients<ContiguousSystem, ContiguousVectorValues, Errors>(
+        system, ContiguousVectorValues(x), parameters, true).vectorValues();
   }
 
   VectorValues conjugateGradientDescent(const GaussianFactorGraph& fg,
       const VectorValues& x, const ConjugateGradientParameters & parameters) {
-    return conjugateGradients<GaussianFactorGraph, VectorValues, Errors>(
-        fg, x, parameters);
+    const ContiguousSystem system(fg);
+    return conjugateGradients<ContiguousSystem, ContiguousVectorValues, Errors>(
+        system, ContiguousVectorValues(x), parameters).vectorValues();
   }
 
 /* ************************************************************************* */
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testContiguousVectorValues.cpp
+ * @brief   Unit tests for ContiguousVectorValues
+ * @date    October, 2026
+ */
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/linear/ContiguousVectorValues.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <stdexcept>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+static VectorValues createVectorValues() {
+  VectorValues x;
+  x.insert(0, Vector1(1));
+  x.insert(1, Vector2(2, 3));
+  x.insert(5, Vector2(4, 5));
+  x.insert(2, Vector2(6, 7));
+  return x;
+}
+
+/* ************************************************************************* */
+TEST(ContiguousVectorValues, basics) {
+  const VectorValues x = createVectorValues();
+
+  // In key order
+  ContiguousVectorValues actual(x);
+  EXPECT_LONGS_EQUAL(4, actual.size());
+  EXPECT_LONGS_EQUAL(7, actual.dim());
+  EXPECT_LONGS_EQUAL(2, actual.dim(5));
+  EXPECT(actual.exists(2));
+  EXPECT(!actual.exists(3));
+  EXPECT(assert_equal(x.vector(KeyVector{0, 1, 2, 5}),
+                      Vector(actual.vector())));
+  EXPECT(assert_equal(Vector(Vector2(4, 5)), Vector(actual.at(5))));
+  CHECK_EXCEPTION(actual.at(3), std::out_of_range);
+
+  // Access does not copy
+  actual.at(1) << 8, 9;
+  EXPECT_DOUBLES_EQUAL(8, actual.vector()(1), 1e-9);
+  actual.vector()(6) = 10;
+  EXPECT_DOUBLES_EQUAL(10, actual.at(5)(1), 1e-9);
+
+  // Back to VectorValues
+  VectorValues expected = x;
+  expected[1] << 8, 9;
+  expected[5] << 4, 10;
+  EXPECT(assert_equal(expected, actual.vectorValues()));
+
+  // In a given order
+  const KeyVector keys{5, 0, 2, 1};
+  const ContiguousVectorValues ordered(x, keys);
+  EXPECT(keys == ordered.keys());
+  EXPECT(assert_equal(x.vector(keys), ordered.vector()));
+  EXPECT(!ordered.hasSameStructure(actual));
+  CHECK_EXCEPTION(ContiguousVectorValues(x, KeyVector{0, 3}),
+                  std::out_of_range);
+}
+
+/* ************************************************************************* */
+TEST(ContiguousVectorValues, LinearAlgebra) {
+  const VectorValues x = createVectorValues();
+  const VectorValues y = 2 * x;
+  const ContiguousVectorValues cx(x), cy(y);
+
+  EXPECT(cx.hasSameStructure(ContiguousVectorValues::Zero(cx)));
+  EXPECT(cx.hasSameStructure(ContiguousVectorValues(y)));
+  EXPECT_DOUBLES_EQUAL(x.dot(y), cx.dot(cy), 1e-9);
+  EXPECT_DOUBLES_EQUAL(x.norm(), cx.norm(), 1e-9);
+  EXPECT_DOUBLES_EQUAL(x.squaredNorm(), cx.squaredNorm(), 1e-9);
+  EXPECT(assert_equal(x + y, (cx + cy).vectorValues()));
+  EXPECT(assert_equal(x - y, (cx - cy).vectorValues()));
+  EXPECT(assert_equal(3 * x, (3 * cx).vectorValues()));
+
+  ContiguousVectorValues actual = cx;
+  actual += cy;
+  EXPECT(assert_equal(ContiguousVectorValues(x + y), actual));
+  actual -= cy;
+  EXPECT(assert_equal(cx, actual));
+  actual *= 2;
+  EXPECT(assert_equal(cy, actual));
+  actual.axpy(-0.5, cy);
+  EXPECT(assert_equal(cx, actual));
+  actual.setZero();
+  EXPECT(assert_equal(ContiguousVectorValues::Zero(cx), actual));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testGaussianBatchSampler.cpp
+ * @brief   Unit tests for GaussianBatchSampler
+ * @date    October, 2026
+ */
+
+#include <gtsam/base/Testable.h>
+#include <gtsam/linear/GaussianBatchSampler.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+static const Key _x_ = 11, _y_ = 22;
+
+namespace {
+// x + y = 9 with sigma 2, y = 5 with sigma 3, so that y ~ N(5,9) and
+// x = 9 - y + 2z ~ N(4, 13), with cov(x,y) = -9.
+GaussianBayesNet createBayesNet() {
+  GaussianBayesNet bayesNet;
+  bayesNet.emplace_shared<GaussianConditional>(
+      _x_, Vector1::Constant(9), I_1x1, _y_, I_1x1,
+      noiseModel::Isotropic::Sigma(1, 2.0));
+  bayesNet.emplace_shared<GaussianConditional>(
+      _y_, Vector1::Constant(5), I_1x1, noiseModel::Isotropic::Sigma(1, 3.0));
+  return bayesNet;
+}
+
+// Check sample mean and covariance against the analytic values above.
+bool checkMoments(const Matrix& samples) {
+  const Vector mean = samples.rowwise().mean();
+  const Matrix centered = samples.colwise() - mean;
+  const Matrix covariance =
+      centered * centered.transpose() / double(samples.cols() - 1);
+  return assert_equal(Vector2(4, 5), mean, 0.1) &&
+         assert_equal((Matrix2() << 13, -9, -9, 9).finished(), covariance, 0.5);
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(GaussianBatchSampler, BayesNet) {
+  GaussianBatchSampler sampler(createBayesNet());
+  EXPECT_LONGS_EQUAL(2, sampler.dim());
+  EXPECT_LONGS_EQUAL(1, sampler.offset(1));
+
+  const Matrix samples = sampler.sampleMatrix(20000);
+  EXPECT_LONGS_EQUAL(20000, samples.cols());
+  EXPECT(checkMoments(samples));
+}
+
+/* ************************************************************************* */
+TEST(GaussianBatchSampler, BayesTree) {
+  GaussianFactorGraph graph(createBayesNet());
+  GaussianBatchSampler sampler(*graph.eliminateMultifrontal());
+  EXPECT(checkMoments(sampler.sampleMatrix(20000, 7)));
+}
+
+/* ************************************************************************* */
+TEST(GaussianBatchSampler, Reproducible) {
+  GaussianBatchSampler sampler(createBayesNet());
+  const size_t N = 2 * GaussianBatchSampler::kBlockSize + 3;
+  const Matrix samples1 = sampler.sampleMatrix(N, 123);
+  EXPECT(assert_equal(samples1, sampler.sampleMatrix(N, 123)));
+  EXPECT(!equal_with_abs_tol(samples1, sampler.sampleMatrix(N, 321)));
+
+  const vector<VectorValues> values = sampler.sample(N, 123);
+  EXPECT_LONGS_EQUAL(N, values.size());
+  EXPECT(assert_equal(Vector(samples1.col(N - 1)),
+                      values.back().vector(KeyVector{_x_, _y_})));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -23,6 +23,7 @@
 #include <gtsam/linear/GaussianBayesNet.h>
 #include <gtsam/inference/VariableSlots.h>
 #include <gtsam/inference/VariableIndex.h>
+#include <gtsam/inference/KeyIndexMap.h>
 #include <gtsam/base/debug.h>
 #include <gtsam/base/VerticalBlockMatrix.h>
 
@@ -342,6 +343,27 @@ TEST(GaussianFactorGraph, multiplyHessianAdd2) {
   EXPECT(assert_equal(2 * expected, actual));
 }
 
+/* ************************************************************************* */
+TEST(GaussianFactorGraph, multiplyHessianAddRaw) {
+  GaussianFactorGraph gfg = createGaussianFactorGraphWithHessianFactor();
+
+  // Number the variables in a different order than the keys
+  const KeyIndexMap index(KeyVector{2, 0, 1});
+  const vector<size_t> accumulatedDims{0, 2, 4, 6};
+  Vector x(6);
+  x << 5, 6, 1, 2, 3, 4;
+  Vector expected(6);
+  expected << 2950, 3450, -450, -450, 300, 400;
+
+  Vector actual = Vector::Zero(6);
+  gfg.multiplyHessianAdd(1.0, x.data(), actual.data(), index, accumulatedDims);
+  EXPECT(assert_equal(expected, actual));
+
+  // now, do it with non-zero y
+  gfg.multiplyHessianAdd(2.0, x.data(), actual.data(), index, accumulatedDims);
+  EXPECT(assert_equal(Vector(3 * expected), actual));
+}
+
 /* ************************************************************************* */
 TEST(GaussianFactorGraph, matricesMixed) {
   GaussianFactorGraph gfg = createGaussianFactorGraphWithHessianFactor();
@@ -18,6 +18,7 @@
 #include <gtsam/linear/Scatter.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/inference/Symbol.h>
+#include <gtsam/inference/Ordering.h>
 #include <CppUnitLite/TestHarness.h>
 
 using namespace std;
@@ -57,6 +58,30 @@ TEST(HessianFactor, CombineAndEliminate) {
   EXPECT_LONGS_EQUAL(n, scatter.at(1).dimension);
 }
 
+/* ************************************************************************* */
+TEST(Scatter, ManyKeys) {
+  // Enough keys for the slots to be found in a map rather than by a scan
+  const size_t n = 100;
+  auto dim = [](size_t i) { return 2 + i % 2; };
+  GaussianFactorGraph gfg;
+  for (size_t i = n - 1; i > 0; i--)
+    gfg.add(X(i), Matrix::Identity(3, dim(i)), X(i - 1),
+            Matrix::Identity(3, dim(i - 1)), Vector3::Zero());
+
+  for (size_t nrOrdered : {0, 2, 50}) {
+    Ordering ordering;
+    for (size_t i = 0; i < nrOrdered; i++) ordering.push_back(X(n - 1 - i));
+    Scatter scatter(gfg, ordering);
+    EXPECT_LONGS_EQUAL(n, scatter.size());
+    for (size_t i = 0; i < nrOrdered; i++)
+      EXPECT(assert_equal(X(n - 1 - i), scatter.at(i).key));
+    for (size_t i = nrOrdered; i < n; i++)
+      EXPECT(assert_equal(X(i - nrOrdered), scatter.at(i).key));
+    for (const SlotEntry& entry : scatter)
+      EXPECT_LONGS_EQUAL(dim(Symbol(entry.key).index()), entry.dimension);
+  }
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
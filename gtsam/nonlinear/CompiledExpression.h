@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file CompiledExpression.h
+ * @date October, 2026
+ * @brief Expressions flattened into an instruction tape
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/Expression.h>
+#include <gtsam/nonlinear/internal/ExpressionTape.h>
+
+#include <mutex>
+
+namespace gtsam {
+
+/**
+ * An Expression compiled into a flat instruction tape.
+ *
+ * Evaluating an Expression walks the expression tree with virtual calls, and
+ * builds an execution trace of Records in stack memory on every call. A
+ * CompiledExpression does the tree walk once: every node becomes an
+ * instruction with pre-allocated storage for its value and fixed-size
+ * Jacobians, leaves know their Jacobian block in advance, shared
+ * sub-expressions are evaluated once, and constant sub-expressions are folded.
+ * Evaluation then replays the tape forward, and reverse AD replays it backward.
+ *
+ * The tape holds the buffers, so it can only be replayed by one thread at a
+ * time: evaluate() serializes callers, and tryEvaluate() returns none when
+ * the tape is busy, so callers can fall back to the Expression itself.
+ */
+template<typename T>
+class CompiledExpression {
+  static const int Dim = traits<T>::dimension;
+
+  Expression<T> expression_;  ///< keeps the nodes alive
+  FastVector<int> dims_;
+  internal::ExpressionTape tape_;
+  internal::TapeNode<T>* root_;
+  std::mutex mutex_;
+
+ public:
+  typedef boost::shared_ptr<CompiledExpression> shared_ptr;
+
+  /**
+   * Compile, with Jacobian blocks in the order of the given keys, which
+   * should contain all keys of the expression.
+   */
+  CompiledExpression(const Expression<T>& expression, const KeyVector& keys) :
+      expression_(expression), tape_(keys, Dim) {
+    std::map<Key, int> dims;
+    expression.dims(dims);
+    for (Key key : keys)
+      dims_.push_back(dims.at(key));
+    root_ = tape_.compile(*expression.root());
+  }
+
+  /// Compile, with Jacobian blocks in sorted key order
+  explicit CompiledExpression(const Expression<T>& expression) :
+      CompiledExpression(expression, KeysOf(expression)) {
+  }
+
+  /// Keys, in the order of the Jacobian blocks
+  const KeyVector& keys() const { return tape_.keys(); }
+
+  /// Dimensions of the Jacobian blocks
+  const FastVector<int>& dims() const { return dims_; }
+
+  /// Number of instructions replayed per evaluation
+  size_t size() const { return tape_.size(); }
+
+  /// Whether rebind can be used, false if the tape contains fallback nodes
+  bool rebindable() const { return tape_.rebindable(); }
+
+  /**
+   * Evaluate the same expression for other variables from now on: keys[i]
+   * takes the place of keys()[i]. The variables should have the same types
+   * and dimensions as the ones they replace.
+   */
+  void rebind(const KeyVector& keys) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tape_.rebind(keys);
+  }
+
+  /// Return value only
+  T value(const Values& values) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tape_.forward(values);
+    return root_->value();
+  }
+
+  /**
+   * Return value, and *add* the Jacobians into the first keys().size() blocks
+   * of Ab, which should have Dim rows.
+   */
+  T evaluate(const Values& values, VerticalBlockMatrix& Ab) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tape_.run(values, root_, Ab);
+    return root_->value();
+  }
+
+  /// As evaluate, but returns none and does nothing if the tape is busy
+  boost::optional<T> tryEvaluate(const Values& values, VerticalBlockMatrix& Ab) {
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) return boost::none;
+    tape_.run(values, root_, Ab);
+    return root_->value();
+  }
+
+  /// Return value and Jacobians, as Expression::value
+  T value(const Values& values, std::vector<Matrix>& H) {
+    VerticalBlockMatrix Ab(dims_, Dim);
+    Ab.matrix().setZero();
+    const T result = evaluate(values, Ab);
+    H.resize(dims_.size());
+    for (size_t i = 0; i < dims_.size(); i++)
+      H[i] = Ab(i);
+    return result;
+  }
+
+ private:
+  static KeyVector KeysOf(const Expression<T>& expression) {
+    const std::set<Key> keys = expression.keys();
+    return KeyVector(keys.begin(), keys.end());
+  }
+};
+
+} // namespace gtsam
@@ -84,7 +84,7 @@ double DoglegOptimizer::getDelta() const {
 GaussianFactorGraph::shared_ptr DoglegOptimizer::iterate(void) {
 
   // Linearize graph
-  GaussianFactorGraph::shared_ptr linear = graph_.linearize(state_->values);
+  GaussianFactorGraph::shared_ptr linear = linearizeInPlace();
 
   // Pull out parameters we'll use
   const bool dlVerbose = (params_.verbosityDL > DoglegParams::SILENT);
@@ -22,6 +22,7 @@
 #include <array>
 #include <gtsam/config.h>
 #include <gtsam/base/Testable.h>
+#include <gtsam/nonlinear/CompiledExpression.h>
 #include <gtsam/nonlinear/Expression.h>
 #include <gtsam/nonlinear/NonlinearFactor.h>
 #include <numeric>
@@ -52,6 +53,7 @@ protected:
   T measured_;  ///< the measurement to be compared with the expression
   Expression<T> expression_;  ///< the expression that is AD enabled
   FastVector<int> dims_;      ///< dimensions of the Jacobian matrices
+  boost::shared_ptr<CompiledExpression<T> > compiled_;  ///< optional tape
 
 
  public:
@@ -76,6 +78,19 @@ protected:
   /** return the measurement */
   const T& measured() const { return measured_; }
 
+  /**
+   * Compile the expression into an instruction tape, see CompiledExpression,
+   * which linearize then replays instead of walking the expression tree.
+   * Copies of this factor share the tape; when it is in use by another
+   * thread, linearize falls back to the expression tree.
+   */
+  void compile() {
+    compiled_ = boost::make_shared<CompiledExpression<T> >(expression_, keys_);
+  }
+
+  /// Whether linearize uses a compiled tape
+  bool isCompiled() const { return static_cast<bool>(compiled_); }
+
   /// print relies on Testable traits being defined for T
   void print(const std::string& s = "",
              const KeyFormatter& keyFormatter = DefaultKeyFormatter) const override {
@@ -133,7 +148,10 @@ protected:
     Ab.matrix().setZero();
 
     // Get value and Jacobians, writing directly into JacobianFactor
-    T value = expression_.valueAndJacobianMap(x, jacobianMap); // <<< Reverse AD happens here !
+    boost::optional<T> compiledValue;
+    if (compiled_) compiledValue = compiled_->tryEvaluate(x, Ab);
+    T value = compiledValue ? *compiledValue
+                            : expression_.valueAndJacobianMap(x, jacobianMap); // <<< Reverse AD happens here !
 
     // Evaluate error and set RHS vector b
     Ab(size()).col(0) = traits<T>::Local(value, measured_);
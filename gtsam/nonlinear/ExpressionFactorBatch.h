@@ -0,0 +1,217 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file ExpressionFactorBatch.h
+ * @date October, 2026
+ * @brief Many ExpressionFactors with the same expression, evaluated in bulk
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/CompiledExpression.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/JacobianFactor.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * A batch of ExpressionFactors that share one expression and noise model, and
+ * differ only in their keys and measurement, as the projection factors in
+ * bundle adjustment.
+ *
+ * The expression is given once, in terms of placeholder keys, and every
+ * factor in the batch substitutes its own keys for the placeholders, in the
+ * sorted order of the placeholders. The expression is compiled into a
+ * CompiledExpression per chunk of factors, and the tape is rebound and
+ * replayed for every factor in the chunk, so the expression tree is never
+ * walked during evaluation. Keys and measurements are stored contiguously,
+ * chunks are processed in parallel when TBB is enabled, and the errors of all
+ * factors are whitened with a single matrix operation.
+ *
+ * linearize() produces the same JacobianFactors as linearizing the equivalent
+ * ExpressionFactors one by one, except that the keys of every JacobianFactor
+ * are in the order given to add(), rather than sorted.
+ */
+template <typename T>
+class ExpressionFactorBatch {
+  static const int Dim = traits<T>::dimension;
+  static_assert(Dim != Eigen::Dynamic,
+                "ExpressionFactorBatch needs a fixed-size measurement type");
+
+  SharedNoiseModel noiseModel_;
+  Expression<T> expression_;  ///< in terms of the placeholder keys
+  KeyVector placeholders_;    ///< sorted keys of expression_
+  FastVector<int> dims_;      ///< dimensions of the placeholders
+  KeyVector keys_;            ///< nrKeys() keys for every factor, contiguous
+  std::vector<T, Eigen::aligned_allocator<T> > measured_;
+
+ public:
+  /// Number of factors evaluated with one tape, at least half as many per task
+  static const size_t kChunkSize = 256;
+
+  /**
+   * Create an empty batch.
+   * @param noiseModel shared by all factors
+   * @param expression in terms of placeholder keys
+   */
+  ExpressionFactorBatch(const SharedNoiseModel& noiseModel,
+                        const Expression<T>& expression)
+      : noiseModel_(noiseModel), expression_(expression) {
+    if (!noiseModel_)
+      throw std::invalid_argument("ExpressionFactorBatch: no NoiseModel.");
+    if (noiseModel_->dim() != Dim)
+      throw std::invalid_argument(
+          "ExpressionFactorBatch: NoiseModel of incorrect dimension.");
+    std::map<Key, int> dims;
+    expression_.dims(dims);
+    for (const auto& key_dim : dims) {
+      placeholders_.push_back(key_dim.first);
+      dims_.push_back(key_dim.second);
+    }
+    if (!CompiledExpression<T>(expression_, placeholders_).rebindable())
+      throw std::invalid_argument(
+          "ExpressionFactorBatch: expression contains nodes that cannot be "
+          "compiled.");
+  }
+
+  /**
+   * Add a factor: keys[i] takes the place of the i^th placeholder, in sorted
+   * order, and should refer to a value of the same type.
+   */
+  void add(const T& measured, const KeyVector& keys) {
+    if (keys.size() != placeholders_.size())
+      throw std::invalid_argument(
+          "ExpressionFactorBatch::add: wrong number of keys.");
+    for (size_t i = 0; i < keys.size(); i++)
+      for (size_t j = 0; j < i; j++)
+        if (keys[i] == keys[j])
+          throw std::invalid_argument(
+              "ExpressionFactorBatch::add: duplicate keys.");
+    keys_.insert(keys_.end(), keys.begin(), keys.end());
+    measured_.push_back(measured);
+  }
+
+  /// Reserve memory for n factors
+  void reserve(size_t n) {
+    keys_.reserve(n * nrKeys());
+    measured_.reserve(n);
+  }
+
+  /// Number of factors
+  size_t size() const { return measured_.size(); }
+
+  /// Number of keys of every factor
+  size_t nrKeys() const { return placeholders_.size(); }
+
+  /// Keys of factor i
+  KeyVector keys(size_t i) const {
+    auto begin = keys_.begin() + i * nrKeys();
+    return KeyVector(begin, begin + nrKeys());
+  }
+
+  /// Measurement of factor i
+  const T& measured(size_t i) const { return measured_[i]; }
+
+  /// Noise model shared by all factors
+  const SharedNoiseModel& noiseModel() const { return noiseModel_; }
+
+  /// Expression in terms of the placeholder keys
+  const Expression<T>& expression() const { return expression_; }
+
+  /// Unwhitened errors, as ExpressionFactor::unwhitenedError, one column each
+  Matrix unwhitenedErrors(const Values& values) const {
+    Matrix errors(Dim, size());
+    forEach([&](CompiledExpression<T>& compiled, size_t i) {
+      errors.col(i) = -traits<T>::Local(compiled.value(values), measured_[i]);
+    });
+    return errors;
+  }
+
+  /// Total error of all factors, as NonlinearFactorGraph::error
+  double error(const Values& values) const {
+    gttic(ExpressionFactorBatch_error);
+    const Matrix errors = unwhitenedErrors(values);
+    auto gaussian =
+        boost::dynamic_pointer_cast<noiseModel::Gaussian>(noiseModel_);
+    if (gaussian && !gaussian->isConstrained())
+      return 0.5 * gaussian->Whiten(errors).squaredNorm();
+    double total = 0.0;
+    for (size_t i = 0; i < size(); i++)
+      total += noiseModel_->loss(
+          noiseModel_->squaredMahalanobisDistance(errors.col(i)));
+    return total;
+  }
+
+  /// Linearize all factors, in order, as ExpressionFactor::linearize
+  GaussianFactorGraph::shared_ptr linearize(const Values& values) const {
+    gttic(ExpressionFactorBatch_linearize);
+
+    // In case noise model is constrained, we need to provide a noise model
+    SharedDiagonal model;
+    if (noiseModel_->isConstrained())
+      model = boost::static_pointer_cast<noiseModel::Constrained>(noiseModel_)
+                  ->unit();
+
+    auto linearFG = boost::make_shared<GaussianFactorGraph>();
+    linearFG->resize(size());
+    forEach([&](CompiledExpression<T>& compiled, size_t i) {
+      boost::shared_ptr<JacobianFactor> factor(
+          new JacobianFactor(compiled.keys(), dims_, Dim, model));
+      VerticalBlockMatrix& Ab = factor->matrixObject();
+      Ab.matrix().setZero();
+      const T value = compiled.evaluate(values, Ab);
+      Ab(nrKeys()).col(0) = traits<T>::Local(value, measured_[i]);
+      Vector b = Ab(nrKeys()).col(0);  // need b to be valid for Robust
+      noiseModel_->WhitenSystem(Ab.matrix(), b);
+      (*linearFG)[i] = factor;
+    });
+    return linearFG;
+  }
+
+ private:
+  /// Call f(compiled, i) for every factor i, with a tape rebound to its keys
+  template <class FUNCTION>
+  void forEach(const FUNCTION& f) const {
+    const size_t n = nrKeys();
+    auto chunk = [&](size_t begin, size_t end) {
+      CompiledExpression<T> compiled(expression_, placeholders_);
+      KeyVector keys(n);
+      for (size_t i = begin; i < end; i++) {
+        std::copy(keys_.begin() + i * n, keys_.begin() + (i + 1) * n,
+                  keys.begin());
+        compiled.rebind(keys);
+        f(compiled, i);
+      }
+    };
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, size(), kChunkSize),
+                      [&](const tbb::blocked_range<size_t>& range) {
+                        chunk(range.begin(), range.end());
+                      });
+#else
+    chunk(0, size());
+#endif
+  }
+};
+
+}  // namespace gtsam
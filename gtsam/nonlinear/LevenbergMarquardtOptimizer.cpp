@@ -82,7 +82,7 @@ int LevenbergMarquardtOptimizer::getInnerIterations() const {
 
 /* ************************************************************************* */
 GaussianFactorGraph::shared_ptr LevenbergMarquardtOptimizer::linearize() const {
-  return graph_.linearize(state_->values);
+  return linearizeInPlace();
 }
 
 /* ************************************************************************* */
@@ -158,14 +158,10 @@ public:
     }
   }
 
-  /// Linearize is over-written, because base linearization tries to whiten
-  GaussianFactor::shared_ptr linearize(const Values& x) const override {
-    const T& xj = x.at<T>(this->key());
-    Matrix A;
-    Vector b = evaluateError(xj, A);
-    SharedDiagonal model = noiseModel::Constrained::All(b.size());
-    return GaussianFactor::shared_ptr(
-        new JacobianFactor(this->key(), A, b, model));
+  /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+  bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                        std::vector<Matrix>& H) const override {
+    return this->template linearizeInPlaceAs<This>(x, jacobian, H);
   }
 
   /// @return a deep copy of this factor
@@ -178,6 +174,18 @@ public:
 
   GTSAM_MAKE_ALIGNED_OPERATOR_NEW
 
+protected:
+
+  /// Linearization is over-written, because base linearization tries to whiten
+  void fillJacobianFactor(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& /*H*/) const override {
+    const T& xj = x.at<T>(this->key());
+    Matrix A;
+    Vector b = evaluateError(xj, A);
+    SharedDiagonal model = noiseModel::Constrained::All(b.size());
+    jacobian = JacobianFactor(this->key(), A, b, model);
+  }
+
 private:
 
   /// Serialization function
@@ -255,6 +263,12 @@ public:
     return traits<X>::Local(value_,x1);
   }
 
+  /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+  bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                        std::vector<Matrix>& H) const override {
+    return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+  }
+
   /// Print
   void print(const std::string& s = "",
       const KeyFormatter& keyFormatter = DefaultKeyFormatter) const override {
@@ -330,6 +344,12 @@ class NonlinearEquality2 : public NoiseModelFactor2<T, T> {
     return traits<T>::Local(x1, x2);
   }
 
+  /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+  bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                        std::vector<Matrix>& H) const override {
+    return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+  }
+
   GTSAM_MAKE_ALIGNED_OPERATOR_NEW
 
  private:
@@ -145,30 +145,69 @@ boost::shared_ptr<GaussianFactor> NoiseModelFactor::linearize(
   if (!active(x))
     return boost::shared_ptr<JacobianFactor>();
 
-  // Call evaluate error to get Jacobians and RHS vector b
+  auto factor = boost::make_shared<JacobianFactor>();
   std::vector<Matrix> A(size());
-  Vector b = -unwhitenedError(x, A);
-  check(noiseModel_, b.size());
+  fillJacobianFactor(x, *factor, A);
+  return factor;
+}
+
+/* ************************************************************************* */
+bool NoiseModelFactor::linearizeActiveInPlace(const Values& x,
+                                              JacobianFactor& jacobian,
+                                              std::vector<Matrix>& H) const {
+  if (!active(x)) return false;
+  fillJacobianFactor(x, jacobian, H);
+  return true;
+}
+
+/* ************************************************************************* */
+void NoiseModelFactor::fillJacobianFactor(const Values& x,
+                                          JacobianFactor& jacobian,
+                                          std::vector<Matrix>& A) const {
+  // Call evaluate error to get Jacobians and RHS vector b
+  A.resize(size());
+  Vector b = unwhitenedError(x, A);
+  b = -b;
+  prepareJacobianFactor(jacobian, A, b.size());
 
   // Whiten the corresponding system now
   if (noiseModel_)
     noiseModel_->WhitenSystem(A, b);
 
-  // Fill in terms, needed to create JacobianFactor below
-  std::vector<std::pair<Key, Matrix> > terms(size());
-  for (size_t j = 0; j < size(); ++j) {
-    terms[j].first = keys()[j];
-    terms[j].second.swap(A[j]);
+  // Fill in terms
+  VerticalBlockMatrix& Ab = jacobian.matrixObject();
+  for (size_t j = 0; j < size(); ++j) Ab(j) = A[j];
+  Ab(size()).col(0) = b;
+}
+
+/* ************************************************************************* */
+void NoiseModelFactor::prepareJacobianFactor(JacobianFactor& jacobian,
+                                             const std::vector<Matrix>& A,
+                                             DenseIndex m) const {
+  check(noiseModel_, m);
+
+  // Re-allocate the storage of the JacobianFactor only if its shape is wrong
+  VerticalBlockMatrix& Ab = jacobian.matrixObject();
+  bool sameShape = Ab.firstBlock() == 0 && Ab.rowStart() == 0 &&
+                   Ab.rowEnd() == m && Ab.matrix().rows() == m &&
+                   Ab.nBlocks() == DenseIndex(size() + 1);
+  for (size_t j = 0; sameShape && j < size(); ++j)
+    sameShape = Ab(j).cols() == A[j].cols();
+  if (!sameShape) {
+    FastVector<DenseIndex> dims(size());
+    for (size_t j = 0; j < size(); ++j) dims[j] = A[j].cols();
+    Ab = VerticalBlockMatrix(dims, m, true);
   }
 
+  jacobian.keys() = keys();
+
   // TODO pass unwhitened + noise model to Gaussian factor
   using noiseModel::Constrained;
   if (noiseModel_ && noiseModel_->isConstrained())
-    return GaussianFactor::shared_ptr(
-        new JacobianFactor(terms, b,
-            boost::static_pointer_cast<Constrained>(noiseModel_)->unit()));
+    jacobian.get_model() =
+        boost::static_pointer_cast<Constrained>(noiseModel_)->unit();
   else
-    return GaussianFactor::shared_ptr(new JacobianFactor(terms, b));
+    jacobian.get_model().reset();
 }
 
 /* ************************************************************************* */
@@ -29,6 +29,8 @@
 #include <boost/serialization/base_object.hpp>
 #include <boost/assign/list_of.hpp>
 
+#include <typeinfo>
+
 namespace gtsam {
 
 using boost::assign::cref_list_of;
@@ -252,13 +254,76 @@ public:
    */
   boost::shared_ptr<GaussianFactor> linearize(const Values& x) const override;
 
+  /**
+   * Linearize into an existing JacobianFactor, typically the one this factor
+   * produced in the previous iteration, which then gets the same contents as
+   * the result of linearize(). Its storage is only re-allocated if the
+   * dimensions changed, and the Jacobians are evaluated into H, whose
+   * matrices keep their memory from call to call.
+   * Returns false, leaving the JacobianFactor as is, if the factor is not
+   * active, or if it cannot linearize in place, which is the default. A class
+   * whose linearize() only differs through fillJacobianFactor() opts in by
+   * overriding this with linearizeInPlaceAs<This>(), as BetweenFactor does.
+   */
+  virtual bool linearizeInPlace(const Values& /*x*/, JacobianFactor& /*jacobian*/,
+                                std::vector<Matrix>& /*H*/) const {
+    return false;
+  }
+
   /**
    * Creates a shared_ptr clone of the
    * factor with a new noise model
    */
   shared_ptr cloneWithNewNoiseModel(const SharedNoiseModel newNoise) const;
 
+ protected:
+  /**
+   * linearizeInPlace() for a class FACTOR that opts in. Derived classes might
+   * override linearize(), so their instances return false unless they opt in
+   * themselves.
+   */
+  template <class FACTOR>
+  bool linearizeInPlaceAs(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const {
+    return typeid(*this) == typeid(FACTOR) &&
+           linearizeActiveInPlace(x, jacobian, H);
+  }
+
+  /// linearizeInPlace() for any factor that linearizes with
+  /// fillJacobianFactor(), see linearizeInPlaceAs()
+  bool linearizeActiveInPlace(const Values& x, JacobianFactor& jacobian,
+                              std::vector<Matrix>& H) const;
+
+  /**
+   * Linearize into the given JacobianFactor, assuming the factor is active.
+   * Used by both linearize() and linearizeInPlace(). The NoiseModelFactorN
+   * classes override this with fillFixedSizeJacobianFactor(), through their
+   * common base internal::FixedSizeNoiseModelFactor.
+   */
+  virtual void fillJacobianFactor(const Values& x, JacobianFactor& jacobian,
+                                  std::vector<Matrix>& H) const;
+
+  /**
+   * Like fillJacobianFactor(), for a factor whose variables have the
+   * dimensions Dims, which may be Eigen::Dynamic. For Gaussian noise models,
+   * possibly wrapped in a Robust one, the Jacobians are whitened directly into
+   * the blocks of the JacobianFactor, as products with a fixed number of
+   * columns, and the robust weights are then applied to whole rows in one
+   * pass. Apart from the error vector returned by unwhitenedError(), nothing
+   * is allocated if the JacobianFactor has the right shape already.
+   * Constrained and other noise models go through fillJacobianFactor().
+   */
+  template <int... Dims>
+  void fillFixedSizeJacobianFactor(const Values& x, JacobianFactor& jacobian,
+                                   std::vector<Matrix>& H) const;
+
  private:
+  /// Give the JacobianFactor blocks of the sizes of A, with m rows, if it
+  /// has not got them yet, and set its keys and noise model. Throws
+  /// std::invalid_argument if m is not the dimension of the noise model.
+  void prepareJacobianFactor(JacobianFactor& jacobian,
+                             const std::vector<Matrix>& A, DenseIndex m) const;
+
   /** Serialization function */
   friend class boost::serialization::access;
   template<class ARCHIVE>
@@ -270,6 +335,142 @@ public:
 
 }; // \class NoiseModelFactor
 
+/* ************************************************************************* */
+namespace internal {
+
+/// The dimension in the traits of T, or Eigen::Dynamic if they do not have one
+template <class T, class = void>
+struct FixedDimension {
+  static const int value = Eigen::Dynamic;
+};
+
+template <class T>
+struct FixedDimension<T, decltype(void(traits<T>::dimension))> {
+  static const int value = traits<T>::dimension;
+};
+
+/// Whitens the Jacobian blocks of a NoiseModelFactor with variable dimensions
+/// Dims, one after the other, see NoiseModelFactor::fillFixedSizeJacobianFactor
+template <int... Dims>
+struct WhitenFixedSizeBlocks {
+  static void run(const Matrix*, const Vector*, double,
+                  const std::vector<Matrix>&, Matrix&, DenseIndex,
+                  size_t = 0) {}
+};
+
+template <int D, int... Rest>
+struct WhitenFixedSizeBlocks<D, Rest...> {
+  /// Whiten H[j] into the columns of Ab starting at column col, using
+  /// either R, or the inverse sigmas, or else the single inverse sigma
+  static void run(const Matrix* R, const Vector* invsigmas, double invsigma,
+                  const std::vector<Matrix>& H, Matrix& Ab, DenseIndex col,
+                  size_t j = 0) {
+    const Matrix& Hj = H[j];
+    assert(D == Eigen::Dynamic || Hj.cols() == D);
+    const Eigen::Block<const Matrix, Eigen::Dynamic, D> from(
+        Hj, 0, 0, Hj.rows(), Hj.cols());
+    Eigen::Block<Matrix, Eigen::Dynamic, D> to(Ab, 0, col, Ab.rows(),
+                                               Hj.cols());
+    if (R)
+      to.noalias() = (*R) * from;
+    else if (invsigmas)
+      to = invsigmas->asDiagonal() * from;
+    else
+      to = invsigma * from;
+    WhitenFixedSizeBlocks<Rest...>::run(R, invsigmas, invsigma, H, Ab,
+                                        col + Hj.cols(), j + 1);
+  }
+};
+
+}  // namespace internal
+
+/* ************************************************************************* */
+template <int... Dims>
+void NoiseModelFactor::fillFixedSizeJacobianFactor(
+    const Values& x, JacobianFactor& jacobian, std::vector<Matrix>& H) const {
+  static_assert(sizeof...(Dims) > 0, "A factor needs variables");
+  assert(sizeof...(Dims) == size());
+
+  // Find the Gaussian model, and the robust loss function if any. The exact
+  // types are compared, which is cheaper than dynamic_cast, and leaves
+  // Constrained and any models derived elsewhere to fillJacobianFactor().
+  const noiseModel::Robust* robust = nullptr;
+  const noiseModel::Base* model = noiseModel_.get();
+  if (model && typeid(*model) == typeid(noiseModel::Robust)) {
+    robust = static_cast<const noiseModel::Robust*>(model);
+    model = robust->noise().get();
+  }
+  const Matrix* R = nullptr;
+  const Vector* invsigmas = nullptr;
+  double invsigma = 1.0;
+  if (model) {
+    const std::type_info& type = typeid(*model);
+    if (type == typeid(noiseModel::Isotropic))
+      invsigma = static_cast<const noiseModel::Isotropic*>(model)->invsigma(0);
+    else if (type == typeid(noiseModel::Diagonal))
+      invsigmas = &static_cast<const noiseModel::Diagonal*>(model)->invsigmas();
+    else if (type == typeid(noiseModel::Gaussian))
+      R = &static_cast<const noiseModel::Gaussian*>(model)->thisR();
+    else if (type != typeid(noiseModel::Unit))
+      return NoiseModelFactor::fillJacobianFactor(x, jacobian, H);
+  }
+
+  // Call evaluate error to get Jacobians and RHS vector b
+  H.resize(size());
+  Vector b = unwhitenedError(x, H);
+  b = -b;
+  prepareJacobianFactor(jacobian, H, b.size());
+
+  // Whiten the blocks and the RHS straight into the JacobianFactor
+  Matrix& Ab = jacobian.matrixObject().matrix();
+  internal::WhitenFixedSizeBlocks<Dims...>::run(R, invsigmas, invsigma, H, Ab,
+                                                0);
+  auto rhs = Ab.col(Ab.cols() - 1);
+  if (R)
+    rhs.noalias() = (*R) * b;
+  else if (invsigmas)
+    rhs = invsigmas->cwiseProduct(b);
+  else
+    rhs = invsigma * b;
+
+  // Reweight whole rows of [A b] according to the whitened error
+  if (robust) {
+    const noiseModel::mEstimator::Base& loss = *robust->robust();
+    if (loss.reweightScheme() == noiseModel::mEstimator::Base::Block) {
+      Ab *= loss.sqrtWeight(rhs.norm());
+    } else {
+      for (DenseIndex i = 0; i < Ab.rows(); ++i)
+        Ab.row(i) *= loss.sqrtWeight(rhs(i));
+    }
+  }
+}
+
+
+/* ************************************************************************* */
+namespace internal {
+
+/**
+ * Base of the NoiseModelFactorN classes, on variables of the types VALUES,
+ * which linearizes with NoiseModelFactor::fillFixedSizeJacobianFactor.
+ */
+template <class... VALUES>
+class FixedSizeNoiseModelFactor : public NoiseModelFactor {
+ public:
+  using NoiseModelFactor::NoiseModelFactor;
+
+  /** Default constructor for I/O only */
+  FixedSizeNoiseModelFactor() {}
+
+ protected:
+  /// Whiten the Jacobians with fixed-size products
+  void fillJacobianFactor(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+    fillFixedSizeJacobianFactor<FixedDimension<VALUES>::value...>(
+        x, jacobian, H);
+  }
+};
+
+}  // namespace internal
 
 /* ************************************************************************* */
 
@@ -282,7 +483,8 @@ public:
  * which are objects in non-linear manifolds (Lie groups).
  */
 template<class VALUE>
-class GTSAM_EXPORT NoiseModelFactor1: public NoiseModelFactor {
+class GTSAM_EXPORT NoiseModelFactor1
+    : public internal::FixedSizeNoiseModelFactor<VALUE> {
 
 public:
 
@@ -291,7 +493,7 @@ public:
 
 protected:
 
-  typedef NoiseModelFactor Base;
+  typedef internal::FixedSizeNoiseModelFactor<VALUE> Base;
   typedef NoiseModelFactor1<VALUE> This;
 
 public:
@@ -303,7 +505,7 @@ public:
 
   ~NoiseModelFactor1() override {}
 
-  inline Key key() const { return keys_[0]; }
+  inline Key key() const { return this->keys_[0]; }
 
   /**
    *  Constructor
@@ -325,7 +527,7 @@ public:
       const Values &x,
       boost::optional<std::vector<Matrix> &> H = boost::none) const override {
     if (this->active(x)) {
-      const X &x1 = x.at<X>(keys_[0]);
+      const X &x1 = x.at<X>(key());
       if (H) {
         return evaluateError(x1, (*H)[0]);
       } else {
@@ -357,7 +559,7 @@ private:
   template<class ARCHIVE>
   void serialize(ARCHIVE & ar, const unsigned int /*version*/) {
     ar & boost::serialization::make_nvp("NoiseModelFactor",
-        boost::serialization::base_object<Base>(*this));
+        boost::serialization::base_object<NoiseModelFactor>(*this));
   }
 };// \class NoiseModelFactor1
 
@@ -366,7 +568,8 @@ private:
 /** A convenient base class for creating your own NoiseModelFactor with 2
  * variables.  To derive from this class, implement evaluateError(). */
 template<class VALUE1, class VALUE2>
-class GTSAM_EXPORT NoiseModelFactor2: public NoiseModelFactor {
+class GTSAM_EXPORT NoiseModelFactor2
+    : public internal::FixedSizeNoiseModelFactor<VALUE1, VALUE2> {
 
 public:
 
@@ -376,7 +579,7 @@ public:
 
 protected:
 
-  typedef NoiseModelFactor Base;
+  typedef internal::FixedSizeNoiseModelFactor<VALUE1, VALUE2> Base;
   typedef NoiseModelFactor2<VALUE1, VALUE2> This;
 
 public:
@@ -398,15 +601,15 @@ public:
   ~NoiseModelFactor2() override {}
 
   /** methods to retrieve both keys */
-  inline Key key1() const { return keys_[0];  }
-  inline Key key2() const {  return keys_[1];  }
+  inline Key key1() const { return this->keys_[0];  }
+  inline Key key2() const {  return this->keys_[1];  }
 
   /** Calls the 2-key specific version of evaluateError, which is pure virtual
    * so must be implemented in the derived class. */
   Vector unwhitenedError(const Values& x, boost::optional<std::vector<Matrix>&> H = boost::none) const override {
     if(this->active(x)) {
-      const X1& x1 = x.at<X1>(keys_[0]);
-      const X2& x2 = x.at<X2>(keys_[1]);
+      const X1& x1 = x.at<X1>(key1());
+      const X2& x2 = x.at<X2>(key2());
       if(H) {
         return evaluateError(x1, x2, (*H)[0], (*H)[1]);
       } else {
@@ -433,7 +636,7 @@ private:
   template<class ARCHIVE>
   void serialize(ARCHIVE & ar, const unsigned int /*version*/) {
     ar & boost::serialization::make_nvp("NoiseModelFactor",
-        boost::serialization::base_object<Base>(*this));
+        boost::serialization::base_object<NoiseModelFactor>(*this));
   }
 }; // \class NoiseModelFactor2
 
@@ -441,7 +644,8 @@ private:
 /** A convenient base class for creating your own NoiseModelFactor with 3
  * variables.  To derive from this class, implement evaluateError(). */
 template<class VALUE1, class VALUE2, class VALUE3>
-class GTSAM_EXPORT NoiseModelFactor3: public NoiseModelFactor {
+class GTSAM_EXPORT NoiseModelFactor3
+    : public internal::FixedSizeNoiseModelFactor<VALUE1, VALUE2, VALUE3> {
 
 public:
 
@@ -452,7 +656,7 @@ public:
 
 protected:
 
-  typedef NoiseModelFactor Base;
+  typedef internal::FixedSizeNoiseModelFactor<VALUE1, VALUE2, VALUE3> Base;
   typedef NoiseModelFactor3<VALUE1, VALUE2, VALUE3> This;
 
 public:
@@ -475,18 +679,18 @@ public:
   ~NoiseModelFactor3() override {}
 
   /** methods to retrieve keys */
-  inline Key key1() const { return keys_[0]; }
-  inline Key key2() const { return keys_[1]; }
-  inline Key key3() const { return keys_[2]; }
+  inline Key key1() const { return this->keys_[0]; }
+  inline Key key2() const { return this->keys_[1]; }
+  inline Key key3() const { return this->keys_[2]; }
 
   /** Calls the 3-key specific version of evaluateError, which is pure virtual
    * so must be implemented in the derived class. */
   Vector unwhitenedError(const Values& x, boost::optional<std::vector<Matrix>&> H = boost::none) const override {
     if(this->active(x)) {
       if(H)
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), (*H)[0], (*H)[1], (*H)[2]);
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), (*H)[0], (*H)[1], (*H)[2]);
       else
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]));
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()));
     } else {
       return Vector::Zero(this->dim());
     }
@@ -510,7 +714,7 @@ private:
   template<class ARCHIVE>
   void serialize(ARCHIVE & ar, const unsigned int /*version*/) {
     ar & boost::serialization::make_nvp("NoiseModelFactor",
-        boost::serialization::base_object<Base>(*this));
+        boost::serialization::base_object<NoiseModelFactor>(*this));
   }
 }; // \class NoiseModelFactor3
 
@@ -518,7 +722,9 @@ private:
 /** A convenient base class for creating your own NoiseModelFactor with 4
  * variables.  To derive from this class, implement evaluateError(). */
 template<class VALUE1, class VALUE2, class VALUE3, class VALUE4>
-class GTSAM_EXPORT NoiseModelFactor4: public NoiseModelFactor {
+class GTSAM_EXPORT NoiseModelFactor4
+    : public internal::FixedSizeNoiseModelFactor<
+          VALUE1, VALUE2, VALUE3, VALUE4> {
 
 public:
 
@@ -530,7 +736,8 @@ public:
 
 protected:
 
-  typedef NoiseModelFactor Base;
+  typedef internal::FixedSizeNoiseModelFactor<
+      VALUE1, VALUE2, VALUE3, VALUE4> Base;
   typedef NoiseModelFactor4<VALUE1, VALUE2, VALUE3, VALUE4> This;
 
 public:
@@ -554,19 +761,19 @@ public:
   ~NoiseModelFactor4() override {}
 
   /** methods to retrieve keys */
-  inline Key key1() const { return keys_[0]; }
-  inline Key key2() const { return keys_[1]; }
-  inline Key key3() const { return keys_[2]; }
-  inline Key key4() const { return keys_[3]; }
+  inline Key key1() const { return this->keys_[0]; }
+  inline Key key2() const { return this->keys_[1]; }
+  inline Key key3() const { return this->keys_[2]; }
+  inline Key key4() const { return this->keys_[3]; }
 
   /** Calls the 4-key specific version of evaluateError, which is pure virtual
    * so must be implemented in the derived class. */
   Vector unwhitenedError(const Values& x, boost::optional<std::vector<Matrix>&> H = boost::none) const override {
     if(this->active(x)) {
       if(H)
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), x.at<X4>(keys_[3]), (*H)[0], (*H)[1], (*H)[2], (*H)[3]);
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), x.at<X4>(key4()), (*H)[0], (*H)[1], (*H)[2], (*H)[3]);
       else
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), x.at<X4>(keys_[3]));
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), x.at<X4>(key4()));
     } else {
       return Vector::Zero(this->dim());
     }
@@ -591,7 +798,7 @@ private:
   template<class ARCHIVE>
   void serialize(ARCHIVE & ar, const unsigned int /*version*/) {
     ar & boost::serialization::make_nvp("NoiseModelFactor",
-        boost::serialization::base_object<Base>(*this));
+        boost::serialization::base_object<NoiseModelFactor>(*this));
   }
 }; // \class NoiseModelFactor4
 
@@ -599,7 +806,9 @@ private:
 /** A convenient base class for creating your own NoiseModelFactor with 5
  * variables.  To derive from this class, implement evaluateError(). */
 template<class VALUE1, class VALUE2, class VALUE3, class VALUE4, class VALUE5>
-class GTSAM_EXPORT NoiseModelFactor5: public NoiseModelFactor {
+class GTSAM_EXPORT NoiseModelFactor5
+    : public internal::FixedSizeNoiseModelFactor<
+          VALUE1, VALUE2, VALUE3, VALUE4, VALUE5> {
 
 public:
 
@@ -612,7 +821,8 @@ public:
 
 protected:
 
-  typedef NoiseModelFactor Base;
+  typedef internal::FixedSizeNoiseModelFactor<
+      VALUE1, VALUE2, VALUE3, VALUE4, VALUE5> Base;
   typedef NoiseModelFactor5<VALUE1, VALUE2, VALUE3, VALUE4, VALUE5> This;
 
 public:
@@ -637,20 +847,20 @@ public:
   ~NoiseModelFactor5() override {}
 
   /** methods to retrieve keys */
-  inline Key key1() const { return keys_[0]; }
-  inline Key key2() const { return keys_[1]; }
-  inline Key key3() const { return keys_[2]; }
-  inline Key key4() const { return keys_[3]; }
-  inline Key key5() const { return keys_[4]; }
+  inline Key key1() const { return this->keys_[0]; }
+  inline Key key2() const { return this->keys_[1]; }
+  inline Key key3() const { return this->keys_[2]; }
+  inline Key key4() const { return this->keys_[3]; }
+  inline Key key5() const { return this->keys_[4]; }
 
   /** Calls the 5-key specific version of evaluateError, which is pure virtual
    * so must be implemented in the derived class. */
   Vector unwhitenedError(const Values& x, boost::optional<std::vector<Matrix>&> H = boost::none) const override {
     if(this->active(x)) {
       if(H)
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), x.at<X4>(keys_[3]), x.at<X5>(keys_[4]), (*H)[0], (*H)[1], (*H)[2], (*H)[3], (*H)[4]);
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), x.at<X4>(key4()), x.at<X5>(key5()), (*H)[0], (*H)[1], (*H)[2], (*H)[3], (*H)[4]);
       else
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), x.at<X4>(keys_[3]), x.at<X5>(keys_[4]));
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), x.at<X4>(key4()), x.at<X5>(key5()));
     } else {
       return Vector::Zero(this->dim());
     }
@@ -676,7 +886,7 @@ private:
   template<class ARCHIVE>
   void serialize(ARCHIVE & ar, const unsigned int /*version*/) {
     ar & boost::serialization::make_nvp("NoiseModelFactor",
-        boost::serialization::base_object<Base>(*this));
+        boost::serialization::base_object<NoiseModelFactor>(*this));
   }
 }; // \class NoiseModelFactor5
 
@@ -684,7 +894,9 @@ private:
 /** A convenient base class for creating your own NoiseModelFactor with 6
  * variables.  To derive from this class, implement evaluateError(). */
 template<class VALUE1, class VALUE2, class VALUE3, class VALUE4, class VALUE5, class VALUE6>
-class GTSAM_EXPORT NoiseModelFactor6: public NoiseModelFactor {
+class GTSAM_EXPORT NoiseModelFactor6
+    : public internal::FixedSizeNoiseModelFactor<
+          VALUE1, VALUE2, VALUE3, VALUE4, VALUE5, VALUE6> {
 
 public:
 
@@ -698,7 +910,8 @@ public:
 
 protected:
 
-  typedef NoiseModelFactor Base;
+  typedef internal::FixedSizeNoiseModelFactor<
+      VALUE1, VALUE2, VALUE3, VALUE4, VALUE5, VALUE6> Base;
   typedef NoiseModelFactor6<VALUE1, VALUE2, VALUE3, VALUE4, VALUE5, VALUE6> This;
 
 public:
@@ -724,21 +937,21 @@ public:
   ~NoiseModelFactor6() override {}
 
   /** methods to retrieve keys */
-  inline Key key1() const { return keys_[0]; }
-  inline Key key2() const { return keys_[1]; }
-  inline Key key3() const { return keys_[2]; }
-  inline Key key4() const { return keys_[3]; }
-  inline Key key5() const { return keys_[4]; }
-  inline Key key6() const { return keys_[5]; }
+  inline Key key1() const { return this->keys_[0]; }
+  inline Key key2() const { return this->keys_[1]; }
+  inline Key key3() const { return this->keys_[2]; }
+  inline Key key4() const { return this->keys_[3]; }
+  inline Key key5() const { return this->keys_[4]; }
+  inline Key key6() const { return this->keys_[5]; }
 
   /** Calls the 6-key specific version of evaluateError, which is pure virtual
    * so must be implemented in the derived class. */
   Vector unwhitenedError(const Values& x, boost::optional<std::vector<Matrix>&> H = boost::none) const override {
     if(this->active(x)) {
       if(H)
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), x.at<X4>(keys_[3]), x.at<X5>(keys_[4]), x.at<X6>(keys_[5]), (*H)[0], (*H)[1], (*H)[2], (*H)[3], (*H)[4], (*H)[5]);
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), x.at<X4>(key4()), x.at<X5>(key5()), x.at<X6>(key6()), (*H)[0], (*H)[1], (*H)[2], (*H)[3], (*H)[4], (*H)[5]);
       else
-        return evaluateError(x.at<X1>(keys_[0]), x.at<X2>(keys_[1]), x.at<X3>(keys_[2]), x.at<X4>(keys_[3]), x.at<X5>(keys_[4]), x.at<X6>(keys_[5]));
+        return evaluateError(x.at<X1>(key1()), x.at<X2>(key2()), x.at<X3>(key3()), x.at<X4>(key4()), x.at<X5>(key5()), x.at<X6>(key6()));
     } else {
       return Vector::Zero(this->dim());
     }
@@ -765,7 +978,7 @@ private:
   template<class ARCHIVE>
   void serialize(ARCHIVE & ar, const unsigned int /*version*/) {
     ar & boost::serialization::make_nvp("NoiseModelFactor",
-        boost::serialization::base_object<Base>(*this));
+        boost::serialization::base_object<NoiseModelFactor>(*this));
   }
 }; // \class NoiseModelFactor6
 
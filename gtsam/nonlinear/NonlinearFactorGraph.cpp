@@ -37,6 +37,7 @@
 #include <cmath>
 #include <fstream>
 #include <set>
+#include <typeinfo>
 
 using namespace std;
 
@@ -277,6 +278,65 @@ GaussianFactorGraph::shared_ptr NonlinearFactorGraph::linearize(const Values& li
   return linearFG;
 }
 
+/* ************************************************************************* */
+namespace {
+// Linearize a factor into linear, overwriting the JacobianFactor in there if
+// it is not shared, with the scratch Jacobians H.
+void linearizeFactorInPlace(const NonlinearFactor::shared_ptr& factor,
+                            const Values& x, GaussianFactor::shared_ptr& linear,
+                            std::vector<Matrix>& H) {
+  if (!factor) {
+    linear.reset();
+    return;
+  }
+  auto noiseModelFactor = dynamic_cast<const NoiseModelFactor*>(factor.get());
+  GaussianFactor* previous = linear.get();
+  if (noiseModelFactor && previous && linear.unique() &&
+      typeid(*previous) == typeid(JacobianFactor) &&
+      noiseModelFactor->linearizeInPlace(
+          x, static_cast<JacobianFactor&>(*previous), H))
+    return;
+  linear = factor->linearize(x);
+}
+}  // namespace
+
+/* ************************************************************************* */
+void NonlinearFactorGraph::linearizeInPlace(const Values& linearizationPoint,
+                                            GaussianFactorGraph& linear) const {
+  gttic(NonlinearFactorGraph_linearizeInPlace);
+
+  linear.resize(size());
+  std::vector<Matrix> H;
+
+#ifdef GTSAM_USE_TBB
+
+  TbbOpenMPMixedScope threadLimiter; // Limits OpenMP threads since we're mixing TBB and OpenMP
+
+  // First linearize all sendable factors, with scratch Jacobians per range
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, size()),
+    [&](const tbb::blocked_range<size_t>& range) {
+      std::vector<Matrix> scratch;
+      for (size_t i = range.begin(); i != range.end(); ++i) {
+        if (!factors_[i] || factors_[i]->sendable())
+          linearizeFactorInPlace(factors_[i], linearizationPoint, linear[i],
+                                 scratch);
+      }
+    });
+
+  // Linearize all non-sendable factors
+  for (size_t i = 0; i < size(); i++) {
+    if (factors_[i] && !factors_[i]->sendable())
+      linearizeFactorInPlace(factors_[i], linearizationPoint, linear[i], H);
+  }
+
+#else
+
+  for (size_t i = 0; i < size(); i++)
+    linearizeFactorInPlace(factors_[i], linearizationPoint, linear[i], H);
+
+#endif
+}
+
 /* ************************************************************************* */
 static Scatter scatterFromValues(const Values& values) {
   gttic(scatterFromValues);
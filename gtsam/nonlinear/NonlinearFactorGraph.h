@@ -132,6 +132,18 @@ namespace gtsam {
     /// Linearize a nonlinear factor graph
     boost::shared_ptr<GaussianFactorGraph> linearize(const Values& linearizationPoint) const;
 
+    /**
+     * Linearize a nonlinear factor graph into the GaussianFactorGraph of a
+     * previous linearization, typically of the previous iteration. Factor i
+     * overwrites the JacobianFactor at position i in place if nothing else
+     * refers to it, reusing its storage (see
+     * NoiseModelFactor::linearizeInPlace), and is linearized as usual
+     * otherwise. Hence, the linear graph acts as an arena for the linear
+     * factors, which is reset in every iteration.
+     */
+    void linearizeInPlace(const Values& linearizationPoint,
+                          GaussianFactorGraph& linear) const;
+
     /// typdef for dampen functions used below
     typedef std::function<void(const boost::shared_ptr<HessianFactor>& hessianFactor)> Dampen;
 
@@ -61,6 +61,15 @@ const Values& NonlinearOptimizer::values() const {
   return state_->values;
 }
 
+/* ************************************************************************* */
+GaussianFactorGraph::shared_ptr NonlinearOptimizer::linearizeInPlace() const {
+  if (!_params().reuseLinearFactors) return graph_.linearize(state_->values);
+  graph_.linearizeInPlace(state_->values, linearized_);
+  // Hand out a copy, such that the caller can keep it while we overwrite
+  // the factors that are no longer shared in the next iteration
+  return boost::make_shared<GaussianFactorGraph>(linearized_);
+}
+
 /* ************************************************************************* */
 void NonlinearOptimizer::defaultOptimize() {
   const NonlinearOptimizerParams& params = _params();
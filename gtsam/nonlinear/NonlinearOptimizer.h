@@ -79,6 +79,10 @@ protected:
 
   std::unique_ptr<internal::NonlinearOptimizerState> state_; ///< PIMPL'd state
 
+  /// Linear factors of the last iteration, overwritten in the next one, only
+  /// kept with NonlinearOptimizerParams::reuseLinearFactors
+  mutable GaussianFactorGraph linearized_;
+
 public:
   /** A shared pointer to this class */
   using shared_ptr = boost::shared_ptr<const NonlinearOptimizer>;
@@ -145,6 +149,15 @@ protected:
 
   virtual const NonlinearOptimizerParams& _params() const = 0;
 
+  /**
+   * Linearize the graph at the current values. With
+   * NonlinearOptimizerParams::reuseLinearFactors, this reuses the storage of
+   * the linear factors of the previous call that are no longer referred to
+   * elsewhere, see NonlinearFactorGraph::linearizeInPlace, so concurrent
+   * calls on the same optimizer are not allowed.
+   */
+  GaussianFactorGraph::shared_ptr linearizeInPlace() const;
+
   /** Constructor for initial construction of base classes. Takes ownership of state. */
   NonlinearOptimizer(const NonlinearFactorGraph& graph,
                      std::unique_ptr<internal::NonlinearOptimizerState> state);
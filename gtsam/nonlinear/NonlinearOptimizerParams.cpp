@@ -120,6 +120,8 @@ void NonlinearOptimizerParams::print(const std::string& str) const {
     break;
   }
 
+  std::cout << "       reuse linear factors: " << reuseLinearFactors << "\n";
+
   std::cout.flush();
 }
 
@@ -107,6 +107,12 @@ public:
   boost::optional<Ordering> ordering; ///< The optional variable elimination ordering, or empty to use COLAMD (default: empty)
   IterativeOptimizationParameters::shared_ptr iterativeParams; ///< The container for iterativeOptimization parameters. used in CG Solvers.
 
+  /** Keep the linear factors of an iteration, and linearize into them in the
+   * next one instead of allocating new ones, see
+   * NonlinearFactorGraph::linearizeInPlace. This keeps the last linear graph
+   * in memory until the optimizer is destroyed (default: false). */
+  bool reuseLinearFactors = false;
+
   NonlinearOptimizerParams() = default;
   virtual ~NonlinearOptimizerParams() {
   }
@@ -118,7 +124,8 @@ public:
         && std::abs(relativeErrorTol - other.getRelativeErrorTol()) <= tol
         && std::abs(absoluteErrorTol - other.getAbsoluteErrorTol()) <= tol
         && std::abs(errorTol - other.getErrorTol()) <= tol
-        && verbosityTranslator(verbosity) == other.getVerbosity();
+        && verbosityTranslator(verbosity) == other.getVerbosity()
+        && reuseLinearFactors == other.reuseLinearFactors;
     //  && orderingType.equals(other.getOrderingType()_;
     // && linearSolverType == other.getLinearSolverType();
     // TODO: check ordering, iterativeParams, and iterationsHook
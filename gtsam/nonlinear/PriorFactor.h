@@ -98,6 +98,12 @@ namespace gtsam {
       return -traits<T>::Local(x, prior_);
     }
 
+    /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+    bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+      return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+    }
+
     const VALUE & prior() const { return prior_; }
 
   private:
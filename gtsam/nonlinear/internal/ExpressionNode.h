@@ -20,6 +20,7 @@
 #pragma once
 
 #include <gtsam/nonlinear/internal/ExecutionTrace.h>
+#include <gtsam/nonlinear/internal/ExpressionTape.h>
 #include <gtsam/nonlinear/internal/CallRecord.h>
 #include <gtsam/nonlinear/Values.h>
 
@@ -111,6 +112,11 @@ public:
   /// Construct an execution trace for reverse AD
   virtual T traceExecution(const Values& values, ExecutionTrace<T>& trace,
       ExecutionTraceStorage* traceStorage) const = 0;
+
+  /// Append instructions for this node to a tape, by default using traceExecution
+  virtual TapeNode<T>* compile(ExpressionTape& tape) const {
+    return tape.add<OpaqueTapeNode<T> >(*this, tape);
+  }
 };
 
 //-----------------------------------------------------------------------------
@@ -150,6 +156,11 @@ public:
     return constant_;
   }
 
+  /// Compile into a constant instruction
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    return tape.add<ConstantTapeNode<T> >(constant_);
+  }
+
   GTSAM_MAKE_ALIGNED_OPERATOR_NEW
 };
 
@@ -204,6 +215,11 @@ public:
     return values.at<T>(key_);
   }
 
+  /// Compile into a leaf instruction
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    return tape.add<LeafTapeNode<T> >(tape.keys(), tape.slot(key_));
+  }
+
 };
 
 //-----------------------------------------------------------------------------
@@ -327,6 +343,12 @@ public:
     // Finally, the function call fills in the Jacobian dTdA1
     return function_(record->value1, record->dTdA1);
   }
+
+  /// Compile arguments, then this function
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    TapeNode<A1>* argument1 = tape.compile(*expression1_);
+    return tape.add<UnaryTapeNode<T, A1> >(function_, argument1);
+  }
 };
 
 //-----------------------------------------------------------------------------
@@ -433,6 +455,14 @@ public:
     trace.setFunction(record);
     return function_(record->value1, record->value2, record->dTdA1, record->dTdA2);
   }
+
+  /// Compile arguments, then this function
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    TapeNode<A1>* argument1 = tape.compile(*expression1_);
+    TapeNode<A2>* argument2 = tape.compile(*expression2_);
+    return tape.add<BinaryTapeNode<T, A1, A2> >(function_, argument1,
+        argument2);
+  }
 };
 
 //-----------------------------------------------------------------------------
@@ -552,6 +582,15 @@ public:
     return function_(record->value1, record->value2, record->value3,
                      record->dTdA1, record->dTdA2, record->dTdA3);
   }
+
+  /// Compile arguments, then this function
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    TapeNode<A1>* argument1 = tape.compile(*expression1_);
+    TapeNode<A2>* argument2 = tape.compile(*expression2_);
+    TapeNode<A3>* argument3 = tape.compile(*expression3_);
+    return tape.add<TernaryTapeNode<T, A1, A2, A3> >(function_, argument1,
+        argument2, argument3);
+  }
 };
 
 //-----------------------------------------------------------------------------
@@ -635,6 +674,12 @@ class ScalarMultiplyNode : public ExpressionNode<T> {
     record->scalar_dTdA = scalar_;
     return scalar_ * value;
   }
+
+  /// Compile argument, then the multiplication
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    TapeNode<T>* argument = tape.compile(*expression_);
+    return tape.add<ScalarMultiplyTapeNode<T> >(scalar_, argument);
+  }
 };
 
 
@@ -728,6 +773,13 @@ class BinarySumNode : public ExpressionNode<T> {
     return expression1_->traceExecution(values, record->trace1, ptr1) +
            expression2_->traceExecution(values, record->trace2, ptr2);
   }
+
+  /// Compile arguments, then the sum
+  TapeNode<T>* compile(ExpressionTape& tape) const override {
+    TapeNode<T>* argument1 = tape.compile(*expression1_);
+    TapeNode<T>* argument2 = tape.compile(*expression2_);
+    return tape.add<BinarySumTapeNode<T> >(argument1, argument2);
+  }
 };
 
 }  // namespace internal
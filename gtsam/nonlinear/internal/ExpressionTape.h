@@ -0,0 +1,465 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file ExpressionTape.h
+ * @date October, 2026
+ * @brief Flat instruction tape for Expressions, not for general consumption
+ */
+
+#pragma once
+
+#include <gtsam/nonlinear/internal/ExecutionTrace.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/base/OptionalJacobian.h>
+#include <gtsam/base/VerticalBlockMatrix.h>
+
+#include <boost/optional.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace gtsam {
+namespace internal {
+
+template<class T> class ExpressionNode;
+
+/**
+ * One instruction on an ExpressionTape. An instruction computes the value of
+ * one node of the expression tree in forward, and in reverse multiplies the
+ * adjoint of the node, i.e., the derivative of the root with respect to the
+ * node, into the adjoints of its arguments.
+ * An instruction is *active* if its value depends on at least one key.
+ */
+class TapeInstruction {
+ protected:
+  bool active_;
+
+  explicit TapeInstruction(bool active) : active_(active) {}
+
+ public:
+  virtual ~TapeInstruction() {}
+
+  /// Whether the value depends on any key
+  bool active() const { return active_; }
+
+  /// Compute value, and the Jacobians with respect to active arguments
+  virtual void forward(const Values& values) = 0;
+
+  /// Zero the adjoint, with the given number of rows
+  virtual void zeroAdjoint(int rows) = 0;
+
+  /// Set the adjoint to identity, for the root of the expression
+  virtual void seedAdjoint(int rows) = 0;
+
+  /// Propagate the adjoint to arguments, or into Ab for leaves
+  virtual void reverse(VerticalBlockMatrix& Ab) = 0;
+};
+
+/// Instruction yielding a value of type T, with an adjoint of |root|*|T|
+template<class T>
+class TapeNode: public TapeInstruction {
+ protected:
+  const T* value_;
+  Matrix adjoint_;
+
+  explicit TapeNode(bool active) : TapeInstruction(active), value_(nullptr) {}
+
+ public:
+  /// Value computed in the last forward pass
+  const T& value() const { return *value_; }
+
+  /// Adjoint, accumulated during the reverse pass
+  Matrix& adjoint() { return adjoint_; }
+
+  void zeroAdjoint(int rows) override {
+    adjoint_.setZero(rows, traits<T>::GetDimension(*value_));
+  }
+
+  void seedAdjoint(int rows) override {
+    adjoint_.setIdentity(rows, traits<T>::GetDimension(*value_));
+  }
+};
+
+/**
+ * A flat instruction tape for an Expression, see CompiledExpression.
+ * Instructions are stored in post-order, i.e., arguments before the functions
+ * that use them, so that the forward pass is a loop over the tape, and the
+ * reverse pass a loop in the opposite direction. Inactive instructions, i.e.,
+ * constants and functions of constants, are evaluated once when compiling.
+ */
+class ExpressionTape {
+  KeyVector keys_;  ///< Jacobian blocks, in order
+  int rows_;        ///< dimension of the root
+  std::vector<std::unique_ptr<TapeInstruction> > instructions_;
+  std::vector<TapeInstruction*> program_;  ///< active instructions only
+  std::map<const void*, TapeInstruction*> compiled_;  ///< shared nodes
+  bool rebindable_;  ///< false if any instruction holds on to its keys
+
+ public:
+  /// Create an empty tape writing Jacobians for the given keys
+  ExpressionTape(const KeyVector& keys, int rows) :
+      keys_(keys), rows_(rows), rebindable_(true) {
+  }
+
+  /// Leaves refer to keys_, so a tape can be neither copied nor moved
+  ExpressionTape(const ExpressionTape&) = delete;
+  ExpressionTape(ExpressionTape&&) = delete;
+  ExpressionTape& operator=(const ExpressionTape&) = delete;
+  ExpressionTape& operator=(ExpressionTape&&) = delete;
+
+  /// Keys, in the order of the Jacobian blocks; leaves read their value here
+  const KeyVector& keys() const { return keys_; }
+
+  /// Whether rebind can be used, i.e., no instruction holds on to its keys
+  bool rebindable() const { return rebindable_; }
+
+  /// Called by instructions that hold on to their keys
+  void disableRebinding() { rebindable_ = false; }
+
+  /**
+   * Replace the keys, so the same tape evaluates the expression for other
+   * variables: the leaf of the i^th key now reads the value of keys[i].
+   */
+  void rebind(const KeyVector& keys) {
+    if (!rebindable_)
+      throw std::invalid_argument("ExpressionTape: tape cannot be rebound");
+    if (keys.size() != keys_.size())
+      throw std::invalid_argument("ExpressionTape: rebind with wrong number of keys");
+    std::copy(keys.begin(), keys.end(), keys_.begin());
+  }
+
+  /// Number of instructions executed in every forward pass
+  size_t size() const { return program_.size(); }
+
+  /// Block index of key in the Jacobian
+  size_t slot(Key key) const {
+    auto it = std::find(keys_.begin(), keys_.end(), key);
+    if (it == keys_.end())
+      throw std::invalid_argument("ExpressionTape: expression key not in keys");
+    return it - keys_.begin();
+  }
+
+  /// Compile a node, or return the instruction of an already compiled node
+  template<class T>
+  TapeNode<T>* compile(const ExpressionNode<T>& node) {
+    auto it = compiled_.find(&node);
+    if (it != compiled_.end())
+      return static_cast<TapeNode<T>*>(it->second);
+    TapeNode<T>* instruction = node.compile(*this);
+    compiled_.emplace(&node, instruction);
+    return instruction;
+  }
+
+  /// Append an instruction, called from ExpressionNode::compile
+  template<class INSTRUCTION, class... Args>
+  INSTRUCTION* add(Args&&... args) {
+    INSTRUCTION* instruction = new INSTRUCTION(std::forward<Args>(args)...);
+    instructions_.emplace_back(instruction);
+    if (instruction->active())
+      program_.push_back(instruction);
+    else
+      instruction->forward(Values());  // constant folding
+    return instruction;
+  }
+
+  /**
+   * Replay the tape for the given root, i.e., the instruction returned when
+   * compiling the root node, adding the Jacobians into the blocks of Ab.
+   */
+  void run(const Values& values, TapeInstruction* root,
+      VerticalBlockMatrix& Ab) {
+    for (TapeInstruction* instruction : program_)
+      instruction->forward(values);
+    if (!root->active()) return;
+    // The root is compiled last, hence the last active instruction.
+    assert(program_.back() == root);
+    for (TapeInstruction* instruction : program_)
+      instruction->zeroAdjoint(rows_);
+    root->seedAdjoint(rows_);
+    for (auto it = program_.rbegin(); it != program_.rend(); ++it)
+      (*it)->reverse(Ab);
+  }
+
+  /// Replay the forward pass only
+  void forward(const Values& values) {
+    for (TapeInstruction* instruction : program_)
+      instruction->forward(values);
+  }
+};
+
+//-----------------------------------------------------------------------------
+/// Constant: never on the program
+template<class T>
+class ConstantTapeNode: public TapeNode<T> {
+  T constant_;
+
+ public:
+  explicit ConstantTapeNode(const T& constant) :
+      TapeNode<T>(false), constant_(constant) {
+    this->value_ = &constant_;
+  }
+  void forward(const Values& values) override {}
+  void reverse(VerticalBlockMatrix& Ab) override {}
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Base for instructions that own their value
+template<class T>
+class FunctionTapeNode: public TapeNode<T> {
+ protected:
+  boost::optional<T> result_;
+
+  explicit FunctionTapeNode(bool active) : TapeNode<T>(active) {}
+
+  void setResult(const T& result) {
+    result_ = result;
+    this->value_ = result_.get_ptr();
+  }
+
+  /// Propagate the adjoint to an argument, through the Jacobian dTdA
+  template<class A, class JacobianTA>
+  void propagate(TapeNode<A>* argument, const JacobianTA& dTdA) {
+    if (argument->active())
+      argument->adjoint().noalias() += this->adjoint_ * dTdA;
+  }
+
+  /// OptionalJacobian into H, or none if the argument is constant
+  template<class A>
+  static typename MakeOptionalJacobian<T, A>::type optional(
+      const TapeNode<A>* argument,
+      Eigen::Matrix<double, traits<T>::dimension, traits<A>::dimension>& H) {
+    typedef typename MakeOptionalJacobian<T, A>::type Optional;
+    return argument->active() ? Optional(H) : Optional();
+  }
+};
+
+/**
+ * Leaf: copies its value from Values, and adds its adjoint into a Jacobian
+ * block. The key is looked up in the tape, so the tape can be rebound.
+ */
+template<class T>
+class LeafTapeNode: public FunctionTapeNode<T> {
+  const KeyVector& keys_;  ///< keys of the tape, which cannot be moved
+  size_t slot_;
+
+ public:
+  LeafTapeNode(const KeyVector& keys, size_t slot) :
+      FunctionTapeNode<T>(true), keys_(keys), slot_(slot) {
+  }
+  void forward(const Values& values) override {
+    this->setResult(values.at<T>(keys_[slot_]));
+  }
+  void reverse(VerticalBlockMatrix& Ab) override {
+    Ab(slot_) += this->adjoint_;
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Unary function
+template<class T, class A1>
+class UnaryTapeNode: public FunctionTapeNode<T> {
+  typedef std::function<T(const A1&,
+      typename MakeOptionalJacobian<T, A1>::type)> Function;
+  Function function_;
+  TapeNode<A1>* argument1_;
+  Eigen::Matrix<double, traits<T>::dimension, traits<A1>::dimension> dTdA1_;
+
+ public:
+  UnaryTapeNode(const Function& f, TapeNode<A1>* a1) :
+      FunctionTapeNode<T>(a1->active()), function_(f), argument1_(a1) {
+  }
+  void forward(const Values& values) override {
+    this->setResult(function_(argument1_->value(),
+        this->optional(argument1_, dTdA1_)));
+  }
+  void reverse(VerticalBlockMatrix& Ab) override {
+    this->propagate(argument1_, dTdA1_);
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Binary function
+template<class T, class A1, class A2>
+class BinaryTapeNode: public FunctionTapeNode<T> {
+  typedef std::function<T(const A1&, const A2&,
+      typename MakeOptionalJacobian<T, A1>::type,
+      typename MakeOptionalJacobian<T, A2>::type)> Function;
+  Function function_;
+  TapeNode<A1>* argument1_;
+  TapeNode<A2>* argument2_;
+  Eigen::Matrix<double, traits<T>::dimension, traits<A1>::dimension> dTdA1_;
+  Eigen::Matrix<double, traits<T>::dimension, traits<A2>::dimension> dTdA2_;
+
+ public:
+  BinaryTapeNode(const Function& f, TapeNode<A1>* a1, TapeNode<A2>* a2) :
+      FunctionTapeNode<T>(a1->active() || a2->active()), function_(f), //
+      argument1_(a1), argument2_(a2) {
+  }
+  void forward(const Values& values) override {
+    this->setResult(function_(argument1_->value(), argument2_->value(),
+        this->optional(argument1_, dTdA1_), this->optional(argument2_, dTdA2_)));
+  }
+  void reverse(VerticalBlockMatrix& Ab) override {
+    this->propagate(argument1_, dTdA1_);
+    this->propagate(argument2_, dTdA2_);
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Ternary function
+template<class T, class A1, class A2, class A3>
+class TernaryTapeNode: public FunctionTapeNode<T> {
+  typedef std::function<T(const A1&, const A2&, const A3&,
+      typename MakeOptionalJacobian<T, A1>::type,
+      typename MakeOptionalJacobian<T, A2>::type,
+      typename MakeOptionalJacobian<T, A3>::type)> Function;
+  Function function_;
+  TapeNode<A1>* argument1_;
+  TapeNode<A2>* argument2_;
+  TapeNode<A3>* argument3_;
+  Eigen::Matrix<double, traits<T>::dimension, traits<A1>::dimension> dTdA1_;
+  Eigen::Matrix<double, traits<T>::dimension, traits<A2>::dimension> dTdA2_;
+  Eigen::Matrix<double, traits<T>::dimension, traits<A3>::dimension> dTdA3_;
+
+ public:
+  TernaryTapeNode(const Function& f, TapeNode<A1>* a1, TapeNode<A2>* a2,
+      TapeNode<A3>* a3) :
+      FunctionTapeNode<T>(a1->active() || a2->active() || a3->active()), //
+      function_(f), argument1_(a1), argument2_(a2), argument3_(a3) {
+  }
+  void forward(const Values& values) override {
+    this->setResult(function_(argument1_->value(), argument2_->value(),
+        argument3_->value(), this->optional(argument1_, dTdA1_),
+        this->optional(argument2_, dTdA2_), this->optional(argument3_, dTdA3_)));
+  }
+  void reverse(VerticalBlockMatrix& Ab) override {
+    this->propagate(argument1_, dTdA1_);
+    this->propagate(argument2_, dTdA2_);
+    this->propagate(argument3_, dTdA3_);
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Scalar multiplication
+template<class T>
+class ScalarMultiplyTapeNode: public FunctionTapeNode<T> {
+  double scalar_;
+  TapeNode<T>* argument_;
+
+ public:
+  ScalarMultiplyTapeNode(double s, TapeNode<T>* a) :
+      FunctionTapeNode<T>(a->active()), scalar_(s), argument_(a) {
+  }
+  void forward(const Values& values) override {
+    this->setResult(scalar_ * argument_->value());
+  }
+  void reverse(VerticalBlockMatrix& Ab) override {
+    if (argument_->active())
+      argument_->adjoint() += scalar_ * this->adjoint_;
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// Sum of two expressions
+template<class T>
+class BinarySumTapeNode: public FunctionTapeNode<T> {
+  TapeNode<T>* argument1_;
+  TapeNode<T>* argument2_;
+
+ public:
+  BinarySumTapeNode(TapeNode<T>* a1, TapeNode<T>* a2) :
+      FunctionTapeNode<T>(a1->active() || a2->active()), argument1_(a1), //
+      argument2_(a2) {
+  }
+  void forward(const Values& values) override {
+    this->setResult(argument1_->value() + argument2_->value());
+  }
+  void reverse(VerticalBlockMatrix& Ab) override {
+    if (argument1_->active()) argument1_->adjoint() += this->adjoint_;
+    if (argument2_->active()) argument2_->adjoint() += this->adjoint_;
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/**
+ * Fallback for expression nodes that do not provide their own compile: the
+ * node is evaluated with the execution trace machinery of Expression, into
+ * Jacobians with respect to its own keys, which the reverse pass then
+ * multiplies into the Jacobian blocks of those keys. As the node reads its own
+ * keys, a tape with active opaque instructions cannot be rebound.
+ */
+template<class T>
+class OpaqueTapeNode: public FunctionTapeNode<T> {
+  static const int Dim = traits<T>::dimension;
+  const ExpressionNode<T>& node_;
+  KeyVector keys_;
+  std::vector<size_t> slots_;
+  VerticalBlockMatrix Ab_;
+  std::vector<ExecutionTraceStorage> storage_;
+
+ public:
+  OpaqueTapeNode(const ExpressionNode<T>& node, ExpressionTape& tape) :
+      FunctionTapeNode<T>(!node.keys().empty()), node_(node) {
+    if (Dim == Eigen::Dynamic)
+      throw std::invalid_argument(
+          "ExpressionTape: cannot compile dynamic-size expression node");
+    std::map<Key, int> dims;
+    node.dims(dims);
+    FastVector<int> blockDims;
+    for (const auto& key_dim : dims) {
+      keys_.push_back(key_dim.first);
+      slots_.push_back(this->active_ ? tape.slot(key_dim.first) : 0);
+      blockDims.push_back(key_dim.second);
+    }
+    Ab_ = VerticalBlockMatrix(blockDims, Dim);
+    // Over-allocate so the trace can be aligned, see Expression::traceSize
+    storage_.resize(node.traceSize() + TraceAlignment);
+    if (this->active_) tape.disableRebinding();
+  }
+
+  void forward(const Values& values) override {
+    if (!this->active_) {
+      this->setResult(node_.value(values));
+      return;
+    }
+    size_t address = reinterpret_cast<size_t>(storage_.data());
+    address += (TraceAlignment - address % TraceAlignment) % TraceAlignment;
+    Ab_.matrix().setZero();
+    JacobianMap jacobians(keys_, Ab_);
+    ExecutionTrace<T> trace;
+    this->setResult(node_.traceExecution(values, trace,
+        reinterpret_cast<ExecutionTraceStorage*>(address)));
+    trace.startReverseAD1(jacobians);
+  }
+
+  void reverse(VerticalBlockMatrix& Ab) override {
+    for (size_t i = 0; i < slots_.size(); i++)
+      Ab(slots_[i]).noalias() += this->adjoint_ * Ab_(i);
+  }
+
+  GTSAM_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+} // namespace internal
+} // namespace gtsam
@@ -0,0 +1,156 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testCompiledExpression.cpp
+ * @date October, 2026
+ * @brief unit tests for CompiledExpression and compiled ExpressionFactor
+ */
+
+#include <gtsam/nonlinear/CompiledExpression.h>
+#include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/slam/expressions.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/base/Testable.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <type_traits>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+Values createValues() {
+  Values values;
+  values.insert(1, Pose3(Rot3::RzRyRx(0.1, -0.2, 0.3), Point3(0.5, -0.3, 0.2)));
+  values.insert(2, Point3(0.3, 0.2, 4.0));
+  values.insert(3, Cal3_S2(500, 510, 0.1, 320, 240));
+  return values;
+}
+
+// Compare value and Jacobians of a compiled expression with the original.
+template<typename T>
+bool compareWithTree(const Expression<T>& expression, const Values& values) {
+  CompiledExpression<T> compiled(expression);
+  const set<Key> keys = expression.keys();
+  vector<Matrix> expectedH(keys.size()), actualH;
+  const T expected = expression.value(values, expectedH);
+  bool ok = true;
+  for (size_t k = 0; k < 2; k++) {  // replaying twice reuses the buffers
+    const T actual = compiled.value(values, actualH);
+    ok = ok && assert_equal(expected, actual, 1e-9) &&
+        traits<T>::Equals(expected, compiled.value(values), 1e-9);
+    for (size_t i = 0; i < keys.size(); i++)
+      ok = ok && assert_equal(expectedH[i], actualH[i], 1e-9);
+  }
+  return ok;
+}
+
+// A unary function not known to the tape, to exercise the fallback.
+Point2 scaleBy2(const Point2& p, OptionalJacobian<2, 2> H) {
+  if (H) *H = 2.0 * I_2x2;
+  return 2.0 * p;
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(CompiledExpression, Leaf) {
+  const Values values = createValues();
+  EXPECT(compareWithTree(Point3_(2), values));
+}
+
+/* ************************************************************************* */
+TEST(CompiledExpression, Projection) {
+  const Values values = createValues();
+  Pose3_ x(1);
+  Point3_ p(2);
+  Cal3_S2_ K(3);
+  EXPECT(compareWithTree(uncalibrate(K, project(transformTo(x, p))), values));
+  EXPECT(compareWithTree(project3(x, p, K), values));
+
+  // Constant calibration is folded, leaving transformTo, project, uncalibrate.
+  const Point2_ calibrated =
+      uncalibrate(Cal3_S2_(Cal3_S2()), project(transformTo(x, p)));
+  EXPECT(compareWithTree(calibrated, values));
+  EXPECT_LONGS_EQUAL(5, CompiledExpression<Point2>(calibrated).size());
+}
+
+/* ************************************************************************* */
+TEST(CompiledExpression, SharedAndSums) {
+  const Values values = createValues();
+  Point3_ p(2);
+  const Point3_ q = transformTo(Pose3_(1), p);
+
+  // The shared node q is compiled once, and p is a leaf of both branches.
+  const Point3_ sum = q + 3.0 * q - p;
+  EXPECT(compareWithTree(sum, values));
+  EXPECT_LONGS_EQUAL(7, CompiledExpression<Point3>(sum).size());
+}
+
+/* ************************************************************************* */
+TEST(CompiledExpression, Fallback) {
+  const Values values = createValues();
+  const Point2_ projected = project(transformTo(Pose3_(1), Point3_(2)));
+  EXPECT(compareWithTree(Point2_(scaleBy2, projected), values));
+}
+
+/* ************************************************************************* */
+TEST(CompiledExpression, KeyOrder) {
+  const Values values = createValues();
+  const Point2_ expression = project3(Pose3_(1), Point3_(2), Cal3_S2_(3));
+  CompiledExpression<Point2> compiled(expression, KeyVector{3, 1, 2});
+  vector<Matrix> H;
+  compiled.value(values, H);
+  vector<Matrix> expectedH(3);
+  expression.value(values, expectedH);
+  EXPECT(assert_equal(expectedH[2], H[0]));
+  EXPECT(assert_equal(expectedH[0], H[1]));
+  EXPECT(assert_equal(expectedH[1], H[2]));
+
+  CHECK_EXCEPTION(CompiledExpression<Point2>(expression, KeyVector{1, 2}),
+                  std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(CompiledExpression, TapeNotMovable) {
+  // Leaves refer to the keys of their tape
+  using internal::ExpressionTape;
+  EXPECT(!std::is_copy_constructible<ExpressionTape>::value);
+  EXPECT(!std::is_move_constructible<ExpressionTape>::value);
+  EXPECT(!std::is_copy_assignable<ExpressionTape>::value);
+  EXPECT(!std::is_move_assignable<ExpressionTape>::value);
+}
+
+/* ************************************************************************* */
+TEST(CompiledExpression, Factor) {
+  const Values values = createValues();
+  const Point2_ expression =
+      uncalibrate(Cal3_S2_(3), project(transformTo(Pose3_(1), Point3_(2))));
+  auto model = noiseModel::Isotropic::Sigma(2, 0.5);
+  ExpressionFactor<Point2> factor(model, Point2(300, 200), expression);
+  ExpressionFactor<Point2> compiled(factor);
+  compiled.compile();
+  EXPECT(!factor.isCompiled());
+  EXPECT(compiled.isCompiled());
+
+  const auto expected = factor.linearize(values);
+  EXPECT(assert_equal(*expected, *compiled.linearize(values), 1e-9));
+  EXPECT(assert_equal(*expected, *compiled.linearize(values), 1e-9));
+  EXPECT_DOUBLES_EQUAL(factor.error(values), compiled.error(values), 1e-9);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
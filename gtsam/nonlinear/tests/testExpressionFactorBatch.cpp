@@ -0,0 +1,133 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file testExpressionFactorBatch.cpp
+ * @date October, 2026
+ * @brief unit tests for ExpressionFactorBatch
+ */
+
+#include <gtsam/nonlinear/ExpressionFactorBatch.h>
+#include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/slam/expressions.h>
+#include <gtsam/geometry/Cal3_S2.h>
+#include <gtsam/inference/Ordering.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/base/Testable.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::K;
+using symbol_shorthand::P;
+using symbol_shorthand::X;
+
+namespace {
+const size_t M = 3, N = 300;  // more factors than kChunkSize
+
+Values createValues() {
+  Values values;
+  values.insert(K(0), Cal3_S2(500, 510, 0.1, 320, 240));
+  for (size_t i = 0; i < M; i++)
+    values.insert(X(i), Pose3(Rot3::Ypr(0.1 * i, -0.2, 0.3),
+                              Point3(0.5 * i, -0.3, 0.2)));
+  for (size_t j = 0; j < N; j++)
+    values.insert(P(j), Point3(0.01 * j, 0.2, 4.0 + 0.001 * j));
+  return values;
+}
+
+// Projection in terms of the keys of a pose, a point, and a calibration.
+Point2_ projection(Key x, Key p, Key k) {
+  return uncalibrate(Cal3_S2_(k), project(transformTo(Pose3_(x), Point3_(p))));
+}
+
+// Fill a batch and the equivalent graph of ExpressionFactors.
+void createFactors(ExpressionFactorBatch<Point2>& batch,
+                   NonlinearFactorGraph& graph) {
+  for (size_t i = 0; i < M; i++)
+    for (size_t j = 0; j < N; j++) {
+      const Point2 z(300 + i, 200 + 0.1 * j);
+      // Placeholders 0, 1, 2 are the pose, the point, and the calibration.
+      batch.add(z, {X(i), P(j), K(0)});
+      graph.addExpressionFactor(batch.noiseModel(), z,
+                                projection(X(i), P(j), K(0)));
+    }
+}
+
+// Compare the linearized batch with the linearized graph.
+bool compareLinearized(const NonlinearFactorGraph& graph,
+                       const ExpressionFactorBatch<Point2>& batch,
+                       const Values& values) {
+  const Ordering ordering(values.keys());
+  const auto expected = graph.linearize(values)->jacobian(ordering);
+  const auto actual = batch.linearize(values)->jacobian(ordering);
+  return assert_equal(expected.first, actual.first, 1e-9) &&
+         assert_equal(expected.second, actual.second, 1e-9);
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(ExpressionFactorBatch, Gaussian) {
+  const Values values = createValues();
+  ExpressionFactorBatch<Point2> batch(noiseModel::Isotropic::Sigma(2, 0.5),
+                                      projection(0, 1, 2));
+  NonlinearFactorGraph graph;
+  createFactors(batch, graph);
+  EXPECT_LONGS_EQUAL(M * N, batch.size());
+  EXPECT_LONGS_EQUAL(3, batch.nrKeys());
+  EXPECT(batch.keys(N + 1) == KeyVector({X(1), P(1), K(0)}));
+
+  EXPECT_DOUBLES_EQUAL(graph.error(values), batch.error(values), 1e-6);
+  const Matrix errors = batch.unwhitenedErrors(values);
+  auto factor = boost::dynamic_pointer_cast<NoiseModelFactor>(graph.at(N + 1));
+  EXPECT(assert_equal(factor->unwhitenedError(values),
+                      Vector(errors.col(N + 1)), 1e-9));
+
+  // Keys are in the order given to add, rather than sorted, so compare the
+  // Jacobians of the whole graphs.
+  EXPECT(compareLinearized(graph, batch, values));
+}
+
+/* ************************************************************************* */
+TEST(ExpressionFactorBatch, Robust) {
+  const Values values = createValues();
+  auto model = noiseModel::Robust::Create(
+      noiseModel::mEstimator::Huber::Create(1.0),
+      noiseModel::Isotropic::Sigma(2, 0.5));
+  ExpressionFactorBatch<Point2> batch(model, projection(0, 1, 2));
+  NonlinearFactorGraph graph;
+  createFactors(batch, graph);
+
+  EXPECT_DOUBLES_EQUAL(graph.error(values), batch.error(values), 1e-6);
+  EXPECT(compareLinearized(graph, batch, values));
+}
+
+/* ************************************************************************* */
+TEST(ExpressionFactorBatch, Errors) {
+  auto model = noiseModel::Unit::Create(2);
+  CHECK_EXCEPTION(ExpressionFactorBatch<Point2>(noiseModel::Unit::Create(3),
+                                                projection(0, 1, 2)),
+                  std::invalid_argument);
+
+  ExpressionFactorBatch<Point2> batch(model, projection(0, 1, 2));
+  CHECK_EXCEPTION(batch.add(Point2(0, 0), {X(0), P(0)}), std::invalid_argument);
+  CHECK_EXCEPTION(batch.add(Point2(0, 0), {X(0), X(0), K(0)}),
+                  std::invalid_argument);
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
@@ -92,7 +92,7 @@ double absWeightOfEdge(const Key key1, const Key key2,
 
 // Removes a node from the graph and updates edge weights of its neighbors.
 void removeNodeFromGraph(const Key node,
-                         const map<MFAS::KeyPair, double> edgeWeights,
+                         const map<MFAS::KeyPair, double>& edgeWeights,
                          unordered_map<Key, GraphNode>& graph) {
   // Update the outweights and outNeighbors of node's inNeighbors
   for (const Key neighbor : graph[node].inNeighbors) {
@@ -438,6 +438,17 @@ NonlinearFactorGraph SfmData::sfmFactorGraph(
   return graph;
 }
 
+/* ************************************************************************** */
+std::vector<TriangulationResult> SfmData::triangulateTracks(
+    const TriangulationParameters &params) const {
+  return internal::triangulateTracks(
+      cameras, tracks.size(),
+      [this](size_t j) -> const std::vector<SfmMeasurement> & {
+        return tracks[j].measurements;
+      },
+      params);
+}
+
 /* ************************************************************************** */
 Values initialCamerasEstimate(const SfmData &db) {
   Values initial;
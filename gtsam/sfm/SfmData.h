@@ -20,6 +20,7 @@
 
 #include <gtsam/geometry/Cal3Bundler.h>
 #include <gtsam/geometry/PinholeCamera.h>
+#include <gtsam/geometry/triangulation.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/nonlinear/Values.h>
 #include <gtsam/sfm/SfmTrack.h>
@@ -107,6 +108,18 @@ struct GTSAM_EXPORT SfmData {
       boost::optional<size_t> fixedCamera = 0,
       boost::optional<size_t> fixedPoint = 0) const;
 
+  /**
+   * @brief Triangulate all tracks from their measurements in the cameras, in
+   * parallel, as triangulateTracks. The points stored in the tracks are not
+   * used or changed.
+   *
+   * @param params triangulation parameters, e.g., to refine the points and to
+   * reject far points and outliers
+   * @return a TriangulationResult for every track
+   */
+  std::vector<TriangulationResult> triangulateTracks(
+      const TriangulationParameters& params = TriangulationParameters()) const;
+
   /// @}
   /// @name Testable
   /// @{
@@ -18,6 +18,8 @@
 
 #include <SymEigsSolver.h>
 #include <cmath>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/linear/PCGSolver.h>
 #include <gtsam/linear/SubgraphPreconditioner.h>
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
@@ -27,8 +29,15 @@
 #include <gtsam/sfm/ShonanFactor.h>
 #include <gtsam/sfm/ShonanGaugeFactor.h>
 #include <gtsam/slam/FrobeniusFactor.h>
+#include <gtsam/slam/InitializePose.h>
+#include <gtsam/slam/InitializePose3.h>
 #include <gtsam/slam/KarcherMeanFactor-inl.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <Eigen/Eigenvalues>
 #include <algorithm>
 #include <complex>
@@ -56,7 +65,8 @@ ShonanAveragingParameters<d>::ShonanAveragingParameters(
       beta(beta),
       gamma(gamma),
       useHuber(false),
-      certifyOptimality(true) {
+      certifyOptimality(true),
+      speculativeLevels(1) {
   // By default, we will do conjugate gradient
   lm.linearSolverType = LevenbergMarquardtParams::Iterative;
 
@@ -439,6 +449,23 @@ Sparse ShonanAveraging<d>::buildQ() const {
   return Q;
 }
 
+/* ************************************************************************* */
+template <size_t d>
+Matrix ShonanAveraging<d>::computeLambdaBlocks(const Matrix &S) const {
+  // Do sparse-dense multiply to get Q*S'
+  const Matrix QSt = Q_ * S.transpose();
+
+  const size_t N = nrUnknowns();
+  Matrix blocks(d, d * N);
+  for (size_t j = 0; j < N; j++) {
+    // Compute B, the building block for the j^th diagonal block of Lambda
+    const size_t dj = d * j;
+    const Matrix B = QSt.middleRows(dj, d) * S.middleCols<d>(dj);
+    blocks.middleCols<d>(dj) = 0.5 * (B + B.transpose());
+  }
+  return blocks;
+}
+
 /* ************************************************************************* */
 template <size_t d>
 Sparse ShonanAveraging<d>::computeLambda(const Matrix &S) const {
@@ -450,18 +477,13 @@ Sparse ShonanAveraging<d>::computeLambda(const Matrix &S) const {
   std::vector<Eigen::Triplet<double>> triplets;
   triplets.reserve(stride * N);
 
-  // Do sparse-dense multiply to get Q*S'
-  auto QSt = Q_ * S.transpose();
-
+  const Matrix blocks = computeLambdaBlocks(S);
   for (size_t j = 0; j < N; j++) {
-    // Compute B, the building block for the j^th diagonal block of Lambda
-    const size_t dj = d * j;
-    Matrix B = QSt.middleRows(dj, d) * S.middleCols<d>(dj);
-
     // Elements of jth block-diagonal
+    const size_t dj = d * j;
     for (size_t r = 0; r < d; r++)
       for (size_t c = 0; c < d; c++)
-        triplets.emplace_back(dj + r, dj + c, 0.5 * (B(r, c) + B(c, r)));
+        triplets.emplace_back(dj + r, dj + c, blocks(r, dj + c));
   }
 
   // Construct and return a sparse matrix from these triplets
@@ -572,23 +594,31 @@ static bool PowerMinimumEigenValue(
 }
 
 /** This is a lightweight struct used in conjunction with Spectra to compute
- * the minimum eigenvalue and eigenvector of a sparse matrix A; it has a single
- * nontrivial function, perform_op(x,y), that computes and returns the product
- * y = (A + sigma*I) x */
-struct MatrixProdFunctor {
-  // Const reference to an externally-held matrix whose minimum-eigenvalue we
-  // want to compute
-  const Sparse &A_;
+ * the minimum eigenvalue and eigenvector of the certificate matrix
+ * A = Lambda - Q without forming it; it has a single nontrivial function,
+ * perform_op(x,y), that computes and returns the product y = (A + sigma*I) x.
+ * Lambda is given by its dense dxd diagonal blocks, and since Q is symmetric,
+ * row i of Q is read as column i of its column-major storage. This makes all
+ * block rows of y independent, and with TBB they are computed in parallel. */
+template <size_t d>
+struct CertificateOperator {
+  // Const references to externally-held Q and diagonal blocks of Lambda
+  const Sparse &Q_;
+  const Matrix &lambdaBlocks_;
 
   // Spectral shift
   double sigma_;
 
+  // Number of block rows per parallel task
+  static constexpr size_t kGrainSize = 256;
+
   // Constructor
-  explicit MatrixProdFunctor(const Sparse &A, double sigma = 0)
-      : A_(A), sigma_(sigma) {}
+  CertificateOperator(const Sparse &Q, const Matrix &lambdaBlocks,
+                      double sigma = 0)
+      : Q_(Q), lambdaBlocks_(lambdaBlocks), sigma_(sigma) {}
 
-  int rows() const { return A_.rows(); }
-  int cols() const { return A_.cols(); }
+  int rows() const { return Q_.rows(); }
+  int cols() const { return Q_.cols(); }
 
   // Matrix-vector multiplication operation
   void perform_op(const double *x, double *y) const {
@@ -596,8 +626,30 @@ struct MatrixProdFunctor {
     Eigen::Map<const Vector> X(x, rows());
     Eigen::Map<Vector> Y(y, rows());
 
-    // Do the multiplication using wrapped Eigen vectors
-    Y = A_ * X + sigma_ * X;
+    // Compute block rows [begin, end) of y
+    auto blockRows = [&](size_t begin, size_t end) {
+      for (size_t j = begin; j < end; j++) {
+        const size_t dj = d * j;
+        Y.segment<d>(dj) = lambdaBlocks_.middleCols<d>(dj) * X.segment<d>(dj) +
+                           sigma_ * X.segment<d>(dj);
+        for (size_t r = 0; r < d; r++) {
+          double qx = 0;
+          for (Sparse::InnerIterator it(Q_, dj + r); it; ++it)
+            qx += it.value() * X(it.row());
+          Y(dj + r) -= qx;
+        }
+      }
+    };
+
+    const size_t N = Q_.cols() / d;
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, N, kGrainSize),
+                      [&](const tbb::blocked_range<size_t> &range) {
+                        blockRows(range.begin(), range.end());
+                      });
+#else
+    blockRows(0, N);
+#endif
   }
 };
 
@@ -620,7 +672,9 @@ struct MatrixProdFunctor {
 /// the minimum eigenvector we're looking for whenever the relaxation is exact
 /// -- this is a key feature that helps to make this method fast.  Note that
 /// instead of passing in all of S, it would be enough to pass in one of S's
-/// *rows*, if that's more convenient.
+/// *rows*, if that's more convenient. Optionally, a warm start vector (e.g.,
+/// the minimum eigenvector at the previous level of the staircase) is used to
+/// seed the Lanczos iterations instead.
 
 // For the defaults, David Rosen says:
 //   - maxIterations refers to the max number of Lanczos iterations to run;
@@ -628,17 +682,22 @@ struct MatrixProdFunctor {
 //   - We've been using 10^-4 for the nonnegativity tolerance
 //   - for numLanczosVectors, 20 is a good default value
 
+template <size_t d>
 static bool SparseMinimumEigenValue(
-    const Sparse &A, const Matrix &S, double *minEigenValue,
-    Vector *minEigenVector = 0, size_t *numIterations = 0,
+    const Sparse &Q, const Matrix &lambdaBlocks, const Matrix &S,
+    double *minEigenValue, Vector *minEigenVector = 0,
+    const Vector *warmStart = 0, size_t *numIterations = 0,
     size_t maxIterations = 1000,
     double minEigenvalueNonnegativityTolerance = 10e-4,
     Eigen::Index numLanczosVectors = 20) {
+  using Operator = CertificateOperator<d>;
+  const Eigen::Index n = Q.rows();
+
   // a. Estimate the largest-magnitude eigenvalue of this matrix using Lanczos
-  MatrixProdFunctor lmOperator(A);
+  Operator lmOperator(Q, lambdaBlocks);
   Spectra::SymEigsSolver<double, Spectra::SELECT_EIGENVALUE::LARGEST_MAGN,
-                         MatrixProdFunctor>
-      lmEigenValueSolver(&lmOperator, 1, std::min(numLanczosVectors, A.rows()));
+                         Operator>
+      lmEigenValueSolver(&lmOperator, 1, std::min(numLanczosVectors, n));
   lmEigenValueSolver.init();
 
   const int lmConverged = lmEigenValueSolver.compute(
@@ -668,12 +727,12 @@ static bool SparseMinimumEigenValue(
   //  A - 2*lambda_max*I is minEigenValue - 2*lambda_max, with corresponding
   // eigenvector v_min
 
-  MatrixProdFunctor minShiftedOperator(A, -2 * lmEigenValue);
+  Operator minShiftedOperator(Q, lambdaBlocks, -2 * lmEigenValue);
 
   Spectra::SymEigsSolver<double, Spectra::SELECT_EIGENVALUE::LARGEST_MAGN,
-                         MatrixProdFunctor>
+                         Operator>
       minEigenValueSolver(&minShiftedOperator, 1,
-                          std::min(numLanczosVectors, A.rows()));
+                          std::min(numLanczosVectors, n));
 
   // If S is a critical point of F, then S^T is also in the null space of S -
   // Lambda(S) (cf. Lemma 6 of the tech report), and therefore its rows are
@@ -687,12 +746,20 @@ static bool SparseMinimumEigenValue(
   // Lanczos iterations; this allows for rapid convergence in the case that
   // the relaxation is exact (since are starting close to a solution), while
   // simultaneously allowing the iterations to escape from this fixed point in
-  // the case that the relaxation is not exact.
-  Vector v0 = S.row(0).transpose();
-  Vector perturbation(v0.size());
-  perturbation.setRandom();
-  perturbation.normalize();
-  Vector xinit = v0 + (.03 * v0.norm()) * perturbation;  // Perturb v0 by ~3%
+  // the case that the relaxation is not exact. If we are given a warm start,
+  // e.g., the minimum eigenvector of the certificate at the previous level of
+  // the staircase, which has the same dimension dN, we start from that
+  // instead, as the descent that follows it changes the certificate little.
+  Vector xinit;
+  if (warmStart && warmStart->size() == n && warmStart->norm() > 0) {
+    xinit = warmStart->normalized();
+  } else {
+    const Vector v0 = S.row(0).transpose();
+    Vector perturbation(v0.size());
+    perturbation.setRandom();
+    perturbation.normalize();
+    xinit = v0 + (.03 * v0.norm()) * perturbation;  // Perturb v0 by ~3%
+  }
 
   // Use this to initialize the eigensolver
   minEigenValueSolver.init(xinit.data());
@@ -718,13 +785,16 @@ static bool SparseMinimumEigenValue(
 /* ************************************************************************* */
 template <size_t d>
 double ShonanAveraging<d>::computeMinEigenValue(const Values &values,
-                                                Vector *minEigenVector) const {
+                                                Vector *minEigenVector,
+                                                const Vector *warmStart) const {
+  gttic(ShonanAveraging_computeMinEigenValue);
   assert(values.size() == nrUnknowns());
   const Matrix S = StiefelElementMatrix(values);
-  auto A = computeA(S);
+  const Matrix lambdaBlocks = computeLambdaBlocks(S);
 
   double minEigenValue;
-  bool success = SparseMinimumEigenValue(A, S, &minEigenValue, minEigenVector);
+  bool success = SparseMinimumEigenValue<d>(Q_, lambdaBlocks, S, &minEigenValue,
+                                            minEigenVector, warmStart);
   if (!success) {
     throw std::runtime_error(
         "SparseMinimumEigenValue failed to compute minimum eigenvalue.");
@@ -896,36 +966,62 @@ template <size_t d>
 std::pair<Values, double> ShonanAveraging<d>::run(const Values &initialEstimate,
                                                   size_t pMin,
                                                   size_t pMax) const {
-  Values Qstar;
+  gttic(ShonanAveraging_run);
   Values initialSOp = LiftTo<Rot>(pMin, initialEstimate);  // lift to pMin!
-  for (size_t p = pMin; p <= pMax; p++) {
-    // Optimize until convergence at this level
-    Qstar = tryOptimizingAt(p, initialSOp);
-    if (parameters_.getUseHuber() || !parameters_.getCertifyOptimality()) {
-      // in this case, there is no optimality certification
-      if (pMin != pMax) {
-        throw std::runtime_error(
-            "When using robust norm, Shonan only tests a single rank. Set pMin = pMax");
+  if (parameters_.getUseHuber() || !parameters_.getCertifyOptimality()) {
+    // in this case, there is no optimality certification
+    if (pMin != pMax) {
+      throw std::runtime_error(
+          "When using robust norm, Shonan only tests a single rank. Set pMin = pMax");
+    }
+    const Values SO3Values = roundSolution(tryOptimizingAt(pMin, initialSOp));
+    return std::make_pair(SO3Values, 0);
+  }
+
+  const size_t nrLevels = std::max<size_t>(1, parameters_.speculativeLevels);
+  Vector minEigenVector;  // at previous level, used to warm-start the next
+  for (size_t p = pMin; p <= pMax;) {
+    // Optimize at level p and, speculatively, at the levels above it, starting
+    // from the lifted initial estimate.
+    const size_t pLast = std::min(pMax, p + nrLevels - 1);
+    std::vector<Values> results(pLast - p + 1);
+    auto optimizeLevels = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++) {
+        results[i] = tryOptimizingAt(
+            p + i, i == 0 ? initialSOp : LiftTo<Rot>(p + i, initialEstimate));
       }
-      const Values SO3Values = roundSolution(Qstar);
-      return std::make_pair(SO3Values, 0);
-    } else {
-      // Check certificate of global optimality
-      Vector minEigenVector;
-      double minEigenValue = computeMinEigenValue(Qstar, &minEigenVector);
+    };
+    gttic(optimize);
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, results.size(), 1),
+                      [&](const tbb::blocked_range<size_t> &range) {
+                        optimizeLevels(range.begin(), range.end());
+                      });
+#else
+    optimizeLevels(0, results.size());
+#endif
+    gttoc(optimize);
+
+    // Check certificates of global optimality, lowest level first
+    double minEigenValue = 0;
+    for (const Values &Qstar : results) {
+      const Vector warmStart = minEigenVector;
+      minEigenValue = computeMinEigenValue(
+          Qstar, &minEigenVector, warmStart.size() ? &warmStart : nullptr);
       if (minEigenValue > parameters_.optimalityThreshold) {
         // If at global optimum, round and return solution
         const Values SO3Values = roundSolution(Qstar);
         return std::make_pair(SO3Values, minEigenValue);
       }
+    }
 
-      // Not at global optimimum yet, so check whether we will go to next level
-      if (p != pMax) {
-        // Calculate initial estimate for next level by following minEigenVector
-        initialSOp =
-            initializeWithDescent(p + 1, Qstar, minEigenVector, minEigenValue);
-      }
+    // Not at global optimimum yet, so check whether we will go to next level
+    if (pLast != pMax) {
+      // Calculate initial estimate for next level by following minEigenVector
+      initialSOp = initializeWithDescent(pLast + 1, results.back(),
+                                         minEigenVector, minEigenValue);
     }
+    p = pLast + 1;
   }
   throw std::runtime_error("Shonan::run did not converge for given pMax");
 }
@@ -1024,5 +1120,26 @@ ShonanAveraging3::ShonanAveraging3(const BetweenFactorPose3s &factors,
                                      parameters.getUseHuber()),
                          parameters) {}
 
+Values ShonanAveraging3::initializePartitioned(size_t nrParts) const {
+  gttic(ShonanAveraging3_initializePartitioned);
+  // Convert to a Pose3 graph, with the same rotation precision, and anchor the
+  // first key as InitializePose3 would for a prior.
+  NonlinearFactorGraph pose3Graph;
+  for (size_t k = 0; k < numberMeasurements(); ++k) {
+    const auto &measurement = this->measurement(k);
+    Vector precisions = Vector::Unit(3, 0);
+    measurement.noiseModel()->whitenInPlace(precisions);
+    pose3Graph.emplace_shared<BetweenFactor<Pose3>>(
+        measurement.key1(), measurement.key2(),
+        Pose3(measurement.measured(), Point3()),
+        noiseModel::Isotropic::Sigma(6, 1.0 / precisions[0]));
+  }
+  if (numberMeasurements() > 0)
+    pose3Graph.emplace_shared<BetweenFactor<Pose3>>(
+        initialize::kAnchorKey, keys(0).front(), Pose3(),
+        noiseModel::Unit::Create(6));
+  return InitializePose3::computeOrientationsPartitioned(pose3Graph, nrParts);
+}
+
 /* ************************************************************************* */
 }  // namespace gtsam
@@ -59,6 +59,8 @@ struct GTSAM_EXPORT ShonanAveragingParameters {
   bool useHuber;
   /// if enabled solution optimality is certified (default true)
   bool certifyOptimality;
+  /// number of levels of p that run() optimizes concurrently (default 1)
+  size_t speculativeLevels;
 
   ShonanAveragingParameters(const LevenbergMarquardtParams &lm =
                                 LevenbergMarquardtParams::CeresDefaults(),
@@ -90,6 +92,9 @@ struct GTSAM_EXPORT ShonanAveragingParameters {
   void setCertifyOptimality(bool value) { certifyOptimality = value; }
   bool getCertifyOptimality() const { return certifyOptimality; }
 
+  void setSpeculativeLevels(size_t value) { speculativeLevels = value; }
+  size_t getSpeculativeLevels() const { return speculativeLevels; }
+
   /// Print the parameters and flags used for rotation averaging.
   void print(const std::string &s = "") const {
     std::cout << (s.empty() ? s : s + " ");
@@ -98,6 +103,7 @@ struct GTSAM_EXPORT ShonanAveragingParameters {
     std::cout << " beta: " << beta << std::endl;
     std::cout << " gamma: " << gamma << std::endl;
     std::cout << " useHuber: " << useHuber << std::endl;
+    std::cout << " speculativeLevels: " << speculativeLevels << std::endl;
   }
 };
 
@@ -222,6 +228,9 @@ class GTSAM_EXPORT ShonanAveraging {
   /// Version that takes pxdN Stiefel manifold elements
   Sparse computeLambda(const Matrix &S) const;
 
+  /// Diagonal blocks of Lambda, as a dense dxdN matrix
+  Matrix computeLambdaBlocks(const Matrix &S) const;
+
   /// Dense versions of computeLambda for wrapper/testing
   Matrix computeLambda_(const Values &values) const {
     return Matrix(computeLambda(values));
@@ -248,10 +257,18 @@ class GTSAM_EXPORT ShonanAveraging {
 
   /**
    * Compute minimum eigenvalue for optimality check.
+   * The certificate matrix A = Lambda - Q is never formed: Lanczos iterations
+   * apply the block-diagonal Lambda and the stored sparse Q directly, in
+   * parallel over block rows if TBB is enabled.
    * @param values: should be of type SOn
+   * @param minEigenVector: optional output, the minimum eigenvector
+   * @param warmStart: optional dN vector, e.g. the minimum eigenvector at the
+   *   previous level, used to initialize the Lanczos iterations instead of a
+   *   perturbed row of the Stiefel element matrix.
    */
   double computeMinEigenValue(const Values &values,
-                              Vector *minEigenVector = nullptr) const;
+                              Vector *minEigenVector = nullptr,
+                              const Vector *warmStart = nullptr) const;
 
   /**
    * Compute minimum eigenvalue with accelerated power method.
@@ -395,6 +412,9 @@ class GTSAM_EXPORT ShonanAveraging {
 
   /**
    * Optimize at different values of p until convergence.
+   * If parameters.speculativeLevels > 1, levels p+1 and up are optimized
+   * concurrently with level p, starting from the lifted initial estimate, and
+   * the lowest level that passes the optimality certificate is returned.
    * @param initial initial Rot3 values
    * @param pMin value of p to start Riemanian staircase at (default: d).
    * @param pMax maximum value of p to try (default: 10)
@@ -444,5 +464,15 @@ class GTSAM_EXPORT ShonanAveraging3 : public ShonanAveraging<3> {
   // TODO(frank): Deprecate after we land pybind wrapper
   ShonanAveraging3(const BetweenFactorPose3s &factors,
                    const Parameters &parameters = Parameters());
+
+  /**
+   * Initialize with the partitioned chordal relaxation of
+   * InitializePose3::computeOrientationsPartitioned: the measurement graph is
+   * split into nrParts parts, which are solved in parallel and then aligned.
+   * Intended as the initial estimate for run() on very large problems.
+   * @param nrParts number of parts, 1 solves the chordal relaxation at once.
+   * @return Rot3 values, with the first key fixed to the identity.
+   */
+  Values initializePartitioned(size_t nrParts) const;
 };
 }  // namespace gtsam
@@ -17,18 +17,30 @@
  */
 
 #include <gtsam/base/DSFMap.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/geometry/Point3.h>
 #include <gtsam/geometry/Pose3.h>
 #include <gtsam/geometry/Unit3.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/NoiseModel.h>
 #include <gtsam/nonlinear/LevenbergMarquardtOptimizer.h>
 #include <gtsam/nonlinear/NonlinearFactor.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 #include <gtsam/nonlinear/Values.h>
+#include <gtsam/sfm/MFAS.h>
 #include <gtsam/sfm/TranslationFactor.h>
 #include <gtsam/sfm/TranslationRecovery.h>
 #include <gtsam/slam/PriorFactor.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
+#include <cmath>
+#include <map>
+#include <random>
 #include <set>
 #include <utility>
 
@@ -115,10 +127,69 @@ Values TranslationRecovery::initalizeRandomly() const {
   return initial;
 }
 
-Values TranslationRecovery::run(const double scale) const {
+Values TranslationRecovery::initializeLinear(const double scale) const {
+  gttic(TranslationRecovery_initializeLinear);
+  GaussianFactorGraph linearGraph;
+  linearGraph.reserve(3 * relativeTranslations_.size() + 2);
+  KeySet keys;
+  for (const auto &edge : relativeTranslations_) {
+    const Point3 u = edge.measured().point3();
+    Matrix P = I_3x3 - u * u.transpose();
+    if (auto gaussian = boost::dynamic_pointer_cast<noiseModel::Gaussian>(
+            edge.noiseModel()))
+      gaussian->WhitenInPlace(P);
+    linearGraph.add(edge.key1(), -P, edge.key2(), P, Z_3x1);
+    keys.insert(edge.key1());
+    keys.insert(edge.key2());
+  }
+
+  // Weak priors towards the origin fix directions that are not constrained,
+  // e.g., a chain of collinear edges. They pull the estimate slightly towards
+  // the origin, which the optimization in run() undoes, as it does not include
+  // them.
+  const auto weakModel = noiseModel::Isotropic::Sigma(3, 1e3);
+  for (Key key : keys) linearGraph.add(key, I_3x3, Z_3x1, weakModel);
+
+  // Gauge priors on the endpoints of the first edge, as in addPrior, weighted
+  // with the noise model of that edge.
+  auto edge = relativeTranslations_.begin();
+  if (edge != relativeTranslations_.end()) {
+    Matrix A = I_3x3;
+    Vector b1 = Z_3x1, b2 = scale * edge->measured().point3();
+    if (auto gaussian = boost::dynamic_pointer_cast<noiseModel::Gaussian>(
+            edge->noiseModel())) {
+      gaussian->WhitenInPlace(A);
+      b2 = gaussian->whiten(b2);
+    }
+    linearGraph.add(edge->key1(), A, b1);
+    linearGraph.add(edge->key2(), A, b2);
+  }
+
+  Values initial;
+  for (const auto &key_value : linearGraph.optimize())
+    initial.insert<Point3>(key_value.first, key_value.second);
+
+  // As in initalizeRandomly, initialize isolated zero-distance components.
+  if (initial.empty() && !sameTranslationNodes_.empty()) {
+    for (const auto &optimizedAndDuplicateKeys : sameTranslationNodes_) {
+      Key optimizedKey = optimizedAndDuplicateKeys.first;
+      initial.insert<Point3>(optimizedKey, Point3(0, 0, 0));
+    }
+  }
+  return initial;
+}
+
+Values TranslationRecovery::run(const double scale,
+                                bool filterOutliers) const {
+  gttic(TranslationRecovery_run);
+  if (filterOutliers) {
+    TranslationRecovery inlierRecovery(*this);
+    inlierRecovery.relativeTranslations_ = FilterOutliers(relativeTranslations_);
+    return inlierRecovery.run(scale, false);
+  }
   auto graph = buildGraph();
   addPrior(scale, &graph);
-  const Values initial = initalizeRandomly();
+  const Values initial = initializeLinear(scale);
   LevenbergMarquardtOptimizer lm(graph, initial, params_);
   Values result = lm.optimize();
 
@@ -137,6 +208,123 @@ Values TranslationRecovery::run(const double scale) const {
   return result;
 }
 
+TranslationRecovery::TranslationEdges TranslationRecovery::FilterOutliers(
+    const TranslationEdges &relativeTranslations, size_t nrDirections,
+    double outlierThreshold, std::uint32_t seed, double maxResidualAngle) {
+  gttic(TranslationRecovery_FilterOutliers);
+  if (relativeTranslations.empty() || nrDirections == 0)
+    return relativeTranslations;
+
+  // Sample projection directions uniformly on the sphere, as normalized
+  // Gaussian vectors, so that every edge is seen by most of them, whatever
+  // the distribution of the measured directions.
+  std::mt19937 rng(seed);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  vector<Unit3> directions;
+  directions.reserve(nrDirections);
+  while (directions.size() < nrDirections) {
+    const Point3 v(normal(rng), normal(rng), normal(rng));
+    if (v.norm() > 1e-9) directions.emplace_back(v);
+  }
+
+  // The MFAS problems are posed on key pairs, so several measurements between
+  // the same cameras would share one weight. Sum their projections into one
+  // edge per pair, and give every measurement its own outlier weight, i.e.,
+  // its projection if it points against the MFAS ordering.
+  const size_t nrEdges = relativeTranslations.size();
+  auto outlierWeightsAlong = [&](const Unit3 &direction) {
+    vector<double> projections(nrEdges);
+    std::map<MFAS::KeyPair, double> pairWeights;
+    for (size_t e = 0; e < nrEdges; ++e) {
+      const auto &edge = relativeTranslations[e];
+      projections[e] = edge.measured().dot(direction);
+      if (edge.key1() < edge.key2())
+        pairWeights[MFAS::KeyPair(edge.key1(), edge.key2())] += projections[e];
+      else
+        pairWeights[MFAS::KeyPair(edge.key2(), edge.key1())] -= projections[e];
+    }
+    const KeyVector ordering = MFAS(pairWeights).computeOrdering();
+    std::map<Key, size_t> position;
+    for (size_t i = 0; i < ordering.size(); ++i) position[ordering[i]] = i;
+    vector<double> weights(nrEdges, 0.0);
+    for (size_t e = 0; e < nrEdges; ++e) {
+      const auto &edge = relativeTranslations[e];
+      const bool forward = position.at(edge.key1()) < position.at(edge.key2());
+      if (forward != (projections[e] >= 0))
+        weights[e] = std::abs(projections[e]);
+    }
+    return weights;
+  };
+
+  // Sum the outlier weights over all directions, solving the MFAS problems in
+  // parallel. The reduction splits and joins the directions in a fixed order,
+  // so the sums do not depend on the scheduling.
+  auto accumulate = [&](size_t begin, size_t end, vector<double> sums) {
+    for (size_t k = begin; k < end; ++k) {
+      const vector<double> weights = outlierWeightsAlong(directions[k]);
+      for (size_t e = 0; e < nrEdges; ++e) sums[e] += weights[e];
+    }
+    return sums;
+  };
+#ifdef GTSAM_USE_TBB
+  const vector<double> outlierWeights = tbb::parallel_deterministic_reduce(
+      tbb::blocked_range<size_t>(0, nrDirections, 1),
+      vector<double>(nrEdges, 0.0),
+      [&](const tbb::blocked_range<size_t> &range, vector<double> sums) {
+        return accumulate(range.begin(), range.end(), std::move(sums));
+      },
+      [nrEdges](vector<double> a, const vector<double> &b) {
+        for (size_t e = 0; e < nrEdges; ++e) a[e] += b[e];
+        return a;
+      });
+#else
+  const vector<double> outlierWeights =
+      accumulate(0, nrDirections, vector<double>(nrEdges, 0.0));
+#endif
+
+  TranslationEdges candidates;
+  for (size_t e = 0; e < relativeTranslations.size(); ++e)
+    if (outlierWeights[e] / nrDirections < outlierThreshold)
+      candidates.push_back(relativeTranslations[e]);
+  if (candidates.empty() || maxResidualAngle >= M_PI) return candidates;
+
+  // An outlier can be consistent with all projections, e.g., a short edge that
+  // is reversed, as its projection is always longer than the projections of
+  // the edges that would contradict it. Check the directions against the
+  // translations estimated from all remaining edges by initializeLinear. Its
+  // constraints do not depend on the sign of the directions, so the sign of
+  // the estimate is chosen to agree with most of them.
+  const TranslationRecovery recovery(candidates);
+  const Values translations = recovery.initializeLinear();
+  std::map<Key, Key> optimizedKey;
+  for (const auto &optimizedAndDuplicateKeys : recovery.sameTranslationNodes_)
+    for (Key duplicateKey : optimizedAndDuplicateKeys.second)
+      optimizedKey[duplicateKey] = optimizedAndDuplicateKeys.first;
+  auto translation = [&](Key key) {
+    const auto it = optimizedKey.find(key);
+    return translations.at<Point3>(it == optimizedKey.end() ? key : it->second);
+  };
+  vector<Point3> estimated;
+  estimated.reserve(candidates.size());
+  double sign = 0.0;
+  for (const auto &edge : candidates) {
+    estimated.push_back(translation(edge.key2()) - translation(edge.key1()));
+    sign += edge.measured().point3().dot(estimated.back());
+  }
+  sign = sign < 0 ? -1.0 : 1.0;
+
+  TranslationEdges inliers;
+  const double minCosine = std::cos(maxResidualAngle);
+  for (size_t e = 0; e < candidates.size(); ++e) {
+    const double norm = estimated[e].norm();
+    if (norm < 1e-9 ||
+        sign * candidates[e].measured().point3().dot(estimated[e]) >=
+            minCosine * norm)
+      inliers.push_back(candidates[e]);
+  }
+  return inliers;
+}
+
 TranslationRecovery::TranslationEdges TranslationRecovery::SimulateMeasurements(
     const Values &poses, const vector<KeyPair> &edges) {
   auto edgeNoiseModel = noiseModel::Isotropic::Sigma(3, 0.01);
@@ -16,6 +16,7 @@
  * @brief Recovering translations in an epipolar graph when rotations are given.
  */
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <utility>
@@ -105,12 +106,50 @@ class TranslationRecovery {
   Values initalizeRandomly() const;
 
   /**
-   * @brief Build and optimize factor graph.
+   * @brief Initialize translations by a sparse linear least-squares solve.
+   * The constraint that Tb - Ta is parallel to w_aZb is linear in the
+   * translations, (I - w_aZb w_aZb^T) (Tb - Ta) = 0, and together with the
+   * gauge priors of addPrior this gives a sparse linear system that is solved
+   * by elimination. A weak prior on every translation keeps it well-posed.
    *
    * @param scale scale for first relative translation which fixes gauge.
    * @return Values
    */
-  Values run(const double scale = 1.0) const;
+  Values initializeLinear(const double scale = 1.0) const;
+
+  /**
+   * @brief Build and optimize factor graph, starting from initializeLinear.
+   *
+   * @param scale scale for first relative translation which fixes gauge.
+   * @param filterOutliers if true, first remove outlier edges with
+   * FilterOutliers, with its default parameters. The scale then applies to the
+   * first inlier edge, and cameras without inlier edges are not estimated.
+   * @return Values
+   */
+  Values run(const double scale = 1.0, bool filterOutliers = false) const;
+
+  /**
+   * @brief Remove outlier translation directions with 1DSfM, i.e., by solving
+   * MFAS problems for many projection directions. The directions are sampled
+   * uniformly on the sphere, the MFAS problems are solved in parallel,
+   * and an edge is removed when its outlier weight, averaged over all
+   * directions, exceeds the threshold. The remaining edges are then checked
+   * against the translations initializeLinear estimates from all of them,
+   * which catches outliers that no projection contradicts, e.g., short edges
+   * that are reversed.
+   *
+   * @param relativeTranslations the relative translation directions.
+   * @param nrDirections number of projection directions.
+   * @param outlierThreshold threshold on the average outlier weight.
+   * @param seed seed for sampling projection directions.
+   * @param maxResidualAngle largest angle, in radians, between a measured
+   * direction and the estimated one; the check is skipped if >= pi.
+   * @return TranslationEdges the inlier edges, in their original order.
+   */
+  static TranslationEdges FilterOutliers(
+      const TranslationEdges &relativeTranslations, size_t nrDirections = 48,
+      double outlierThreshold = 0.125, std::uint32_t seed = 42,
+      double maxResidualAngle = 0.5);
 
   /**
    * @brief Simulate translation direction measurements
@@ -227,6 +227,7 @@ class ShonanAveraging3 {
   // Basic API
   double cost(const gtsam::Values& values) const;
   gtsam::Values initializeRandomly() const;
+  gtsam::Values initializePartitioned(size_t nrParts) const;
   pair<gtsam::Values, double> run(const gtsam::Values& initial, size_t min_p,
                                   size_t max_p) const;
 };
@@ -259,8 +260,12 @@ class TranslationRecovery {
   TranslationRecovery(
       const gtsam::BinaryMeasurementsUnit3&
           relativeTranslations);  // default LevenbergMarquardtParams
+  gtsam::Values initializeLinear(const double scale) const;
+  gtsam::Values run(const double scale, bool filterOutliers) const;
   gtsam::Values run(const double scale) const;
   gtsam::Values run() const;  // default scale = 1.0
+  static gtsam::BinaryMeasurementsUnit3 FilterOutliers(
+      const gtsam::BinaryMeasurementsUnit3& relativeTranslations);
 };
 
 }  // namespace gtsam
@@ -206,6 +206,28 @@ TEST(dataSet, writeBALfromValues_Dubrovnik) {
   EXPECT(assert_equal(expectedPoint, actualPoint, 1e-6));
 }
 
+/* ************************************************************************* */
+TEST(SfmData, triangulateTracks) {
+  const string filename = findExampleDataFile("dubrovnik-3-7-pre");
+  const SfmData sfmData = SfmData::FromBalFile(filename);
+  const TriangulationParameters params;
+  const auto results = sfmData.triangulateTracks(params);
+  EXPECT_LONGS_EQUAL(sfmData.numberTracks(), results.size());
+
+  // Same as triangulating every track on its own
+  for (size_t j = 0; j < sfmData.numberTracks(); j++) {
+    CameraSet<SfmCamera> cameras;
+    Point2Vector measured;
+    for (const SfmMeasurement& measurement : sfmData.tracks[j].measurements) {
+      cameras.push_back(sfmData.cameras[measurement.first]);
+      measured.push_back(measurement.second);
+    }
+    const auto expected = triangulateSafe(cameras, measured, params);
+    EXPECT(expected.valid() == results[j].valid());
+    if (expected) EXPECT(assert_equal(*expected, *results[j], 1e-9));
+  }
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
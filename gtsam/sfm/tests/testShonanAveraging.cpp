@@ -236,6 +236,71 @@ TEST(ShonanAveraging3, run) {
                        1e-4); // Regression test
 }
 
+/* ************************************************************************* */
+TEST(ShonanAveraging3, computeLambdaBlocks) {
+  const Values random = kShonan.initializeRandomlyAt(4, kRandomNumberGenerator);
+  const Matrix S = ShonanAveraging3::StiefelElementMatrix(random);
+  const Matrix Lambda = kShonan.computeLambda_(S);
+  const Matrix blocks = kShonan.computeLambdaBlocks(S);
+  for (size_t j = 0; j < kShonan.nrUnknowns(); j++) {
+    EXPECT(assert_equal(Matrix(Lambda.block<3, 3>(3 * j, 3 * j)),
+                        Matrix(blocks.middleCols<3>(3 * j))));
+  }
+}
+
+/* ************************************************************************* */
+TEST(ShonanAveraging3, computeMinEigenValueWarmStart) {
+  // At a random point, the certificate has a negative minimum eigenvalue
+  const Values random = kShonan.initializeRandomlyAt(4, kRandomNumberGenerator);
+  Vector minEigenVector;
+  const double lambda = kShonan.computeMinEigenValue(random, &minEigenVector);
+
+  // Compare with dense Eigen solution
+  const Matrix A = kShonan.computeA_(random);
+  Eigen::SelfAdjointEigenSolver<Matrix> eigenSolver(A);
+  EXPECT_DOUBLES_EQUAL(eigenSolver.eigenvalues()(0), lambda, 1e-4);
+  EXPECT_DOUBLES_EQUAL(lambda, minEigenVector.dot(A * minEigenVector), 1e-4);
+
+  // Warm-starting from the eigenvector gives the same answer
+  const double warmLambda =
+      kShonan.computeMinEigenValue(random, nullptr, &minEigenVector);
+  EXPECT_DOUBLES_EQUAL(lambda, warmLambda, 1e-4);
+
+  // As does warm-starting from the eigenvector at another level
+  const Values random5 =
+      kShonan.initializeRandomlyAt(5, kRandomNumberGenerator);
+  Vector minEigenVector5;
+  kShonan.computeMinEigenValue(random5, &minEigenVector5);
+  const double lambda5 =
+      kShonan.computeMinEigenValue(random, nullptr, &minEigenVector5);
+  EXPECT_DOUBLES_EQUAL(lambda, lambda5, 1e-4);
+}
+
+/* ************************************************************************* */
+TEST(ShonanAveraging3, runSpeculative) {
+  auto parameters = ShonanAveraging3::Parameters();
+  parameters.setSpeculativeLevels(3);
+  const auto shonan = fromExampleName("toyExample.g2o", parameters);
+  auto initial = shonan.initializeRandomly(kRandomNumberGenerator);
+  auto result = shonan.run(initial, 3, 7);
+  EXPECT_DOUBLES_EQUAL(0, shonan.cost(result.first), 1e-3);
+  EXPECT(result.second > parameters.getOptimalityThreshold());
+}
+
+/* ************************************************************************* */
+TEST(ShonanAveraging3, initializePartitioned) {
+  // Partitioned and monolithic chordal initialization agree on a small graph.
+  const Values chordal = kShonan.initializePartitioned(1);
+  EXPECT_LONGS_EQUAL(5, chordal.size());
+  const Values partitioned = kShonan.initializePartitioned(2);
+  EXPECT_LONGS_EQUAL(5, partitioned.size());
+  EXPECT_DOUBLES_EQUAL(kShonan.cost(chordal), kShonan.cost(partitioned), 0.1);
+
+  // And the staircase converges from there.
+  auto result = kShonan.run(partitioned, 3, 5);
+  EXPECT_DOUBLES_EQUAL(0, kShonan.cost(result.first), 1e-4);
+}
+
 /* ************************************************************************* */
 namespace klaus {
 // The data in the file is the Colmap solution
@@ -114,6 +114,12 @@ namespace gtsam {
 #endif
     }
 
+    /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+    bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+      return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+    }
+
     /// @}
     /// @name Standard interface 
     /// @{
@@ -25,10 +25,29 @@
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/geometry/Pose2.h>
 #include <gtsam/geometry/Pose3.h>
+#include <gtsam/linear/linearExceptions.h>
 #include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB, GTSAM_SUPPORT_NESTED_DISSECTION
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+#include <metis.h>
+#endif
+
+#include <boost/make_shared.hpp>
 #include <boost/math/special_functions.hpp>
 
+#include <Eigen/Sparse>
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 using namespace std;
@@ -101,50 +120,248 @@ NonlinearFactorGraph InitializePose3::buildPose3graph(
 }
 
 /* ************************************************************************* */
-Values InitializePose3::computeOrientationsChordal(
-    const NonlinearFactorGraph& pose3Graph) {
-  gttic(InitializePose3_computeOrientationsChordal);
+namespace {
+// Precision of the rotation part of a BetweenFactor<Pose3>, as used in
+// buildLinearOrientationGraph.
+double rotationPrecision(const BetweenFactor<Pose3>& factor) {
+  Vector precisions = Vector::Zero(6);
+  precisions[0] = 1.0;
+  factor.noiseModel()->whitenInPlace(precisions);
+  return precisions[0];
+}
 
-  // regularize measurements and plug everything in a factor graph
-  GaussianFactorGraph relaxedGraph = buildLinearOrientationGraph(pose3Graph);
+// Union-find root with path halving.
+size_t findRoot(vector<size_t>* parent, size_t i) {
+  while ((*parent)[i] != i) i = (*parent)[i] = (*parent)[(*parent)[i]];
+  return i;
+}
 
-  // Solve the LFG
-  VectorValues relaxedRot3 = relaxedGraph.optimize();
+// Call f(i) for i in [0, n), in parallel if TBB is available.
+template <class FUNCTION>
+void parallelFor(size_t n, const FUNCTION& f) {
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                    [&f](const tbb::blocked_range<size_t>& range) {
+                      for (size_t i = range.begin(); i < range.end(); ++i) f(i);
+                    });
+#else
+  for (size_t i = 0; i < n; ++i) f(i);
+#endif
+}
 
-  // normalize and compute Rot3
-  return normalizeRelaxedRotations(relaxedRot3);
+// Maximum number of gradient iterations refining the stitched orientations,
+// and the number of edges away from the cut up to which they are refined, see
+// InitializePose3::computeOrientationsPartitioned.
+const size_t kMaxRefinementIterations = 100;
+const size_t kRefinementHops = 2;
+
+// Return the between factors of a graph including only BetweenFactors<Pose3>,
+// throws std::invalid_argument if it contains any other factor.
+vector<BetweenFactor<Pose3>::shared_ptr> pose3BetweenFactors(
+    const NonlinearFactorGraph& pose3Graph, const string& caller) {
+  vector<BetweenFactor<Pose3>::shared_ptr> factors;
+  factors.reserve(pose3Graph.size());
+  for (const auto& factor : pose3Graph) {
+    auto between = boost::dynamic_pointer_cast<BetweenFactor<Pose3> >(factor);
+    if (!between)
+      throw std::invalid_argument(
+          caller + ": the graph can only contain BetweenFactor<Pose3>");
+    factors.push_back(between);
+  }
+  return factors;
 }
+}  // namespace
 
 /* ************************************************************************* */
-Values InitializePose3::computeOrientationsGradient(
-    const NonlinearFactorGraph& pose3Graph, const Values& givenGuess,
-    const size_t maxIter, const bool setRefFrame) {
-  gttic(InitializePose3_computeOrientationsGradient);
+struct ChordalRelaxationSolver::Impl {
+  typedef Eigen::SparseMatrix<double> Sparse;
+
+  KeyVector keys;  ///< sorted keys, including the anchor key
+  vector<std::pair<int, int> > edges;  ///< edge endpoints, as indices
+  Eigen::SimplicialLDLT<Sparse> ldlt;
+  size_t nrSymbolic = 0;
+};
+
+/* ************************************************************************* */
+ChordalRelaxationSolver::ChordalRelaxationSolver() : impl_(new Impl) {}
+
+/* ************************************************************************* */
+ChordalRelaxationSolver::~ChordalRelaxationSolver() {}
+
+/* ************************************************************************* */
+size_t ChordalRelaxationSolver::nrSymbolicFactorizations() const {
+  return impl_->nrSymbolic;
+}
 
+/* ************************************************************************* */
+Values ChordalRelaxationSolver::solve(const NonlinearFactorGraph& pose3Graph) {
+  gttic(ChordalRelaxationSolver_solve);
+
+  // Collect the between factors, and the keys they involve.
+  const vector<BetweenFactor<Pose3>::shared_ptr> factors =
+      pose3BetweenFactors(pose3Graph, "ChordalRelaxationSolver::solve");
+  KeyVector keys(1, initialize::kAnchorKey);
+  for (const auto& factor : factors) {
+    keys.push_back(factor->key1());
+    keys.push_back(factor->key2());
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+  auto indexOf = [&keys](Key key) {
+    return static_cast<int>(std::lower_bound(keys.begin(), keys.end(), key) -
+                            keys.begin());
+  };
+  vector<std::pair<int, int> > edges;
+  edges.reserve(factors.size());
+  for (const auto& factor : factors)
+    edges.emplace_back(indexOf(factor->key1()), indexOf(factor->key2()));
+
+  // Normal equations of one column of the relaxation. An edge i-j with
+  // precision w contributes w * |Rij * cj - ci|^2, and the anchor prior
+  // |ca - ek|^2 for column k.
+  const int n = keys.size(), anchor = indexOf(initialize::kAnchorKey);
+  vector<Eigen::Triplet<double> > triplets;
+  triplets.reserve(24 * factors.size() + 3);
+  auto addDiagonal = [&triplets](int i, double w) {
+    for (int r = 0; r < 3; r++) triplets.emplace_back(3 * i + r, 3 * i + r, w);
+  };
+  vector<double> weights(factors.size());
+  for (size_t e = 0; e < factors.size(); e++) {
+    const int i = edges[e].first, j = edges[e].second;
+    const double w = weights[e] = rotationPrecision(*factors[e]);
+    const Matrix3 Rij = factors[e]->measured().rotation().matrix();
+    addDiagonal(i, w);
+    addDiagonal(j, w);
+    for (int r = 0; r < 3; r++)
+      for (int c = 0; c < 3; c++) {
+        triplets.emplace_back(3 * i + r, 3 * j + c, -w * Rij(r, c));
+        triplets.emplace_back(3 * j + c, 3 * i + r, -w * Rij(r, c));
+      }
+  }
+  addDiagonal(anchor, 1.0);
+
+  // The relaxation is singular if some key is not connected to the anchor by
+  // edges with non-zero precision.
+  vector<size_t> parent(n);
+  std::iota(parent.begin(), parent.end(), 0);
+  for (size_t e = 0; e < factors.size(); e++)
+    if (weights[e] > 0)
+      parent[findRoot(&parent, edges[e].first)] =
+          findRoot(&parent, edges[e].second);
+  for (int i = 0; i < n; i++)
+    if (findRoot(&parent, i) != findRoot(&parent, anchor))
+      throw IndeterminantLinearSystemException(keys[i]);
+  Impl::Sparse A(3 * n, 3 * n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+
+  // Re-use the symbolic factorization if the structure did not change.
+  Impl& impl = *impl_;
+  if (impl.nrSymbolic == 0 || keys != impl.keys || edges != impl.edges) {
+    gttic(symbolic);
+    impl.ldlt.analyzePattern(A);
+    impl.keys = std::move(keys);
+    impl.edges = std::move(edges);
+    impl.nrSymbolic++;
+  }
+  {
+    gttic(numeric);
+    impl.ldlt.factorize(A);
+  }
+  if (impl.ldlt.info() != Eigen::Success)
+    throw IndeterminantLinearSystemException(initialize::kAnchorKey);
+
+  Matrix B = Matrix::Zero(3 * n, 3);
+  B.block<3, 3>(3 * anchor, 0) = I_3x3;
+  const Matrix X = impl.ldlt.solve(B);
+
+  // Column k of the relaxed rotation of key i is X.block(3 * i, k), normalize
+  // the relaxed rotations, as in normalizeRelaxedRotations.
+  Values validRot3;
+  for (int i = 0; i < n; i++)
+    if (i != anchor) {
+      const Matrix3 M = X.block<3, 3>(3 * i, 0);
+      validRot3.insert(impl.keys[i], Rot3::ClosestTo(M.transpose()));
+    }
+  return validRot3;
+}
+
+/* ************************************************************************* */
+Values InitializePose3::computeOrientationsChordal(
+    const NonlinearFactorGraph& pose3Graph) {
+  return computeOrientationsChordal(pose3Graph, nullptr);
+}
+
+/* ************************************************************************* */
+Values InitializePose3::computeOrientationsChordal(
+    const NonlinearFactorGraph& pose3Graph, ChordalRelaxationSolver* solver) {
+  gttic(InitializePose3_computeOrientationsChordal);
+  if (solver) return solver->solve(pose3Graph);
+  ChordalRelaxationSolver localSolver;
+  return localSolver.solve(pose3Graph);
+}
+
+/* ************************************************************************* */
+namespace {
+// The gradient iterations of InitializePose3::computeOrientationsGradient,
+// keeping the rotations of the given fixed keys at their initial values.
+Values gradientIterations(const NonlinearFactorGraph& pose3Graph,
+                          const Values& givenGuess, const size_t maxIter,
+                          const bool setRefFrame, const KeySet& fixed) {
   // this works on the inverse rotations, according to Tron&Vidal,2011
-  Values inverseRot;
-  inverseRot.insert(initialize::kAnchorKey, Rot3());
+  Values inverseRotValues;
+  inverseRotValues.insert(initialize::kAnchorKey, Rot3());
   for(const auto key_value: givenGuess) {
     Key key = key_value.key;
     const Pose3& pose = givenGuess.at<Pose3>(key);
-    inverseRot.insert(key, pose.rotation().inverse());
+    inverseRotValues.insert(key, pose.rotation().inverse());
   }
+  const KeyVector keys = inverseRotValues.keys();
+  const size_t n = keys.size();
+  vector<Rot3> inverseRot;
+  inverseRot.reserve(n);
+  for (const auto key_value : inverseRotValues)
+    inverseRot.push_back(key_value.value.cast<Rot3>());
 
   // Create the map of edges incident on each node
   KeyVectorMap adjEdgesMap;
   KeyRotMap factorId2RotMap;
 
-  createSymbolicGraph(pose3Graph, &adjEdgesMap, &factorId2RotMap);
+  InitializePose3::createSymbolicGraph(pose3Graph, &adjEdgesMap,
+                                       &factorId2RotMap);
 
-  // calculate max node degree & allocate gradient
+  // Flatten the edges incident on each node i into arrays, storing for every
+  // edge the index of the other node j and the rotation Sij such that the
+  // gradient pulls Ri towards Sij * Rj.
+  vector<size_t> offsets(1, 0), others;
+  vector<Rot3> relative;
   size_t maxNodeDeg = 0;
-  VectorValues grad;
-  for(const auto key_value: inverseRot) {
-    Key key = key_value.key;
-    grad.insert(key,Z_3x1);
-    size_t currNodeDeg = (adjEdgesMap.at(key)).size();
-    if(currNodeDeg > maxNodeDeg)
-      maxNodeDeg = currNodeDeg;
+  vector<bool> isFixed(n, false);
+  for (size_t i = 0; i < n; ++i) {
+    const Key key = keys[i];
+    isFixed[i] = fixed.count(key) > 0;
+    const auto adjEdges = adjEdgesMap.find(key);
+    if (adjEdges == adjEdgesMap.end()) {
+      offsets.push_back(others.size());
+      continue;
+    }
+    for (const size_t& factorId : adjEdges->second) {
+      const Rot3& Rij = factorId2RotMap.at(factorId);
+      const auto& factorKeys = pose3Graph.at(factorId)->keys();
+      Key other;
+      if (key == factorKeys[0]) {
+        other = factorKeys[1];
+        relative.push_back(Rij);
+      } else {
+        other = factorKeys[0];
+        relative.push_back(Rij.inverse());
+      }
+      const auto it = std::lower_bound(keys.begin(), keys.end(), other);
+      if (it == keys.end() || *it != other)
+        throw ValuesKeyDoesNotExist("retrieve", other);
+      others.push_back(it - keys.begin());
+    }
+    maxNodeDeg = std::max(maxNodeDeg, others.size() - offsets.back());
+    offsets.push_back(others.size());
   }
 
   // Create parameters
@@ -155,44 +372,40 @@ Values InitializePose3::computeOrientationsGradient(
   double mu_max = maxNodeDeg * rho;
   double stepsize = 2/mu_max; // = 1/(a b dG)
 
+  // The gradient at every node only depends on the previous estimates, so
+  // all nodes are updated at once, in parallel (Jacobi-style).
+  vector<Vector3> grad(n);
+  vector<double> normGrad(n);
+  auto computeGradient = [&](size_t i) {
+    if (isFixed[i]) {
+      grad[i].setZero();
+      normGrad[i] = 0.0;
+      return;
+    }
+    Vector3 gradKey = Z_3x1;
+    // collect the gradient for each edge incident on key
+    for (size_t e = offsets[i]; e < offsets[i + 1]; e++)
+      gradKey += InitializePose3::gradientTron(
+          inverseRot[i], relative[e] * inverseRot[others[e]], a, b);
+    grad[i] = stepsize * gradKey;
+    normGrad[i] = gradKey.norm();
+  };
+  auto update = [&](size_t i) {
+    inverseRot[i] = inverseRot[i].retract(grad[i]);
+  };
+
   double maxGrad;
   // gradient iterations
   size_t it;
   for (it = 0; it < maxIter; it++) {
     //////////////////////////////////////////////////////////////////////////
     // compute the gradient at each node
-    maxGrad = 0;
-    for (const auto key_value : inverseRot) {
-      Key key = key_value.key;
-      Vector gradKey = Z_3x1;
-      // collect the gradient for each edge incident on key
-      for (const size_t& factorId : adjEdgesMap.at(key)) {
-        Rot3 Rij = factorId2RotMap.at(factorId);
-        Rot3 Ri = inverseRot.at<Rot3>(key);
-        auto factor = pose3Graph.at(factorId);
-        const auto& keys = factor->keys();
-        if (key == keys[0]) {
-          Key key1 = keys[1];
-          Rot3 Rj = inverseRot.at<Rot3>(key1);
-          gradKey = gradKey + gradientTron(Ri, Rij * Rj, a, b);
-        } else if (key == keys[1]) {
-          Key key0 = keys[0];
-          Rot3 Rj = inverseRot.at<Rot3>(key0);
-          gradKey = gradKey + gradientTron(Ri, Rij.between(Rj), a, b);
-        } else {
-          cout << "Error in gradient computation" << endl;
-        }
-      }  // end of i-th gradient computation
-      grad.at(key) = stepsize * gradKey;
-
-      double normGradKey = (gradKey).norm();
-      if(normGradKey>maxGrad)
-        maxGrad = normGradKey;
-    } // end of loop over nodes
+    parallelFor(n, computeGradient);
+    maxGrad = *std::max_element(normGrad.begin(), normGrad.end());
 
     //////////////////////////////////////////////////////////////////////////
     // update estimates
-    inverseRot = inverseRot.retract(grad);
+    parallelFor(n, update);
 
     //////////////////////////////////////////////////////////////////////////
     // check stopping condition
@@ -201,20 +414,293 @@ Values InitializePose3::computeOrientationsGradient(
   } // enf of gradient iterations
 
   // Return correct rotations
-  const Rot3& Rref = inverseRot.at<Rot3>(initialize::kAnchorKey); // This will be set to the identity as so far we included no prior
+  const size_t anchor = std::lower_bound(keys.begin(), keys.end(),
+                                         initialize::kAnchorKey) - keys.begin();
+  const Rot3& Rref = inverseRot[anchor]; // This will be set to the identity as so far we included no prior
   Values estimateRot;
-  for(const auto key_value: inverseRot) {
-    Key key = key_value.key;
-    if (key != initialize::kAnchorKey) {
-      const Rot3& R = inverseRot.at<Rot3>(key);
+  for (size_t i = 0; i < n; i++) {
+    if (i != anchor) {
+      const Rot3& R = inverseRot[i];
       if(setRefFrame)
-        estimateRot.insert(key, Rref.compose(R.inverse()));
+        estimateRot.insert(keys[i], Rref.compose(R.inverse()));
       else
-        estimateRot.insert(key, R.inverse());
+        estimateRot.insert(keys[i], R.inverse());
     }
   }
   return estimateRot;
 }
+}  // namespace
+
+/* ************************************************************************* */
+Values InitializePose3::computeOrientationsGradient(
+    const NonlinearFactorGraph& pose3Graph, const Values& givenGuess,
+    const size_t maxIter, const bool setRefFrame) {
+  gttic(InitializePose3_computeOrientationsGradient);
+  return gradientIterations(pose3Graph, givenGuess, maxIter, setRefFrame,
+                            KeySet());
+}
+
+/* ************************************************************************* */
+std::map<Key, size_t> InitializePose3::partitionPose3Graph(
+    const NonlinearFactorGraph& pose3Graph, size_t nrParts) {
+  gttic(InitializePose3_partitionPose3Graph);
+
+  // Dense indices for all keys, in key order.
+  std::map<Key, size_t> part;
+  for (const auto& factor : pose3Graph)
+    for (Key key : factor->keys()) part.emplace(key, 0);
+  const size_t n = part.size();
+  size_t j = 0;
+  for (auto& key_index : part) key_index.second = j++;
+  nrParts = std::max<size_t>(1, std::min(nrParts, n));
+  if (nrParts == 1) {
+    for (auto& key_index : part) key_index.second = 0;
+    return part;
+  }
+
+  // Undirected adjacency structure, without duplicate edges or self loops.
+  vector<vector<size_t> > neighbors(n);
+  for (const auto& factor : pose3Graph) {
+    const auto& keys = factor->keys();
+    if (keys.size() != 2) continue;
+    const size_t i1 = part.at(keys[0]), i2 = part.at(keys[1]);
+    if (i1 == i2) continue;
+    neighbors[i1].push_back(i2);
+    neighbors[i2].push_back(i1);
+  }
+  for (auto& adjacent : neighbors) {
+    std::sort(adjacent.begin(), adjacent.end());
+    adjacent.erase(std::unique(adjacent.begin(), adjacent.end()),
+                   adjacent.end());
+  }
+
+  vector<size_t> assignment(n, 0);
+#ifdef GTSAM_SUPPORT_NESTED_DISSECTION
+  vector<idx_t> xadj(1, 0), adj;
+  for (const auto& adjacent : neighbors) {
+    adj.insert(adj.end(), adjacent.begin(), adjacent.end());
+    xadj.push_back(adj.size());
+  }
+  idx_t nrVertices = n, nrConstraints = 1, parts = nrParts, edgeCut;
+  vector<idx_t> metisPart(n, 0);
+  const int outputError = METIS_PartGraphKway(
+      &nrVertices, &nrConstraints, xadj.data(), adj.data(), nullptr, nullptr,
+      nullptr, &parts, nullptr, nullptr, nullptr, &edgeCut, metisPart.data());
+  if (outputError != METIS_OK)
+    throw std::runtime_error("InitializePose3: METIS partitioning failed");
+  std::copy(metisPart.begin(), metisPart.end(), assignment.begin());
+#else
+  // Without METIS, cut a breadth-first ordering into contiguous pieces.
+  vector<bool> visited(n, false);
+  size_t rank = 0;
+  for (size_t start = 0; start < n; ++start) {
+    if (visited[start]) continue;
+    std::queue<size_t> frontier;
+    frontier.push(start);
+    visited[start] = true;
+    while (!frontier.empty()) {
+      const size_t i = frontier.front();
+      frontier.pop();
+      assignment[i] = (rank++ * nrParts) / n;
+      for (size_t k : neighbors[i])
+        if (!visited[k]) {
+          visited[k] = true;
+          frontier.push(k);
+        }
+    }
+  }
+#endif
+
+  for (auto& key_index : part) key_index.second = assignment[key_index.second];
+  return part;
+}
+
+/* ************************************************************************* */
+Values InitializePose3::computeOrientationsPartitioned(
+    const NonlinearFactorGraph& pose3Graph, size_t nrParts) {
+  if (nrParts <= 1) return computeOrientationsChordal(pose3Graph);
+  gttic(InitializePose3_computeOrientationsPartitioned);
+
+  const std::map<Key, size_t> part = partitionPose3Graph(pose3Graph, nrParts);
+
+  // Parts need not be connected, so split them further into clusters, i.e.,
+  // the connected components of the edges internal to each part.
+  KeyVector keys;
+  keys.reserve(part.size());
+  for (const auto& key_part : part) keys.push_back(key_part.first);
+  auto indexOf = [&keys](Key key) {
+    return static_cast<size_t>(
+        std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+  };
+  const vector<BetweenFactor<Pose3>::shared_ptr> factors = pose3BetweenFactors(
+      pose3Graph, "InitializePose3::computeOrientationsPartitioned");
+  vector<size_t> parent(keys.size());
+  std::iota(parent.begin(), parent.end(), 0);
+  for (const auto& factor : factors)
+    if (part.at(factor->key1()) == part.at(factor->key2()))
+      parent[findRoot(&parent, indexOf(factor->key1()))] =
+          findRoot(&parent, indexOf(factor->key2()));
+  vector<size_t> cluster(keys.size()), rootOf;
+  std::map<size_t, size_t> clusterOfRoot;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const auto it =
+        clusterOfRoot.emplace(findRoot(&parent, i), clusterOfRoot.size()).first;
+    cluster[i] = it->second;
+    if (it->second == rootOf.size()) rootOf.push_back(i);
+  }
+  const size_t nrClusters = rootOf.size();
+
+  // Sub-problems, each anchored at the anchor key if it contains it, and at
+  // its first key otherwise.
+  vector<NonlinearFactorGraph> subgraphs(nrClusters);
+  vector<BetweenFactor<Pose3>::shared_ptr> cutFactors;
+  for (const auto& factor : factors) {
+    const size_t c1 = cluster[indexOf(factor->key1())];
+    if (c1 == cluster[indexOf(factor->key2())])
+      subgraphs[c1].push_back(factor);
+    else
+      cutFactors.push_back(factor);
+  }
+  const auto unitModel = noiseModel::Unit::Create(6);
+  const bool hasAnchor = part.count(initialize::kAnchorKey) > 0;
+  const size_t anchorCluster =
+      hasAnchor ? cluster[indexOf(initialize::kAnchorKey)] : 0;
+  for (size_t c = 0; c < nrClusters; ++c)
+    if (!hasAnchor || c != anchorCluster)
+      subgraphs[c].emplace_shared<BetweenFactor<Pose3> >(
+          initialize::kAnchorKey, keys[rootOf[c]], Pose3(), unitModel);
+
+  // Solve all sub-problems independently.
+  vector<Values> local(nrClusters);
+  auto solve = [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; ++c)
+      local[c] = computeOrientationsChordal(subgraphs[c]);
+  };
+#ifdef GTSAM_USE_TBB
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, nrClusters, 1),
+                    [&](const tbb::blocked_range<size_t>& range) {
+                      solve(range.begin(), range.end());
+                    });
+#else
+  solve(0, nrClusters);
+#endif
+
+  // Every cut edge i-j between clusters a and b measures the relative rotation
+  // Ga' * Gb = Ri^a * Rij * Rj^b' of the unknown cluster frames. Average them
+  // per pair of clusters, and solve the chordal relaxation over the clusters.
+  auto localRotation = [&](Key key, size_t c) {
+    return key == initialize::kAnchorKey ? Matrix3(I_3x3)
+                                         : local[c].at<Rot3>(key).matrix();
+  };
+  std::map<std::pair<size_t, size_t>, std::pair<Matrix3, double> > separators;
+  for (const auto& factor : cutFactors) {
+    size_t a = cluster[indexOf(factor->key1())];
+    size_t b = cluster[indexOf(factor->key2())];
+    Matrix3 M = localRotation(factor->key1(), a) *
+                factor->measured().rotation().matrix() *
+                localRotation(factor->key2(), b).transpose();
+    if (a > b) {
+      std::swap(a, b);
+      M.transposeInPlace();
+    }
+    const double weight = rotationPrecision(*factor);
+    auto it = separators.emplace(std::make_pair(a, b),
+                                 std::make_pair(Matrix3(Z_3x3), 0.0)).first;
+    it->second.first += weight * M;
+    it->second.second += weight;
+  }
+  NonlinearFactorGraph clusterGraph;
+  for (const auto& separator : separators) {
+    const double weight = separator.second.second;
+    const Rot3 Rab = Rot3::ClosestTo(separator.second.first / weight);
+    clusterGraph.emplace_shared<BetweenFactor<Pose3> >(
+        separator.first.first, separator.first.second, Pose3(Rab, Point3()),
+        noiseModel::Isotropic::Sigma(6, 1.0 / weight));
+  }
+  // The cut edges need not connect all clusters, e.g., if the graph itself is
+  // disconnected. Fix the gauge of every connected component of the cluster
+  // graph with a prior on one of its clusters, which also keeps the frame of a
+  // cluster without cut edges at the identity.
+  vector<size_t> component(nrClusters);
+  std::iota(component.begin(), component.end(), 0);
+  for (const auto& separator : separators)
+    component[findRoot(&component, separator.first.first)] =
+        findRoot(&component, separator.first.second);
+  vector<bool> hasGauge(nrClusters, false);
+  hasGauge[findRoot(&component, anchorCluster)] = true;
+  clusterGraph.emplace_shared<BetweenFactor<Pose3> >(
+      initialize::kAnchorKey, anchorCluster, Pose3(), unitModel);
+  for (size_t c = 0; c < nrClusters; ++c) {
+    const size_t root = findRoot(&component, c);
+    if (hasGauge[root]) continue;
+    hasGauge[root] = true;
+    clusterGraph.emplace_shared<BetweenFactor<Pose3> >(
+        initialize::kAnchorKey, c, Pose3(), unitModel);
+  }
+  const Values clusterFrames = computeOrientationsChordal(clusterGraph);
+
+  // Rotate every cluster into the common frame.
+  Values stitched;
+  for (size_t c = 0; c < nrClusters; ++c) {
+    const Rot3& G = clusterFrames.at<Rot3>(c);
+    for (const auto key_value : local[c])
+      stitched.insert(key_value.key,
+                      Pose3(G * key_value.value.cast<Rot3>(), Point3()));
+  }
+
+  // The clusters were solved without the cut edges, which only aligned them
+  // rigidly, so the stitched estimate is off around the cut. Refine it with the
+  // gradient method on the keys at most kRefinementHops edges away from a cut
+  // edge, keeping the keys just beyond them, and the anchor, fixed.
+  gttic(refine);
+  KeySet nearCut;
+  vector<Key> frontier;
+  for (const auto& factor : cutFactors)
+    for (Key key : factor->keys())
+      if (nearCut.insert(key).second) frontier.push_back(key);
+  vector<vector<Key> > neighbors(keys.size());
+  for (const auto& factor : factors) {
+    neighbors[indexOf(factor->key1())].push_back(factor->key2());
+    neighbors[indexOf(factor->key2())].push_back(factor->key1());
+  }
+  for (size_t hop = 0; hop < kRefinementHops; ++hop) {
+    vector<Key> next;
+    for (Key key : frontier)
+      for (Key other : neighbors[indexOf(key)])
+        if (nearCut.insert(other).second) next.push_back(other);
+    frontier.swap(next);
+  }
+  nearCut.erase(initialize::kAnchorKey);
+
+  NonlinearFactorGraph refinementGraph;
+  Values refinementGuess;
+  KeySet fixed;
+  fixed.insert(initialize::kAnchorKey);
+  for (const auto& factor : factors) {
+    if (!nearCut.count(factor->key1()) && !nearCut.count(factor->key2()))
+      continue;
+    refinementGraph.push_back(factor);
+    for (Key key : factor->keys()) {
+      if (key == initialize::kAnchorKey || refinementGuess.exists(key))
+        continue;
+      refinementGuess.insert(key, stitched.at(key));
+      if (!nearCut.count(key)) fixed.insert(key);
+    }
+  }
+  const Values refined =
+      gradientIterations(refinementGraph, refinementGuess,
+                         kMaxRefinementIterations, false, fixed);
+
+  Values orientations;
+  for (const auto key_value : stitched) {
+    const Key key = key_value.key;
+    if (nearCut.count(key))
+      orientations.insert(key, refined.at<Rot3>(key));
+    else
+      orientations.insert(key, key_value.value.cast<Pose3>().rotation());
+  }
+  return orientations;
+}
 
 /* ************************************************************************* */
 void InitializePose3::createSymbolicGraph(
@@ -293,7 +779,8 @@ Values InitializePose3::computePoses(const Values& initialRot,
 
 /* ************************************************************************* */
 Values InitializePose3::initialize(const NonlinearFactorGraph& graph,
-                                   const Values& givenGuess, bool useGradient) {
+                                   const Values& givenGuess, bool useGradient,
+                                   size_t nrParts) {
   gttic(InitializePose3_initialize);
   Values initialValues;
 
@@ -306,7 +793,7 @@ Values InitializePose3::initialize(const NonlinearFactorGraph& graph,
   if (useGradient)
     orientations = computeOrientationsGradient(pose3Graph, givenGuess);
   else
-    orientations = computeOrientationsChordal(pose3Graph);
+    orientations = computeOrientationsPartitioned(pose3Graph, nrParts);
 
   // Compute the full poses (1 GN iteration on full poses)
   return computePoses(orientations, &pose3Graph);
@@ -27,6 +27,7 @@
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace gtsam {
@@ -34,6 +35,44 @@ namespace gtsam {
 typedef std::map<Key, std::vector<size_t> > KeyVectorMap;
 typedef std::map<Key, Rot3> KeyRotMap;
 
+/**
+ * Solver for the chordal relaxation of a graph including only
+ * BetweenFactors<Pose3>, as built by
+ * InitializePose3::buildLinearOrientationGraph.
+ *
+ * The 9n-dimensional linear system of the relaxation decouples into three
+ * identical 3n-dimensional systems, one for each column of the relaxed
+ * rotation matrices, which differ only in their right-hand side. The solver
+ * assembles the 3n*3n normal equations once, factors them with a sparse
+ * LDL^T, and solves for all three columns at once.
+ *
+ * The fill-reducing ordering and symbolic factorization are cached, and are
+ * reused by later calls to solve() on graphs with the same keys and edges, as
+ * when the relaxation is re-solved with updated measurements or weights.
+ */
+class GTSAM_EXPORT ChordalRelaxationSolver {
+ public:
+  typedef boost::shared_ptr<ChordalRelaxationSolver> shared_ptr;
+
+  ChordalRelaxationSolver();
+  ~ChordalRelaxationSolver();
+
+  /**
+   * Return the orientations of a graph including only BetweenFactors<Pose3>.
+   * Throws IndeterminantLinearSystemException if the relaxation is singular,
+   * e.g., if the graph is not connected to initialize::kAnchorKey, and
+   * std::invalid_argument if the graph contains any other factor.
+   */
+  Values solve(const NonlinearFactorGraph& pose3Graph);
+
+  /// Number of times the symbolic factorization was computed
+  size_t nrSymbolicFactorizations() const;
+
+ private:
+  struct Impl;  ///< cached structure and sparse factorization
+  std::unique_ptr<Impl> impl_;
+};
+
 struct GTSAM_EXPORT InitializePose3 {
   static GaussianFactorGraph buildLinearOrientationGraph(
       const NonlinearFactorGraph& g);
@@ -46,6 +85,14 @@ struct GTSAM_EXPORT InitializePose3 {
   static Values computeOrientationsChordal(
       const NonlinearFactorGraph& pose3Graph);
 
+  /**
+   * Same as above, solving the relaxation with the given solver, which re-uses
+   * its symbolic factorization when called repeatedly on graphs with the same
+   * structure. A temporary solver is used if solver is null.
+   */
+  static Values computeOrientationsChordal(
+      const NonlinearFactorGraph& pose3Graph, ChordalRelaxationSolver* solver);
+
   /**
    * Return the orientations of a graph including only BetweenFactors<Pose3>
    */
@@ -53,6 +100,30 @@ struct GTSAM_EXPORT InitializePose3 {
       const NonlinearFactorGraph& pose3Graph, const Values& givenGuess,
       size_t maxIter = 10000, const bool setRefFrame = true);
 
+  /**
+   * Partition the variables of a graph including only BetweenFactors<Pose3>
+   * into nrParts parts, using METIS k-way partitioning when available, and a
+   * breadth-first traversal otherwise. Returns the part index for every key.
+   */
+  static std::map<Key, size_t> partitionPose3Graph(
+      const NonlinearFactorGraph& pose3Graph, size_t nrParts);
+
+  /**
+   * Return the orientations of a graph including only BetweenFactors<Pose3>,
+   * solving the chordal relaxation separately, in parallel, for each of
+   * nrParts parts of the graph. The parts are then stitched together by
+   * solving a small chordal relaxation over one rotation per part, using the
+   * measurements on the edges that were cut by the partition, with a gauge
+   * prior for every group of parts that no cut edge connects. Finally, the
+   * gradient method of computeOrientationsGradient refines the stitched
+   * estimate on the keys near the cut, so that the cut edges also correct the
+   * parts. Throws std::invalid_argument if the graph contains any other
+   * factor.
+   * With nrParts == 1 this is the same as computeOrientationsChordal.
+   */
+  static Values computeOrientationsPartitioned(
+      const NonlinearFactorGraph& pose3Graph, size_t nrParts);
+
   static void createSymbolicGraph(const NonlinearFactorGraph& pose3Graph,
                                   KeyVectorMap* adjEdgesMap,
                                   KeyRotMap* factorId2RotMap);
@@ -84,9 +155,12 @@ struct GTSAM_EXPORT InitializePose3 {
    * "extract" the Pose3 subgraph of the original graph, get orientations from
    * relative orientation measurements (using either gradient or chordal
    * method), and finish up with 1 GN iteration on full poses.
+   * If nrParts > 1, the chordal method is replaced by
+   * computeOrientationsPartitioned; it is not used with the gradient method.
    */
   static Values initialize(const NonlinearFactorGraph& graph,
-                           const Values& givenGuess, bool useGradient = false);
+                           const Values& givenGuess, bool useGradient = false,
+                           size_t nrParts = 1);
 
   /// Calls initialize above using Chordal method.
   static Values initialize(const NonlinearFactorGraph& graph);
@@ -162,6 +162,12 @@ namespace gtsam {
       return Vector2::Constant(2.0 * K_->fx());
     }
 
+    /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+    bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+      return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+    }
+
     /** return the measurement */
     const Point2& measured() const {
       return measured_;
@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   ReducedCameraSystem.h
+ * @brief  Schur complements of many smart factors, assembled in parallel
+ * @date   October, 2026
+ */
+
+#pragma once
+
+#include <gtsam/slam/SmartProjectionFactor.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/RegularHessianFactor.h>
+#include <gtsam/base/SymmetricBlockMatrix.h>
+#include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#endif
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace gtsam {
+
+/**
+ * The reduced camera system of a graph with smart projection factors: the sum
+ * of the Schur complements of all smart factors, with the points eliminated,
+ * as a sparse Hessian on the cameras (or body poses) they observe.
+ *
+ * Linearizing the smart factors one by one allocates a RegularHessianFactor
+ * per track, which elimination then has to combine again. Here, the Schur
+ * complements are summed per pair of cameras, using slots computed once at
+ * construction, so only the blocks of cameras that share a track are ever
+ * stored. With TBB, factors are split among tasks, each accumulating its own
+ * sparse sum, and the partial sums are merged at the end.
+ *
+ * The result, one unary factor per camera and one binary factor per pair of
+ * cameras that share a track, sums to the same Hessian as linearizing every
+ * smart factor with linearizeToHessian. It keeps the sparsity of the reduced
+ * camera system for elimination, as in bundle adjustment with thousands of
+ * SmartProjectionPoseFactor or SmartProjectionRigFactor.
+ */
+template <class CAMERA>
+class ReducedCameraSystem {
+ public:
+  typedef SmartProjectionFactor<CAMERA> SmartFactor;
+  static const int D = traits<CAMERA>::dimension;  ///< Camera dimension
+
+ private:
+  std::vector<boost::shared_ptr<SmartFactor> > factors_;
+  std::vector<std::vector<size_t> > slots_;  ///< slots of factor keys in keys_
+  NonlinearFactorGraph others_;              ///< all other factors
+  KeyVector keys_;                           ///< sorted keys of all factors
+
+ public:
+  /// Minimum number of factors per task, if TBB is used
+  static const size_t kGrainSize = 64;
+
+  /**
+   * Collect the smart factors in a graph. Factors of other types are kept
+   * aside and linearized as usual by linearizeGraph.
+   */
+  explicit ReducedCameraSystem(const NonlinearFactorGraph& graph) {
+    for (const auto& factor : graph) {
+      if (!factor) continue;
+      auto smart = boost::dynamic_pointer_cast<SmartFactor>(factor);
+      if (smart)
+        factors_.push_back(smart);
+      else
+        others_.push_back(factor);
+    }
+
+    for (const auto& factor : factors_)
+      keys_.insert(keys_.end(), factor->keys().begin(), factor->keys().end());
+    std::sort(keys_.begin(), keys_.end());
+    keys_.erase(std::unique(keys_.begin(), keys_.end()), keys_.end());
+
+    slots_.reserve(factors_.size());
+    for (const auto& factor : factors_) {
+      std::vector<size_t> slots;
+      slots.reserve(factor->keys().size());
+      for (Key key : factor->keys())
+        slots.push_back(
+            std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin());
+      slots_.push_back(std::move(slots));
+    }
+  }
+
+  /// Number of smart factors
+  size_t size() const { return factors_.size(); }
+
+  /// Sorted keys of the cameras observed by the smart factors
+  const KeyVector& keys() const { return keys_; }
+
+  /// Factors in the graph that are not smart factors
+  const NonlinearFactorGraph& others() const { return others_; }
+
+  /**
+   * Sum of the Schur complements of all smart factors, as a
+   * RegularHessianFactor on every camera in keys(), and one on every pair of
+   * cameras observed by a common smart factor, holding the off-diagonal block
+   * only. Same parameters as SmartProjectionFactor::linearizeToHessian.
+   */
+  GaussianFactorGraph::shared_ptr linearize(
+      const Values& values, double lambda = 0.0,
+      bool diagonalDamping = false) const {
+    gttic(ReducedCameraSystem_linearize);
+    Accumulator accumulator(*this, values, lambda, diagonalDamping);
+#ifdef GTSAM_USE_TBB
+    tbb::parallel_reduce(
+        tbb::blocked_range<size_t>(0, factors_.size(), kGrainSize),
+        accumulator);
+#else
+    accumulator(0, factors_.size());
+#endif
+
+    auto graph = boost::make_shared<GaussianFactorGraph>();
+    graph->reserve(keys_.size() + accumulator.offDiagonal.size());
+    for (size_t i = 0; i < keys_.size(); i++) {
+      const auto G = accumulator.diagonal.find(i);
+      const auto g = accumulator.information.find(i);
+      const bool touched = G != accumulator.diagonal.end();
+      graph->push_back(boost::make_shared<RegularHessianFactor<D> >(
+          KeyVector{keys_[i]},
+          std::vector<Matrix>{touched ? G->second : Matrix(MatrixD::Zero())},
+          std::vector<Vector>{touched ? g->second : Vector(VectorD::Zero())},
+          i == 0 ? accumulator.f : 0.0));
+    }
+    for (const auto& block : accumulator.offDiagonal)
+      graph->push_back(boost::make_shared<RegularHessianFactor<D> >(
+          keys_[block.first.first], keys_[block.first.second],
+          MatrixD::Zero(), block.second, VectorD::Zero(), MatrixD::Zero(),
+          VectorD::Zero(), 0.0));
+    return graph;
+  }
+
+  /// Linearize the other factors as usual, and add the reduced camera system
+  GaussianFactorGraph::shared_ptr linearizeGraph(const Values& values) const {
+    GaussianFactorGraph::shared_ptr graph = others_.linearize(values);
+    if (!factors_.empty()) graph->push_back(*linearize(values));
+    return graph;
+  }
+
+ private:
+  typedef Eigen::Matrix<double, D, D> MatrixD;
+  typedef Eigen::Matrix<double, D, 1> VectorD;
+
+  /**
+   * Adds the Schur complements of a range of factors into a sparse sum, with
+   * the blocks of every factor first computed in a small augmented Hessian on
+   * its own keys, and then added to the blocks of their slots.
+   */
+  struct Accumulator {
+    const ReducedCameraSystem& system;
+    const Values& values;
+    const double lambda;
+    const bool diagonalDamping;
+    std::map<size_t, Matrix> diagonal;     ///< diagonal blocks, by slot
+    std::map<size_t, Vector> information;  ///< information vector, by slot
+    std::map<std::pair<size_t, size_t>, Matrix> offDiagonal;  ///< slots i < j
+    double f;                                                   ///< constant
+
+    Accumulator(const ReducedCameraSystem& system, const Values& values,
+                double lambda, bool diagonalDamping)
+        : system(system),
+          values(values),
+          lambda(lambda),
+          diagonalDamping(diagonalDamping),
+          f(0.0) {}
+
+    /// Add block to sum[key], which starts at zero
+    template <class KEY, class BLOCK>
+    static void add(std::map<KEY, BLOCK>& sum, const KEY& key,
+                    const BLOCK& block) {
+      auto it = sum.find(key);
+      if (it == sum.end())
+        sum.emplace(key, block);
+      else
+        it->second += block;
+    }
+
+    void operator()(size_t begin, size_t end) {
+      std::vector<size_t> localSlots;
+      SymmetricBlockMatrix local;
+      for (size_t i = begin; i < end; i++) {
+        const std::vector<size_t>& slots = system.slots_[i];
+        const size_t n = slots.size();
+        if (localSlots.size() != n) {
+          localSlots.resize(n);
+          for (size_t k = 0; k < n; k++) localSlots[k] = k;
+          local = SymmetricBlockMatrix(std::vector<DenseIndex>(n, D), true);
+        }
+        local.setZero();
+        system.factors_[i]->updateAugmentedHessian(
+            values, localSlots, local, lambda, diagonalDamping);
+
+        for (size_t a = 0; a < n; a++) {
+          add(diagonal, slots[a], Matrix(local.diagonalBlock(a)));
+          add(information, slots[a], Vector(local.aboveDiagonalBlock(a, n)));
+          for (size_t b = a + 1; b < n; b++) {
+            if (slots[a] < slots[b])
+              add(offDiagonal, std::make_pair(slots[a], slots[b]),
+                  Matrix(local.aboveDiagonalBlock(a, b)));
+            else
+              add(offDiagonal, std::make_pair(slots[b], slots[a]),
+                  Matrix(local.aboveDiagonalBlock(a, b).transpose()));
+          }
+        }
+        f += local.diagonal(n)(0);
+      }
+    }
+
+#ifdef GTSAM_USE_TBB
+    Accumulator(Accumulator& other, tbb::split)
+        : Accumulator(other.system, other.values, other.lambda,
+                      other.diagonalDamping) {}
+
+    void operator()(const tbb::blocked_range<size_t>& range) {
+      (*this)(range.begin(), range.end());
+    }
+
+    /// Merge the other partial sum, touching only its non-zero blocks
+    void join(const Accumulator& other) {
+      for (const auto& block : other.diagonal)
+        add(diagonal, block.first, block.second);
+      for (const auto& block : other.information)
+        add(information, block.first, block.second);
+      for (const auto& block : other.offDiagonal)
+        add(offDiagonal, block.first, block.second);
+      f += other.f;
+    }
+#endif
+  };
+};
+
+template <class CAMERA>
+const int ReducedCameraSystem<CAMERA>::D;
+
+}  // namespace gtsam
@@ -336,11 +336,16 @@ protected:
   void updateAugmentedHessian(const Cameras& cameras, const Point3& point,
       const double lambda, bool diagonalDamping,
       SymmetricBlockMatrix& augmentedHessian,
-      const KeyVector allKeys) const {
+      const KeyVector& allKeys) const {
+    FBlocks Fs;
     Matrix E;
     Vector b;
     computeJacobians(Fs, E, b, cameras, point);
-    Cameras::UpdateSchurComplement(Fs, E, b, allKeys, keys_, augmentedHessian);
+    whitenJacobians(Fs, E, b);
+    Matrix3 P;
+    Cameras::template ComputePointCovariance<3>(P, E, lambda, diagonalDamping);
+    Cameras::template UpdateSchurComplement<3>(Fs, E, P, b, allKeys, keys_,
+                                               augmentedHessian);
   }
 
   /// Whiten the Jacobians computed by computeJacobians using noiseModel_
@@ -178,9 +178,18 @@ protected:
       return TriangulationResult::Degenerate();
 
     bool retriangulate = decideIfTriangulate(cameras);
-    if (retriangulate)
-      result_ = gtsam::triangulateSafe(cameras, this->measured_,
-          params_.triangulation);
+    if (retriangulate) {
+      // With nonlinear refinement, start from the point triangulated at the
+      // previous linearization point, and only fall back to the DLT if that
+      // does not give a valid point.
+      const bool warmStart = params_.triangulation.enableEPI && result_;
+      if (warmStart)
+        result_ = gtsam::triangulateSafe(cameras, this->measured_,
+            params_.triangulation, *result_);
+      if (!warmStart || !result_)
+        result_ = gtsam::triangulateSafe(cameras, this->measured_,
+            params_.triangulation);
+    }
     return result_;
   }
 
@@ -279,6 +288,49 @@ protected:
     return createHessianFactor(this->cameras(values), lambda);
   }
 
+  using Base::updateAugmentedHessian;
+
+  /**
+   * Add the Hessian that linearizeToHessian would return into the augmented
+   * Hessian of a larger system, without allocating a factor. Variable
+   * keys()[i] lives in block slots[i] of augmentedHessian, and the last block
+   * holds the information vector. Not thread-safe for the same factor, as the
+   * triangulation is cached, but different factors can update different
+   * Hessians concurrently.
+   */
+  virtual void updateAugmentedHessian(const Values& values,
+      const std::vector<size_t>& slots, SymmetricBlockMatrix& augmentedHessian,
+      double lambda = 0.0, bool diagonalDamping = false) const {
+    const Cameras cameras = this->cameras(values);
+    if (this->measured_.size() != cameras.size())
+      throw std::runtime_error(
+          "SmartProjectionFactor: this->measured_"
+          ".size() inconsistent with input");
+
+    triangulateSafe(cameras);
+    if (params_.degeneracyMode == ZERO_ON_DEGENERACY && !result_)
+      return;  // same as adding an empty Hessian
+
+    // Jacobian could be 3D Point3 OR 2D Unit3, difference is E.cols().
+    typename Base::FBlocks Fs;
+    Matrix E;
+    Vector b;
+    computeJacobiansWithTriangulatedPoint(Fs, E, b, cameras);
+    Base::whitenJacobians(Fs, E, b);
+
+    if (E.cols() == 2) {
+      Matrix2 P;
+      Cameras::template ComputePointCovariance<2>(P, E, lambda, diagonalDamping);
+      Cameras::template UpdateSchurComplement<2>(Fs, E, P, b, slots,
+                                                  augmentedHessian);
+    } else {
+      Matrix3 P;
+      Cameras::template ComputePointCovariance<3>(P, E, lambda, diagonalDamping);
+      Cameras::template UpdateSchurComplement<3>(Fs, E, P, b, slots,
+                                                  augmentedHessian);
+    }
+  }
+
   /// Linearize to an Implicit Schur factor.
   virtual boost::shared_ptr<RegularImplicitSchurFactor<CAMERA> > linearizeToImplicit(
       const Values& values, double lambda = 0.0) const {
@@ -325,6 +325,56 @@ class SmartProjectionRigFactor : public SmartProjectionFactor<CAMERA> {
         this->keys_, augmentedHessianUniqueKeys);
   }
 
+  using Base::updateAugmentedHessian;
+
+  /**
+   * Add the Hessian of createHessianFactor into the augmented Hessian of a
+   * larger system, where body pose keys()[i] lives in block slots[i].
+   */
+  void updateAugmentedHessian(const Values& values,
+                              const std::vector<size_t>& slots,
+                              SymmetricBlockMatrix& augmentedHessian,
+                              double lambda = 0.0,
+                              bool diagonalDamping = false) const override {
+    Cameras cameras = this->cameras(values);
+    if (this->measured_.size() != cameras.size())  // 1 observation per camera
+      throw std::runtime_error(
+          "SmartProjectionRigFactor: "
+          "measured_.size() inconsistent with input");
+
+    // triangulate 3D point at given linearization point
+    this->triangulateSafe(cameras);
+
+    if (!this->result_) {  // failed: add "empty/zero" Hessian
+      if (this->params_.degeneracyMode == ZERO_ON_DEGENERACY) return;
+      throw std::runtime_error(
+          "SmartProjectionRigFactor: "
+          "only supported degeneracy mode is ZERO_ON_DEGENERACY");
+    }
+
+    // compute and whiten Jacobians given triangulated 3D Point
+    typename Base::FBlocks Fs;
+    Matrix E;
+    Vector b;
+    this->computeJacobiansWithTriangulatedPoint(Fs, E, b, cameras);
+    this->noiseModel_->WhitenSystem(E, b);
+    for (size_t i = 0; i < Fs.size(); i++) {
+      Fs[i] = this->noiseModel_->Whiten(Fs[i]);
+    }
+
+    const Matrix3 P = Base::Cameras::PointCov(E, lambda, diagonalDamping);
+
+    // several measurements may share a body pose, hence a slot
+    std::vector<size_t> measurementSlots(nonUniqueKeys_.size());
+    for (size_t i = 0; i < nonUniqueKeys_.size(); i++) {
+      const auto it = std::find(this->keys_.begin(), this->keys_.end(),
+                                nonUniqueKeys_[i]);
+      measurementSlots[i] = slots[it - this->keys_.begin()];
+    }
+    Base::Cameras::template UpdateSchurComplement<3>(
+        Fs, E, P, b, measurementSlots, augmentedHessian);
+  }
+
   /**
    * Linearize to Gaussian Factor (possibly adding a damping factor Lambda for
    * LM)
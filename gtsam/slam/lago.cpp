@@ -23,10 +23,23 @@
 #include <gtsam/slam/BetweenFactor.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/geometry/Pose2.h>
+#include <gtsam/linear/linearExceptions.h>
 #include <gtsam/base/timing.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <Eigen/Sparse>
 #include <boost/math/special_functions.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
 using namespace std;
 
 namespace gtsam {
@@ -195,159 +208,377 @@ GaussianFactorGraph buildLinearOrientationGraph(
 }
 
 /* ************************************************************************* */
-static PredecessorMap<Key> findOdometricPath(
-    const NonlinearFactorGraph& pose2Graph) {
-
-  PredecessorMap<Key> tree;
-  Key minKey = initialize::kAnchorKey; // this initialization does not matter
-  bool minUnassigned = true;
+namespace {
+
+typedef Eigen::SparseMatrix<double> SparseMatrix;
+// Sparse LDL^T of the lower triangle of a matrix, already in elimination order
+typedef Eigen::SimplicialLDLT<SparseMatrix, Eigen::Lower,
+                              Eigen::NaturalOrdering<int> > SparseLDLT;
+const size_t kNone = std::numeric_limits<size_t>::max();
+
+// Call f(k) for k in [0, n), in parallel if TBB is available and n is large
+// enough to be worth it.
+template <class FUNCTION>
+void parallelFor(size_t n, const FUNCTION& f) {
+#ifdef GTSAM_USE_TBB
+  static const size_t kGrainSize = 1024;
+  if (n > kGrainSize) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n, kGrainSize),
+                      [&f](const tbb::blocked_range<size_t>& range) {
+                        for (size_t k = range.begin(); k < range.end(); ++k)
+                          f(k);
+                      });
+    return;
+  }
+#endif
+  for (size_t k = 0; k < n; ++k) f(k);
+}
 
-  for(const boost::shared_ptr<NonlinearFactor>& factor: pose2Graph) {
+/**
+ * A graph including only BetweenFactors<Pose2>, in flat arrays: keys are
+ * replaced by their index in the sorted keys, which include the anchor, and
+ * the neighbors of every node are stored contiguously. Also computes a
+ * fill-reducing elimination order of the nodes, which is shared by the
+ * orientation and pose steps.
+ */
+struct FlatPose2Graph {
+  KeyVector keys;
+  size_t anchor;
+  std::vector<size_t> key1, key2;  // end points of every edge
+  std::vector<Pose2> measured;
+  std::vector<noiseModel::Diagonal::shared_ptr> models;  // null if not diagonal
+  std::vector<size_t> offsets, adjacent;  // neighbors of node i
+  std::vector<int> order;  // elimination order of the nodes
+  std::vector<int> position;  // position of every node in elimination order
+
+  explicit FlatPose2Graph(const NonlinearFactorGraph& pose2Graph) {
+    keys.push_back(initialize::kAnchorKey);
+    for (const auto& factor : pose2Graph)
+      keys.insert(keys.end(), factor->keys().begin(), factor->keys().end());
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    anchor = indexOf(initialize::kAnchorKey);
+
+    const size_t m = pose2Graph.size();
+    key1.reserve(m);
+    key2.reserve(m);
+    measured.reserve(m);
+    models.reserve(m);
+    for (const auto& factor : pose2Graph) {
+      auto pose2Between =
+          boost::dynamic_pointer_cast<BetweenFactor<Pose2> >(factor);
+      if (!pose2Between)
+        throw invalid_argument(
+            "computeLagoPoses: cannot manage non between factor here!");
+      key1.push_back(indexOf(pose2Between->key1()));
+      key2.push_back(indexOf(pose2Between->key2()));
+      measured.push_back(pose2Between->measured());
+      models.push_back(boost::dynamic_pointer_cast<noiseModel::Diagonal>(
+          pose2Between->noiseModel()));
+    }
 
-    Key key1 = std::min(factor->keys()[0], factor->keys()[1]);
-    Key key2 = std::max(factor->keys()[0], factor->keys()[1]);
-    if (minUnassigned) {
-      minKey = key1;
-      minUnassigned = false;
+    offsets.assign(keys.size() + 1, 0);
+    for (size_t e = 0; e < m; e++) {
+      offsets[key1[e] + 1]++;
+      offsets[key2[e] + 1]++;
     }
-    if (key2 - key1 == 1) { // consecutive keys
-      tree.insert(key2, key1);
-      if (key1 < minKey)
-        minKey = key1;
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    adjacent.resize(2 * m);
+    std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+    for (size_t e = 0; e < m; e++) {
+      adjacent[next[key1[e]]++] = key2[e];
+      adjacent[next[key2[e]]++] = key1[e];
     }
+    computeOrdering();
   }
-  tree.insert(minKey, initialize::kAnchorKey);
-  tree.insert(initialize::kAnchorKey, initialize::kAnchorKey); // root
-  return tree;
-}
-
-/* ************************************************************************* */
-// Return the orientations of a graph including only BetweenFactors<Pose2>
-static VectorValues computeOrientations(const NonlinearFactorGraph& pose2Graph,
-    bool useOdometricPath) {
-  gttic(lago_computeOrientations);
 
-  // Find a minimum spanning tree
-  PredecessorMap<Key> tree;
-  if (useOdometricPath)
-    tree = findOdometricPath(pose2Graph);
-  else
-    tree = findMinimumSpanningTree<NonlinearFactorGraph, Key,
-        BetweenFactor<Pose2> >(pose2Graph);
+  size_t size() const { return keys.size(); }
 
-  // Create a linear factor graph (LFG) of scalars
-  key2doubleMap deltaThetaMap;
-  vector<size_t> spanningTreeIds; // ids of between factors forming the spanning tree T
-  vector<size_t> chordsIds; // ids of between factors corresponding to chordsIds wrt T
-  getSymbolicGraph(spanningTreeIds, chordsIds, deltaThetaMap, tree, pose2Graph);
+  size_t indexOf(Key key) const {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+  }
 
-  // temporary structure to correct wraparounds along loops
-  key2doubleMap orientationsToRoot = computeThetasToRoot(deltaThetaMap, tree);
+  // Approximate minimum degree on the graph of nodes, rather than on the
+  // scalar unknowns.
+  void computeOrdering() {
+    const int n = size();
+    std::vector<Eigen::Triplet<double> > pattern;
+    pattern.reserve(n + adjacent.size());
+    for (int i = 0; i < n; i++) {
+      pattern.emplace_back(i, i, 1.0);  // AMD needs the diagonal
+      for (size_t a = offsets[i]; a < offsets[i + 1]; a++)
+        pattern.emplace_back(i, adjacent[a], 1.0);
+    }
+    SparseMatrix A(n, n);
+    A.setFromTriplets(pattern.begin(), pattern.end());
+    Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, int> Pinv;
+    Eigen::AMDOrdering<int>()(A, Pinv);
+    order.assign(Pinv.indices().data(), Pinv.indices().data() + n);
+    position.resize(n);
+    for (int k = 0; k < n; k++) position[order[k]] = k;
+  }
+};
 
-  // regularize measurements and plug everything in a factor graph
-  GaussianFactorGraph lagoGraph = buildLinearOrientationGraph(spanningTreeIds,
-      chordsIds, pose2Graph, orientationsToRoot, tree);
+/* ************************************************************************* */
+// Spanning tree along the odometry, i.e., edges between consecutive keys, as
+// the parent of every node. The root is the anchor, and its child the smallest
+// key in the odometric path.
+std::vector<size_t> findOdometricPath(const FlatPose2Graph& graph) {
+  std::vector<size_t> parent(graph.size(), kNone);
+  size_t minKey = kNone;
+  for (size_t e = 0; e < graph.key1.size(); e++) {
+    const size_t i1 = std::min(graph.key1[e], graph.key2[e]);
+    const size_t i2 = std::max(graph.key1[e], graph.key2[e]);
+    if (minKey == kNone) minKey = i1;
+    if (graph.keys[i2] - graph.keys[i1] == 1) {  // consecutive keys
+      if (parent[i2] == kNone) parent[i2] = i1;
+      minKey = std::min(minKey, i1);
+    }
+  }
+  if (minKey != kNone && parent[minKey] == kNone) parent[minKey] = graph.anchor;
+  parent[graph.anchor] = graph.anchor;  // root
+  return parent;
+}
 
-  // Solve the LFG
-  VectorValues orientationsLago = lagoGraph.optimize();
+/* ************************************************************************* */
+// Breadth-first spanning tree from the anchor. All edges have the same weight,
+// so this is a minimum spanning tree, and it has the smallest possible depth.
+std::vector<size_t> findBreadthFirstTree(const FlatPose2Graph& graph) {
+  std::vector<size_t> parent(graph.size(), kNone), frontier(1, graph.anchor);
+  parent[graph.anchor] = graph.anchor;
+  for (size_t k = 0; k < frontier.size(); k++) {
+    const size_t i = frontier[k];
+    for (size_t a = graph.offsets[i]; a < graph.offsets[i + 1]; a++) {
+      const size_t j = graph.adjacent[a];
+      if (parent[j] == kNone) {
+        parent[j] = i;
+        frontier.push_back(j);
+      }
+    }
+  }
+  return parent;
+}
 
-  return orientationsLago;
+/* ************************************************************************* */
+// Cumulative orientations of all nodes with respect to the anchor, along the
+// spanning tree given by parent, which is traversed breadth-first, one level
+// at a time. All nodes in a level are independent, so they are processed in
+// parallel. deltaTheta is the relative orientation of a node to its parent.
+std::vector<double> propagateOrientations(const FlatPose2Graph& graph,
+                                        const std::vector<size_t>& parent,
+                                        const std::vector<double>& deltaTheta) {
+  // Children of every node, as a flat adjacency array
+  const size_t n = graph.size();
+  std::vector<size_t> offsets(n + 1, 0), children(n);
+  for (size_t i = 0; i < n; i++)
+    if (parent[i] != kNone && parent[i] != i) offsets[parent[i] + 1]++;
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+  for (size_t i = 0; i < n; i++)
+    if (parent[i] != kNone && parent[i] != i) children[next[parent[i]]++] = i;
+
+  std::vector<double> theta(n, 0.0);
+  std::vector<size_t> frontier(1, graph.anchor), nextFrontier, start;
+  size_t nrVisited = 1;
+  while (!frontier.empty()) {
+    start.assign(1, 0);
+    for (size_t i : frontier)
+      start.push_back(start.back() + offsets[i + 1] - offsets[i]);
+    nextFrontier.resize(start.back());
+    parallelFor(frontier.size(), [&](size_t k) {
+      const size_t i = frontier[k];
+      size_t slot = start[k];
+      for (size_t c = offsets[i]; c < offsets[i + 1]; c++) {
+        const size_t child = children[c];
+        theta[child] = theta[i] + deltaTheta[child];
+        nextFrontier[slot++] = child;
+      }
+    });
+    nrVisited += nextFrontier.size();
+    frontier.swap(nextFrontier);
+  }
+  if (nrVisited != n)
+    throw invalid_argument("lago: the spanning tree does not reach all poses");
+  return theta;
 }
 
 /* ************************************************************************* */
-VectorValues initializeOrientations(const NonlinearFactorGraph& graph,
-    bool useOdometricPath) {
+// Return the orientations of a graph including only BetweenFactors<Pose2>,
+// with the anchor at zero.
+std::vector<double> computeOrientations(const FlatPose2Graph& graph,
+                                        bool useOdometricPath) {
+  gttic(lago_computeOrientations);
+  const size_t n = graph.size(), m = graph.key1.size();
+
+  // Find a spanning tree
+  const std::vector<size_t> parent = useOdometricPath
+                                         ? findOdometricPath(graph)
+                                         : findBreadthFirstTree(graph);
+
+  // Relative orientations along the tree, as in getSymbolicGraph: an edge is
+  // in the tree if one of its end points is the parent of the other, and
+  // otherwise it is a chord.
+  std::vector<double> deltaTheta(n, std::numeric_limits<double>::quiet_NaN());
+  std::vector<bool> inTree(m, false);
+  for (size_t e = 0; e < m; e++) {
+    const size_t i1 = graph.key1[e], i2 = graph.key2[e];
+    if (parent[i1] == kNone || parent[i2] == kNone)
+      throw invalid_argument("lago: pose not in the spanning tree");
+    const double theta = graph.measured[e].theta();
+    if (parent[i1] == i2) {
+      if (std::isnan(deltaTheta[i1])) deltaTheta[i1] = -theta;
+      inTree[e] = true;
+    } else if (parent[i2] == i1) {
+      if (std::isnan(deltaTheta[i2])) deltaTheta[i2] = theta;
+      inTree[e] = true;
+    }
+  }
 
-  // We "extract" the Pose2 subgraph of the original graph: this
-  // is done to properly model priors and avoiding operating on a larger graph
-  NonlinearFactorGraph pose2Graph = initialize::buildPoseGraph<Pose2>(graph);
+  for (size_t i = 0; i < n; i++)
+    if (parent[i] != i && std::isnan(deltaTheta[i]))
+      throw invalid_argument(
+          "lago: spanning tree edge without a between factor");
 
-  // Get orientations from relative orientation measurements
-  return computeOrientations(pose2Graph, useOdometricPath);
+  // temporary structure to correct wraparounds along loops
+  const std::vector<double> thetaToRoot =
+      propagateOrientations(graph, parent, deltaTheta);
+
+  // Normal equations of the linear orientation graph, with the anchor
+  // eliminated as it is fixed to zero: every edge i-j contributes
+  // w * (theta_j - theta_i - delta)^2, where delta is the measurement for the
+  // tree edges, and the measurement regularized along the loop for chords.
+  // Unknowns are in elimination order, and only the lower triangle is stored.
+  const int anchorPosition = graph.position[graph.anchor];
+  auto variable = [&](size_t i) {
+    const int p = graph.position[i];
+    return p < anchorPosition ? p : p - 1;
+  };
+  std::vector<Eigen::Triplet<double> > triplets;
+  triplets.reserve(3 * m);
+  Vector b = Vector::Zero(n - 1);
+  for (size_t e = 0; e < m; e++) {
+    const size_t i1 = graph.key1[e], i2 = graph.key2[e];
+    if (!graph.models[e])
+      throw invalid_argument("buildLinearOrientationGraph: invalid noise model "
+          "(current version assumes diagonal noise model)!");
+    const double sigma = graph.models[e]->sigma(2);
+    const double w = 1.0 / (sigma * sigma);
+    double delta = graph.measured[e].theta();
+    if (!inTree[e]) {
+      const double k2pi_noise = delta + thetaToRoot[i1] - thetaToRoot[i2];
+      delta -= 2 * boost::math::round(k2pi_noise / (2 * M_PI)) * M_PI;
+    }
+    if (i1 != graph.anchor) {
+      triplets.emplace_back(variable(i1), variable(i1), w);
+      b(variable(i1)) -= w * delta;
+    }
+    if (i2 != graph.anchor) {
+      triplets.emplace_back(variable(i2), variable(i2), w);
+      b(variable(i2)) += w * delta;
+    }
+    if (i1 != graph.anchor && i2 != graph.anchor)
+      triplets.emplace_back(std::max(variable(i1), variable(i2)),
+                            std::min(variable(i1), variable(i2)), -w);
+  }
+  SparseMatrix A(n - 1, n - 1);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+
+  // Solve with a sparse Cholesky factorization
+  SparseLDLT ldlt(A);
+  if (ldlt.info() != Eigen::Success)
+    throw IndeterminantLinearSystemException(initialize::kAnchorKey);
+  const Vector x = ldlt.solve(b);
+
+  std::vector<double> orientations(n, 0.0);
+  for (size_t i = 0; i < n; i++)
+    if (i != graph.anchor) orientations[i] = x(variable(i));
+  return orientations;
 }
 
 /* ************************************************************************* */
-Values computePoses(const NonlinearFactorGraph& pose2graph,
-    VectorValues& orientationsLago) {
+// Return the poses of a graph including only BetweenFactors<Pose2>, given
+// their orientations. The linear system on full poses is solved with the
+// multifrontal Cholesky factorization, which uses dense kernels on the 3*3
+// blocks and is faster here than a scalar sparse factorization.
+Values computePoses(const FlatPose2Graph& graph,
+                    const std::vector<double>& orientations) {
   gttic(lago_computePoses);
+  const size_t m = graph.key1.size();
 
   // Linearized graph on full poses
   GaussianFactorGraph linearPose2graph;
-
-  // We include the linear version of each between factor
-  for(const boost::shared_ptr<NonlinearFactor>& factor: pose2graph) {
-
-    boost::shared_ptr<BetweenFactor<Pose2> > pose2Between =
-        boost::dynamic_pointer_cast<BetweenFactor<Pose2> >(factor);
-
-    if (pose2Between) {
-      Key key1 = pose2Between->keys()[0];
-      double theta1 = orientationsLago.at(key1)(0);
-      double s1 = sin(theta1);
-      double c1 = cos(theta1);
-
-      Key key2 = pose2Between->keys()[1];
-      double theta2 = orientationsLago.at(key2)(0);
-
-      double linearDeltaRot = theta2 - theta1
-          - pose2Between->measured().theta();
-      linearDeltaRot = Rot2(linearDeltaRot).theta(); // to normalize
-
-      double dx = pose2Between->measured().x();
-      double dy = pose2Between->measured().y();
-
-      Vector globalDeltaCart = //
-          (Vector(2) << c1 * dx - s1 * dy, s1 * dx + c1 * dy).finished();
-      Vector b = (Vector(3) << globalDeltaCart, linearDeltaRot).finished(); // rhs
-      Matrix J1 = -I3;
-      J1(0, 2) = s1 * dx + c1 * dy;
-      J1(1, 2) = -c1 * dx + s1 * dy;
-      // Retrieve the noise model for the relative rotation
-      boost::shared_ptr<noiseModel::Diagonal> diagonalModel =
-          boost::dynamic_pointer_cast<noiseModel::Diagonal>(
-              pose2Between->noiseModel());
-
-      linearPose2graph.add(key1, J1, key2, I3, b, diagonalModel);
-    } else {
-      throw invalid_argument(
-          "computeLagoPoses: cannot manage non between factor here!");
-    }
+  linearPose2graph.reserve(m + 1);
+  for (size_t e = 0; e < m; e++) {
+    const size_t i1 = graph.key1[e], i2 = graph.key2[e];
+    const Pose2& measured = graph.measured[e];
+    const double theta1 = orientations[i1];
+    const double s1 = sin(theta1), c1 = cos(theta1);
+    const double dx = measured.x(), dy = measured.y();
+    const double linearDeltaRot =
+        Rot2(orientations[i2] - theta1 - measured.theta()).theta();
+    const Vector3 b(c1 * dx - s1 * dy, s1 * dx + c1 * dy, linearDeltaRot);
+    Matrix3 J1 = -I3;
+    J1(0, 2) = s1 * dx + c1 * dy;
+    J1(1, 2) = -c1 * dx + s1 * dy;
+    linearPose2graph.emplace_shared<JacobianFactor>(
+        graph.keys[i1], J1, graph.keys[i2], I3, b, graph.models[e]);
   }
   // add prior
-  linearPose2graph.add(initialize::kAnchorKey, I3, Vector3(0.0, 0.0, 0.0),
-      priorPose2Noise);
+  linearPose2graph.emplace_shared<JacobianFactor>(
+      initialize::kAnchorKey, I3, Vector3::Zero(), priorPose2Noise);
 
-  // optimize
-  VectorValues posesLago = linearPose2graph.optimize();
+  // optimize, in the same order as the orientations
+  Ordering ordering;
+  ordering.reserve(graph.size());
+  for (int i : graph.order) ordering.push_back(graph.keys[i]);
+  const VectorValues posesLago = linearPose2graph.optimize(ordering);
 
   // put into Values structure
   Values initialGuessLago;
-  for(const VectorValues::value_type& it: posesLago) {
-    Key key = it.first;
-    if (key != initialize::kAnchorKey) {
-      const Vector& poseVector = it.second;
-      Pose2 poseLago = Pose2(poseVector(0), poseVector(1),
-          orientationsLago.at(key)(0) + poseVector(2));
-      initialGuessLago.insert(key, poseLago);
+  for (size_t i = 0; i < graph.size(); i++) {
+    if (i != graph.anchor) {
+      const Vector& poseVector = posesLago.at(graph.keys[i]);
+      initialGuessLago.insert(
+          graph.keys[i], Pose2(poseVector(0), poseVector(1),
+                               orientations[i] + poseVector(2)));
     }
   }
   return initialGuessLago;
 }
 
+}  // namespace
+
+/* ************************************************************************* */
+VectorValues initializeOrientations(const NonlinearFactorGraph& graph,
+    bool useOdometricPath) {
+
+  // We "extract" the Pose2 subgraph of the original graph: this
+  // is done to properly model priors and avoiding operating on a larger graph
+  const FlatPose2Graph pose2Graph(initialize::buildPoseGraph<Pose2>(graph));
+
+  // Get orientations from relative orientation measurements
+  const std::vector<double> orientations =
+      computeOrientations(pose2Graph, useOdometricPath);
+  VectorValues orientationsLago;
+  for (size_t i = 0; i < pose2Graph.size(); i++)
+    orientationsLago.insert(pose2Graph.keys[i], Vector1(orientations[i]));
+  return orientationsLago;
+}
+
 /* ************************************************************************* */
 Values initialize(const NonlinearFactorGraph& graph, bool useOdometricPath) {
   gttic(lago_initialize);
 
   // We "extract" the Pose2 subgraph of the original graph: this
   // is done to properly model priors and avoiding operating on a larger graph
-  NonlinearFactorGraph pose2Graph = initialize::buildPoseGraph<Pose2>(graph);
+  const FlatPose2Graph pose2Graph(initialize::buildPoseGraph<Pose2>(graph));
 
   // Get orientations from relative orientation measurements
-  VectorValues orientationsLago = computeOrientations(pose2Graph,
-      useOdometricPath);
+  const std::vector<double> orientations =
+      computeOrientations(pose2Graph, useOdometricPath);
 
   // Compute the full poses
-  return computePoses(pose2Graph, orientationsLago);
+  return computePoses(pose2Graph, orientations);
 }
 
 /* ************************************************************************* */
@@ -24,7 +24,8 @@
  *  that there is a subgraph involving Pose2 and betweenFactors). Also in the current
  *  version we assume that there is an odometric spanning path (x0->x1, x1->x2, etc)
  *  and a prior on x0. This assumption can be relaxed by using the extra argument
- *  useOdometricPath = false, although this part of code is not stable yet.
+ *  useOdometricPath = false, in which case a breadth-first spanning tree rooted
+ *  at the prior is used instead.
  *  @return Values: initial guess from LAGO (only pose2 are initialized)
  *
  *  @author Luca Carlone
@@ -273,6 +273,8 @@ class InitializePose3 {
   static gtsam::Values computeOrientationsGradient(
       const gtsam::NonlinearFactorGraph& pose3Graph,
       const gtsam::Values& givenGuess);
+  static gtsam::Values computeOrientationsPartitioned(
+      const gtsam::NonlinearFactorGraph& pose3Graph, size_t nrParts);
   static gtsam::NonlinearFactorGraph buildPose3graph(
       const gtsam::NonlinearFactorGraph& graph);
   static gtsam::Values initializeOrientations(
@@ -280,6 +282,9 @@ class InitializePose3 {
   static gtsam::Values initialize(const gtsam::NonlinearFactorGraph& graph,
                                   const gtsam::Values& givenGuess,
                                   bool useGradient);
+  static gtsam::Values initialize(const gtsam::NonlinearFactorGraph& graph,
+                                  const gtsam::Values& givenGuess,
+                                  bool useGradient, size_t nrParts);
   static gtsam::Values initialize(const gtsam::NonlinearFactorGraph& graph);
 };
 
@@ -9,6 +9,7 @@
 #include <gtsam/base/TestableAssertions.h>
 #include <gtsam/base/numericalDerivative.h>
 #include <gtsam/geometry/Pose3.h>
+#include <gtsam/geometry/Pose3T.h>
 #include <gtsam/geometry/Rot3.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/nonlinear/factorTesting.h>
@@ -116,6 +117,31 @@ TEST(BetweenFactor, Pose3Jacobians) {
   EXPECT_CORRECT_FACTOR_JACOBIANS(factor, values, 1e-7, 1e-5);
 }
 
+/* ************************************************************************* */
+// Poses with matrix and quaternion rotations linearize as Pose3
+TEST(BetweenFactor, Pose3Representations) {
+  SharedNoiseModel model = noiseModel::Isotropic::Sigma(6, 0.1);
+  const Pose3 measured(Rot3::Rodrigues(0.1, 0.2, 0.3), Point3(1, 2, 3));
+  const Pose3 pose1(Rot3::Rodrigues(-0.2, 0.1, 0.4), Point3(0, 1, 0));
+  const Pose3 pose2(Rot3::Rodrigues(0.3, 0.1, 0.5), Point3(1, 2, 4));
+
+  Values values;
+  values.insert(X(1), pose1);
+  values.insert(X(2), pose2);
+  const auto expected =
+      BetweenFactor<Pose3>(X(1), X(2), measured, model).linearize(values);
+
+  Values valuesM, valuesQ;
+  valuesM.insert(X(1), Pose3M(pose1));
+  valuesM.insert(X(2), Pose3M(pose2));
+  valuesQ.insert(X(1), Pose3Q(pose1));
+  valuesQ.insert(X(2), Pose3Q(pose2));
+  const BetweenFactor<Pose3M> factorM(X(1), X(2), Pose3M(measured), model);
+  const BetweenFactor<Pose3Q> factorQ(X(1), X(2), Pose3Q(measured), model);
+  EXPECT(assert_equal(*expected, *factorM.linearize(valuesM), 1e-9));
+  EXPECT(assert_equal(*expected, *factorQ.linearize(valuesQ), 1e-9));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -23,6 +23,7 @@
 #include <gtsam/slam/BetweenFactor.h>
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/geometry/Pose3.h>
+#include <gtsam/linear/linearExceptions.h>
 #include <CppUnitLite/TestHarness.h>
 
 #include <cmath>
@@ -108,6 +109,133 @@ TEST( InitializePose3, orientations ) {
   EXPECT(assert_equal(simple::R3, initial.at<Rot3>(x3), 1e-6));
 }
 
+/* *************************************************************************** */
+TEST( InitializePose3, chordalRelaxationSolver ) {
+  const string g2oFile = findExampleDataFile("pose3example-grid");
+  NonlinearFactorGraph::shared_ptr inputGraph;
+  Values::shared_ptr posesInFile;
+  bool is3D = true;
+  boost::tie(inputGraph, posesInFile) = readG2o(g2oFile, is3D);
+  inputGraph->addPrior(0, Pose3(), noiseModel::Unit::Create(6));
+  NonlinearFactorGraph pose3Graph = InitializePose3::buildPose3graph(*inputGraph);
+
+  // Same as solving the linear orientation graph
+  const Values expected = InitializePose3::normalizeRelaxedRotations(
+      InitializePose3::buildLinearOrientationGraph(pose3Graph).optimize());
+  ChordalRelaxationSolver solver;
+  EXPECT(assert_equal(expected, solver.solve(pose3Graph), 1e-9));
+  EXPECT_LONGS_EQUAL(1, solver.nrSymbolicFactorizations());
+
+  // Different measurements on the same structure re-use the symbolic analysis
+  NonlinearFactorGraph perturbed;
+  for (const auto& factor : pose3Graph) {
+    auto between = boost::dynamic_pointer_cast<BetweenFactor<Pose3> >(factor);
+    perturbed.emplace_shared<BetweenFactor<Pose3> >(
+        between->key1(), between->key2(),
+        between->measured().retract(0.01 * Vector6::Ones()), model);
+  }
+  EXPECT(assert_equal(
+      InitializePose3::normalizeRelaxedRotations(
+          InitializePose3::buildLinearOrientationGraph(perturbed).optimize()),
+      solver.solve(perturbed), 1e-9));
+  EXPECT_LONGS_EQUAL(1, solver.nrSymbolicFactorizations());
+
+  // A different structure is analyzed again
+  EXPECT(assert_equal(
+      InitializePose3::computeOrientationsChordal(
+          InitializePose3::buildPose3graph(simple::graph())),
+      solver.solve(InitializePose3::buildPose3graph(simple::graph())), 1e-9));
+  EXPECT_LONGS_EQUAL(2, solver.nrSymbolicFactorizations());
+
+  // A very tight prior is not mistaken for a singular system
+  NonlinearFactorGraph tight = simple::graph();
+  tight.addPrior(x1, simple::pose1, noiseModel::Isotropic::Sigma(6, 1e-8));
+  const Values actual = solver.solve(InitializePose3::buildPose3graph(tight));
+  EXPECT(assert_equal(simple::R3, actual.at<Rot3>(x3), 1e-6));
+
+  // Without the anchor the relaxation is singular
+  NonlinearFactorGraph unanchored;
+  unanchored.add(BetweenFactor<Pose3>(x0, x1, simple::pose0.between(simple::pose1), model));
+  CHECK_EXCEPTION(solver.solve(unanchored), IndeterminantLinearSystemException);
+}
+
+/* *************************************************************************** */
+TEST( InitializePose3, reuseChordalRelaxationSolvers ) {
+  const string g2oFile = findExampleDataFile("pose3example-grid");
+  NonlinearFactorGraph::shared_ptr inputGraph;
+  Values::shared_ptr posesInFile;
+  bool is3D = true;
+  boost::tie(inputGraph, posesInFile) = readG2o(g2oFile, is3D);
+  inputGraph->addPrior(0, Pose3(), noiseModel::Unit::Create(6));
+  NonlinearFactorGraph pose3Graph = InitializePose3::buildPose3graph(*inputGraph);
+
+  // Repeated calls with the same solver only analyze the structure once
+  ChordalRelaxationSolver solver;
+  const Values expected = InitializePose3::computeOrientationsChordal(pose3Graph);
+  for (size_t k = 0; k < 3; k++)
+    EXPECT(assert_equal(expected,
+        InitializePose3::computeOrientationsChordal(pose3Graph, &solver), 1e-9));
+  EXPECT_LONGS_EQUAL(1, solver.nrSymbolicFactorizations());
+
+  // Only BetweenFactor<Pose3> are supported
+  NonlinearFactorGraph withPrior = pose3Graph;
+  withPrior.addPrior(0, Pose3(), noiseModel::Unit::Create(6));
+  CHECK_EXCEPTION(solver.solve(withPrior), std::invalid_argument);
+}
+
+/* *************************************************************************** */
+TEST( InitializePose3, partitionPose3Graph ) {
+  NonlinearFactorGraph pose3Graph = InitializePose3::buildPose3graph(simple::graph());
+
+  std::map<Key, size_t> part = InitializePose3::partitionPose3Graph(pose3Graph, 2);
+  EXPECT_LONGS_EQUAL(5, part.size());  // includes the anchor
+  std::set<size_t> parts;
+  for (const auto& key_part : part) parts.insert(key_part.second);
+  EXPECT_LONGS_EQUAL(2, parts.size());
+
+  // more parts than keys is clamped
+  part = InitializePose3::partitionPose3Graph(pose3Graph, 10);
+  for (const auto& key_part : part) EXPECT(key_part.second < 5);
+}
+
+/* *************************************************************************** */
+TEST( InitializePose3, orientationsPartitioned ) {
+  NonlinearFactorGraph pose3Graph = InitializePose3::buildPose3graph(simple::graph());
+
+  for (size_t nrParts = 1; nrParts <= 4; nrParts++) {
+    Values initial =
+        InitializePose3::computeOrientationsPartitioned(pose3Graph, nrParts);
+    EXPECT_LONGS_EQUAL(4, initial.size());
+    EXPECT(assert_equal(simple::R0, initial.at<Rot3>(x0), 1e-6));
+    EXPECT(assert_equal(simple::R1, initial.at<Rot3>(x1), 1e-6));
+    EXPECT(assert_equal(simple::R2, initial.at<Rot3>(x2), 1e-6));
+    EXPECT(assert_equal(simple::R3, initial.at<Rot3>(x3), 1e-6));
+  }
+}
+
+/* *************************************************************************** */
+TEST( InitializePose3, orientationsPartitionedDisconnected ) {
+  // A second component, which no cut edge connects to the anchor
+  NonlinearFactorGraph graph = simple::graph();
+  const Rot3 R45 = Rot3::Ypr(0.3, -0.2, 0.1);
+  graph.emplace_shared<BetweenFactor<Pose3> >(
+      4, 5, Pose3(R45, Point3(1, 0, 0)), noiseModel::Unit::Create(6));
+  graph.emplace_shared<BetweenFactor<Pose3> >(
+      5, 6, Pose3(R45, Point3(1, 0, 0)), noiseModel::Unit::Create(6));
+  NonlinearFactorGraph pose3Graph = InitializePose3::buildPose3graph(graph);
+
+  for (size_t nrParts = 2; nrParts <= 4; nrParts++) {
+    Values initial =
+        InitializePose3::computeOrientationsPartitioned(pose3Graph, nrParts);
+    EXPECT_LONGS_EQUAL(7, initial.size());
+    EXPECT(assert_equal(simple::R1, initial.at<Rot3>(x1), 1e-6));
+    EXPECT(assert_equal(R45,
+        initial.at<Rot3>(4).between(initial.at<Rot3>(5)), 1e-6));
+    EXPECT(assert_equal(R45,
+        initial.at<Rot3>(5).between(initial.at<Rot3>(6)), 1e-6));
+  }
+}
+
 /* *************************************************************************** */
 TEST( InitializePose3, orientationsPrecisions ) {
   NonlinearFactorGraph pose3Graph = InitializePose3::buildPose3graph(simple::graph2());
@@ -280,6 +408,21 @@ TEST(InitializePose3, initializePoses) {
                       0.1));  // TODO(frank): very loose !!
 }
 
+/* ************************************************************************* */
+TEST(InitializePose3, initializePosesPartitioned) {
+  const string g2oFile = findExampleDataFile("pose3example-grid");
+  NonlinearFactorGraph::shared_ptr inputGraph;
+  Values::shared_ptr posesInFile;
+  bool is3D = true;
+  boost::tie(inputGraph, posesInFile) = readG2o(g2oFile, is3D);
+
+  auto priorModel = noiseModel::Unit::Create(6);
+  inputGraph->addPrior(0, Pose3(), priorModel);
+
+  Values initial = InitializePose3::initialize(*inputGraph, Values(), false, 4);
+  EXPECT(assert_equal(*posesInFile, initial, 0.1));
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
@@ -316,6 +316,34 @@ TEST( Lago, largeGraphNoisy ) {
   }
 }
 
+/* *************************************************************************** */
+TEST( Lago, largeGraphNoisyBreadthFirstTree ) {
+
+  string inputFile = findExampleDataFile("noisyToyGraph");
+  NonlinearFactorGraph::shared_ptr g;
+  Values::shared_ptr initial;
+  boost::tie(g, initial) = readG2o(inputFile);
+
+  // Add prior on the pose having index (key) = 0
+  NonlinearFactorGraph graphWithPrior = *g;
+  noiseModel::Diagonal::shared_ptr priorModel = noiseModel::Diagonal::Variances(Vector3(1e-2, 1e-2, 1e-4));
+  graphWithPrior.addPrior(0, Pose2(), priorModel);
+
+  // the spanning tree does not follow the odometry
+  bool useOdometricPath = false;
+  Values actual = lago::initialize(graphWithPrior, useOdometricPath);
+
+  string matlabFile = findExampleDataFile("optimizedNoisyToyGraph");
+  NonlinearFactorGraph::shared_ptr gmatlab;
+  Values::shared_ptr expected;
+  boost::tie(gmatlab, expected) = readG2o(matlabFile);
+
+  for(const auto key_val: *expected){
+    Key k = key_val.key;
+    EXPECT(assert_equal(expected->at<Pose2>(k), actual.at<Pose2>(k), 1e-2));
+  }
+}
+
 
 /* ************************************************************************* */
 int main() {
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file   testReducedCameraSystem.cpp
+ * @brief  Unit tests for the parallel assembly of smart factor Hessians
+ * @date   October, 2026
+ */
+
+#include "smartFactorScenarios.h"
+#include <gtsam/slam/ReducedCameraSystem.h>
+#include <gtsam/slam/PriorFactor.h>
+#include <gtsam/inference/Ordering.h>
+#include <gtsam/base/Testable.h>
+
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::X;
+
+namespace {
+const SharedNoiseModel kModel = noiseModel::Isotropic::Sigma(2, 0.5);
+const vector<Point3> kLandmarks = {landmark1, landmark2, landmark3, landmark4,
+                                   landmark5};
+const vector<Pose3> kPoses = {level_pose, pose_right, pose_above};
+
+// Poses, slightly perturbed so the smart factors have non-zero errors.
+Values createValues() {
+  Values values;
+  const Pose3 noise(Rot3::Rodrigues(-0.01, 0.02, 0.01), Point3(0.1, -0.1, 0.05));
+  for (size_t i = 0; i < kPoses.size(); i++)
+    values.insert(X(i), i == 0 ? kPoses[i] : kPoses[i].compose(noise));
+  return values;
+}
+
+// Compare the linearized graph with the reduced camera system.
+bool compareLinearized(const NonlinearFactorGraph& graph,
+                       const Values& values) {
+  const ReducedCameraSystem<vanillaPose2::Camera> system(graph);
+  const Ordering ordering(values.keys());
+  const Matrix expected = graph.linearize(values)->augmentedHessian(ordering);
+  const Matrix actual =
+      system.linearizeGraph(values)->augmentedHessian(ordering);
+  return assert_equal(expected, actual, 1e-6);
+}
+}  // namespace
+
+/* ************************************************************************* */
+TEST(ReducedCameraSystem, PoseFactors) {
+  using namespace vanillaPose2;
+  NonlinearFactorGraph graph;
+  for (const Point3& landmark : kLandmarks) {
+    auto factor = boost::make_shared<SmartFactor>(kModel, sharedK2);
+    for (size_t i = 0; i < kPoses.size(); i++)
+      factor->add(Camera(kPoses[i], sharedK2).project(landmark), X(i));
+    graph.push_back(factor);
+  }
+
+  // A track seen once is degenerate and should not contribute.
+  auto single = boost::make_shared<SmartFactor>(kModel, sharedK2);
+  single->add(cam1.project(landmark1), X(0));
+  graph.push_back(single);
+
+  graph.addPrior(X(0), level_pose, noiseModel::Isotropic::Sigma(6, 0.01));
+
+  const ReducedCameraSystem<Camera> system(graph);
+  EXPECT_LONGS_EQUAL(6, system.size());
+  EXPECT(system.keys() == KeyVector({X(0), X(1), X(2)}));
+  EXPECT_LONGS_EQUAL(1, system.others().size());
+
+  const Values values = createValues();
+  EXPECT(compareLinearized(graph, values));
+
+  // With damping, compare with the damped Hessian of every factor.
+  const double lambda = 0.5;
+  GaussianFactorGraph expected;
+  for (const auto& factor : graph) {
+    auto smart = boost::dynamic_pointer_cast<SmartFactor>(factor);
+    if (smart) expected.push_back(smart->linearizeToHessian(values, lambda));
+  }
+  const Ordering ordering(values.keys());
+  const GaussianFactorGraph::shared_ptr actual =
+      system.linearize(values, lambda);
+  EXPECT(assert_equal(expected.augmentedHessian(ordering),
+                      actual->augmentedHessian(ordering), 1e-6));
+}
+
+/* ************************************************************************* */
+TEST(ReducedCameraSystem, Sparsity) {
+  using namespace vanillaPose2;
+  // Tracks seen by cameras 0 and 1, and by cameras 1 and 2, only.
+  NonlinearFactorGraph graph;
+  for (size_t i = 0; i + 1 < kPoses.size(); i++)
+    for (const Point3& landmark : kLandmarks) {
+      auto factor = boost::make_shared<SmartFactor>(kModel, sharedK2);
+      for (size_t j = i; j < i + 2; j++)
+        factor->add(Camera(kPoses[j], sharedK2).project(landmark), X(j));
+      graph.push_back(factor);
+    }
+  graph.addPrior(X(0), level_pose, noiseModel::Isotropic::Sigma(6, 0.01));
+  const Values values = createValues();
+  EXPECT(compareLinearized(graph, values));
+
+  // One factor per camera, and one per pair of cameras sharing tracks.
+  const ReducedCameraSystem<Camera> system(graph);
+  const GaussianFactorGraph linear = *system.linearize(values);
+  EXPECT_LONGS_EQUAL(5, linear.size());
+  for (const auto& factor : linear)
+    EXPECT(factor->keys() != KeyVector({X(0), X(2)}));
+}
+
+/* ************************************************************************* */
+TEST(ReducedCameraSystem, RigFactors) {
+  using namespace vanillaPose2;
+  // Two cameras on every body pose, so measurements share Hessian blocks.
+  auto cameraRig = boost::make_shared<Cameras>();
+  cameraRig->push_back(Camera(Pose3::identity(), sharedK2));
+  cameraRig->push_back(
+      Camera(Pose3(Rot3::Ypr(0.05, 0, 0), Point3(0.2, 0, 0)), sharedK2));
+  const SmartProjectionParams params(HESSIAN, ZERO_ON_DEGENERACY);
+
+  NonlinearFactorGraph graph;
+  for (const Point3& landmark : kLandmarks) {
+    auto factor = boost::make_shared<SmartRigFactor>(kModel, cameraRig, params);
+    for (size_t i = 0; i < kPoses.size(); i++)
+      for (size_t c = 0; c < cameraRig->size(); c++) {
+        const Camera camera(kPoses[i] * cameraRig->at(c).pose(), sharedK2);
+        factor->add(camera.project(landmark), X(i), c);
+      }
+    graph.push_back(factor);
+  }
+  graph.addPrior(X(0), level_pose, noiseModel::Isotropic::Sigma(6, 0.01));
+
+  EXPECT(compareLinearized(graph, createValues()));
+}
+
+/* ************************************************************************* */
+int main() {
+  TestResult tr;
+  return TestRegistry::runAllTests(tr);
+}
+/* ************************************************************************* */
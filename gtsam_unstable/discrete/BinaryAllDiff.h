@@ -76,9 +76,16 @@ class BinaryAllDiff : public Constraint {
    * @return true if domains->at(j) was changed, false otherwise.
    */
   bool ensureArcConsistency(Key j, Domains* domains) const override {
-    throw std::runtime_error(
-        "BinaryAllDiff::ensureArcConsistency not implemented");
-    return false;
+    if (j != keys_[0] && j != keys_[1])
+      throw std::invalid_argument("BinaryAllDiff check on wrong domain");
+    // If the other domain is a singleton, j cannot take on its value
+    const Domain& Dk = domains->at(j == keys_[0] ? keys_[1] : keys_[0]);
+    if (!Dk.isSingleton()) return false;
+    Domain& Dj = domains->at(j);
+    const size_t value = Dk.firstValue();
+    if (!Dj.contains(value)) return false;
+    Dj.erase(value);
+    return true;
   }
 
   /// Partially apply known values
@@ -6,14 +6,35 @@
  */
 
 #include <gtsam/base/Testable.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
 #include <gtsam/discrete/DiscreteBayesNet.h>
 #include <gtsam_unstable/discrete/CSP.h>
 #include <gtsam_unstable/discrete/Domain.h>
 
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+
 using namespace std;
 
 namespace gtsam {
 
+namespace {
+// Call f(k) for k in [0, n), in parallel if TBB is available.
+template <class FUNCTION>
+void parallelFor(size_t n, const FUNCTION& f) {
+#ifdef GTSAM_USE_TBB
+  if (n > 1) {
+    tbb::parallel_for(size_t(0), n, f);
+    return;
+  }
+#endif
+  for (size_t k = 0; k < n; ++k) f(k);
+}
+}  // namespace
+
 bool CSP::runArcConsistency(const VariableIndex& index,
                             Domains* domains) const {
   bool changed = false;
@@ -39,23 +60,97 @@ bool CSP::runArcConsistency(const VariableIndex& index,
   return changed;
 }
 
-// TODO(dellaert): This is AC1, which is inefficient as any change will cause
-// the algorithm to revisit *all* variables again. Implement AC3.
 Domains CSP::runArcConsistency(size_t cardinality, size_t maxIterations) const {
-  // Create VariableIndex
-  VariableIndex index(*this);
-
   // Initialize domains
   Domains domains;
-  for (auto entry : index) {
-    const Key key = entry.first;
-    domains.emplace(key, DiscreteKey(key, cardinality));
+  for (Key key : keys()) domains.emplace(key, DiscreteKey(key, cardinality));
+  return runArcConsistency(std::move(domains), maxIterations);
+}
+
+Domains CSP::runArcConsistency(Domains domains, size_t maxIterations) const {
+  // Number the variables, and collect the constraints on each variable and the
+  // other variables in those constraints, its neighbors.
+  const VariableIndex index(*this);
+  const size_t n = index.size();
+  KeyVector keys;
+  std::vector<Domain*> D;
+  keys.reserve(n);
+  D.reserve(n);
+  for (const auto& entry : index) {
+    keys.push_back(entry.first);
+    D.push_back(&domains.at(entry.first));
+  }
+  auto indexOf = [&keys](Key key) {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+  };
+  std::vector<std::vector<Constraint::shared_ptr> > constraints(n);
+  std::vector<std::vector<size_t> > neighbors(n);
+  for (size_t i = 0; i < n; i++) {
+    for (size_t f : index[keys[i]]) {
+      auto constraint = boost::dynamic_pointer_cast<Constraint>((*this)[f]);
+      if (!constraint) continue;
+      constraints[i].push_back(constraint);
+      for (Key k : constraint->keys())
+        if (k != keys[i]) neighbors[i].push_back(indexOf(k));
+    }
+    std::sort(neighbors[i].begin(), neighbors[i].end());
+    neighbors[i].erase(std::unique(neighbors[i].begin(), neighbors[i].end()),
+                       neighbors[i].end());
+  }
+
+  // Color the variables such that no two neighbors have the same color. The
+  // variables of one color only read the domains of other colors, so they can
+  // be revised concurrently, in place.
+  std::vector<size_t> color(n, 0);
+  size_t nrColors = 0;
+  {
+    std::vector<size_t> usedBy(n + 1, n);  // the last variable using a color
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k : neighbors[i])
+        if (k < i) usedBy[color[k]] = i;
+      while (usedBy[color[i]] == i) color[i]++;
+      nrColors = std::max(nrColors, color[i] + 1);
+    }
   }
 
-  // Iterate until convergence or not a single domain changed.
-  for (size_t it = 0; it < maxIterations; it++) {
-    bool changed = runArcConsistency(index, &domains);
-    if (!changed) break;
+  // Start with all variables in the worklist, which has a list per color.
+  std::vector<std::vector<size_t> > worklist(nrColors);
+  for (size_t i = 0; i < n; i++) worklist[color[i]].push_back(i);
+  std::vector<bool> queued(n, false);
+  bool empty = (n == 0);
+
+  for (size_t it = 0; it < maxIterations && !empty; it++) {
+    // Revise the variables in the worklist, one color after the other.
+    std::vector<std::vector<size_t> > next(nrColors);
+    for (const std::vector<size_t>& variables : worklist) {
+      std::vector<char> changed(variables.size(), 0);
+      parallelFor(variables.size(), [&](size_t w) {
+        const size_t i = variables[w];
+        // If this domain is already a singleton, we do nothing.
+        if (D[i]->isSingleton()) return;
+        const size_t nrValues = D[i]->nrValues();
+        for (const Constraint::shared_ptr& constraint : constraints[i])
+          constraint->ensureArcConsistency(keys[i], &domains);
+        changed[w] = D[i]->nrValues() != nrValues;
+      });
+
+      // Queue the neighbors of the changed variables for the next round.
+      for (size_t w = 0; w < variables.size(); w++)
+        if (changed[w])
+          for (size_t k : neighbors[variables[w]])
+            if (!queued[k]) {
+              queued[k] = true;
+              next[color[k]].push_back(k);
+            }
+    }
+
+    empty = true;
+    for (std::vector<size_t>& variables : next) {
+      for (size_t k : variables) queued[k] = false;
+      std::sort(variables.begin(), variables.end());
+      empty = empty && variables.empty();
+    }
+    worklist.swap(next);
   }
   return domains;
 }
@@ -59,11 +59,22 @@ class GTSAM_UNSTABLE_EXPORT CSP : public DiscreteFactorGraph {
    * Apply arc-consistency ~ Approximate loopy belief propagation
    * We need to give the domains to a constraint, and it returns
    * a domain whose values don't conflict in the arc-consistency way.
-   * TODO: should get cardinality from DiscreteKeys
+   * All variables start out with the same cardinality.
    */
   Domains runArcConsistency(size_t cardinality,
                             size_t maxIterations = 10) const;
 
+  /*
+   * Apply arc-consistency starting from the given domains, which should
+   * contain a domain for every variable in the graph.
+   * This is AC-3: the first round revises all variables, and every next round
+   * only the neighbors of the variables whose domain changed, until no domain
+   * changes or maxIterations rounds were done. Neighboring variables get
+   * different colors, and the variables of one color are revised concurrently
+   * (with TBB).
+   */
+  Domains runArcConsistency(Domains domains, size_t maxIterations = 10) const;
+
   /// Run arc consistency for all variables, return true if any domain changed.
   bool runArcConsistency(const VariableIndex& index, Domains* domains) const;
 
@@ -19,14 +19,18 @@ using namespace std;
 void Domain::print(const string& s, const KeyFormatter& formatter) const {
   cout << s << ": Domain on " << formatter(key()) << " (j=" << formatter(key())
        << ") with values";
-  for (size_t v : values_) cout << " " << v;
+  for (size_t v = values_.find_first(); v != values_.npos;
+       v = values_.find_next(v))
+    cout << " " << v;
   cout << endl;
 }
 
 /* ************************************************************************* */
 string Domain::base1Str() const {
   stringstream ss;
-  for (size_t v : values_) ss << v + 1;
+  for (size_t v = values_.find_first(); v != values_.npos;
+       v = values_.find_next(v))
+    ss << v + 1;
   return ss.str();
 }
 
@@ -55,8 +59,8 @@ DecisionTreeFactor Domain::operator*(const DecisionTreeFactor& f) const {
 bool Domain::ensureArcConsistency(Key j, Domains* domains) const {
   if (j != key()) throw invalid_argument("Domain check on wrong domain");
   Domain& D = domains->at(j);
-  for (size_t value : values_)
-    if (!D.contains(value)) throw runtime_error("Unsatisfiable");
+  if (D.cardinality_ != cardinality_ || !values_.is_subset_of(D.values_))
+    throw runtime_error("Unsatisfiable");
   D = *this;
   return true;
 }
@@ -65,17 +69,23 @@ bool Domain::ensureArcConsistency(Key j, Domains* domains) const {
 boost::optional<Domain> Domain::checkAllDiff(const KeyVector keys,
                                              const Domains& domains) const {
   Key j = key();
-  // for all values in this domain
-  for (const size_t value : values_) {
-    // for all connected domains
-    for (const Key k : keys)
-      // if any domain contains the value we cannot make this domain singleton
-      if (k != j && domains.at(k).contains(value)) goto found;
-    // Otherwise: return a singleton:
-    return Domain(this->discreteKey(), value);
-  found:;
+  // Remove the values of all connected domains from this one
+  boost::dynamic_bitset<> unique = values_;
+  for (const Key k : keys) {
+    if (unique.none()) return boost::none;  // we did not change it
+    if (k == j) continue;
+    const Domain& Dk = domains.at(k);
+    if (Dk.cardinality_ == cardinality_) {
+      unique -= Dk.values_;
+    } else {
+      for (size_t v = Dk.values_.find_first(); v != Dk.values_.npos;
+           v = Dk.values_.find_next(v))
+        if (v < cardinality_) unique.reset(v);
+    }
   }
-  return boost::none;  // we did not change it
+  if (unique.none()) return boost::none;
+  // A value that no other domain contains: return a singleton
+  return Domain(this->discreteKey(), unique.find_first());
 }
 
 /* ************************************************************************* */
@@ -89,7 +99,7 @@ Constraint::shared_ptr Domain::partiallyApply(const DiscreteValues& values) cons
 /* ************************************************************************* */
 Constraint::shared_ptr Domain::partiallyApply(const Domains& domains) const {
   const Domain& Dk = domains.at(key());
-  if (Dk.isSingleton() && !contains(*Dk.begin()))
+  if (Dk.isSingleton() && !contains(Dk.firstValue()))
     throw runtime_error("Domain::partiallyApply: unsatisfiable");
   return boost::make_shared<Domain>(Dk);
 }
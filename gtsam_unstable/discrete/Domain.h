@@ -10,30 +10,39 @@
 #include <gtsam/discrete/DiscreteKey.h>
 #include <gtsam_unstable/discrete/Constraint.h>
 
+#include <boost/dynamic_bitset.hpp>
+
 namespace gtsam {
 
 /**
  * The Domain class represents a constraint that restricts the possible values a
  * particular variable, with given key, can take on.
+ * The allowed values are stored as a bitset of size cardinality, so that
+ * membership tests are constant time and arc consistency can combine domains
+ * with word-wide set operations.
  */
 class GTSAM_UNSTABLE_EXPORT Domain : public Constraint {
-  size_t cardinality_;       /// Cardinality
-  std::set<size_t> values_;  /// allowed values
+  size_t cardinality_;              /// Cardinality
+  boost::dynamic_bitset<> values_;  /// allowed values
 
  public:
   typedef boost::shared_ptr<Domain> shared_ptr;
 
   // Constructor on Discrete Key initializes an "all-allowed" domain
   Domain(const DiscreteKey& dkey)
-      : Constraint(dkey.first), cardinality_(dkey.second) {
-    for (size_t v = 0; v < cardinality_; v++) values_.insert(v);
+      : Constraint(dkey.first),
+        cardinality_(dkey.second),
+        values_(dkey.second) {
+    values_.set();
   }
 
   // Constructor on Discrete Key with single allowed value
   // Consider SingleValue constraint
   Domain(const DiscreteKey& dkey, size_t v)
-      : Constraint(dkey.first), cardinality_(dkey.second) {
-    values_.insert(v);
+      : Constraint(dkey.first),
+        cardinality_(dkey.second),
+        values_(dkey.second) {
+    values_.set(v);
   }
 
   /// The one key
@@ -43,16 +52,16 @@ class GTSAM_UNSTABLE_EXPORT Domain : public Constraint {
   DiscreteKey discreteKey() const { return DiscreteKey(key(), cardinality_); }
 
   /// Insert a value, non const :-(
-  void insert(size_t value) { values_.insert(value); }
+  void insert(size_t value) { values_.set(value); }
 
   /// Erase a value, non const :-(
-  void erase(size_t value) { values_.erase(value); }
+  void erase(size_t value) { values_.reset(value); }
 
-  size_t nrValues() const { return values_.size(); }
+  size_t nrValues() const { return values_.count(); }
 
   bool isSingleton() const { return nrValues() == 1; }
 
-  size_t firstValue() const { return *values_.begin(); }
+  size_t firstValue() const { return values_.find_first(); }
 
   // print
   void print(const std::string& s = "", const KeyFormatter& formatter =
@@ -73,7 +82,9 @@ class GTSAM_UNSTABLE_EXPORT Domain : public Constraint {
   std::string base1Str() const;
 
   // Check whether domain cotains a specific value.
-  bool contains(size_t value) const { return values_.count(value) > 0; }
+  bool contains(size_t value) const {
+    return value < cardinality_ && values_.test(value);
+  }
 
   /// Calculate value
   double operator()(const DiscreteValues& values) const override;
@@ -62,6 +62,20 @@ TEST(CSP, BinaryAllDif) {
   DecisionTreeFactor f3 = f1 * f2;
   EXPECT(assert_equal(f3, c1 * f2));
   EXPECT(assert_equal(f3, c2 * f1));
+
+  // Arc-consistency removes the value of a singleton domain from the other
+  Domains domains;
+  domains.emplace(0, Domain(ID));
+  domains.emplace(1, Domain(AZ, 1));
+  domains.emplace(2, Domain(UT));
+  EXPECT(!c1.ensureArcConsistency(0, &domains));
+  LONGS_EQUAL(2, domains.at(0).nrValues());
+  EXPECT(c2.ensureArcConsistency(2, &domains));
+  EXPECT(!c2.ensureArcConsistency(1, &domains));
+  LONGS_EQUAL(1, domains.at(2).nrValues());
+  LONGS_EQUAL(0, domains.at(2).firstValue());
+  EXPECT(c1.ensureArcConsistency(0, &domains));
+  LONGS_EQUAL(1, domains.at(0).firstValue());
 }
 
 /* ************************************************************************* */
@@ -266,6 +280,39 @@ TEST(CSP, ArcConsistency) {
   // GTSAM_PRINT(csp);
 }
 
+/* ************************************************************************* */
+TEST(CSP, AC3) {
+  // Three all-diff constraints on a cycle of six variables, with three values.
+  DiscreteKey X0(0, 3), X1(1, 3), X2(2, 3), X3(3, 3), X4(4, 3), X5(5, 3);
+  CSP csp;
+  csp.addAllDiff(DiscreteKeys{X0, X1, X2});
+  csp.addAllDiff(DiscreteKeys{X2, X3, X4});
+  csp.addAllDiff(DiscreteKeys{X4, X5, X0});
+  csp.addSingleValue(X0, 0);
+  csp.addSingleValue(X1, 1);
+
+  // Arc consistency fixes all variables, as does iterating AC1 to convergence.
+  const Domains actual = csp.runArcConsistency(3);
+  Domains expected;
+  for (Key j = 0; j < 6; j++) expected.emplace(j, Domain(DiscreteKey(j, 3)));
+  const VariableIndex index(csp);
+  while (csp.runArcConsistency(index, &expected)) {
+  }
+  const size_t values[] = {0, 1, 2, 0, 1, 2};
+  for (Key j = 0; j < 6; j++) {
+    EXPECT(actual.at(j).isSingleton());
+    EXPECT_LONGS_EQUAL(values[j], actual.at(j).firstValue());
+    EXPECT(expected.at(j).equals(actual.at(j), 1e-9));
+  }
+
+  // Starting from narrowed domains, one round suffices here.
+  Domains domains = expected;
+  domains.at(5) = Domain(X5);
+  const Domains narrowed = csp.runArcConsistency(domains, 1);
+  EXPECT(narrowed.at(5).isSingleton());
+  EXPECT_LONGS_EQUAL(2, narrowed.at(5).firstValue());
+}
+
 /* ************************************************************************* */
 int main() {
   TestResult tr;
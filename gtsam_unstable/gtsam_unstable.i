@@ -555,6 +555,8 @@ class FixedLagSmootherResult {
   size_t getIterations() const;
   size_t getNonlinearVariables() const;
   size_t getLinearVariables() const;
+  size_t getMarginalizedVariables() const;
+  size_t getReeliminatedVariables() const;
   double getError() const;
 };
 
@@ -596,6 +598,8 @@ virtual class IncrementalFixedLagSmoother : gtsam::FixedLagSmoother {
   IncrementalFixedLagSmoother();
   IncrementalFixedLagSmoother(double smootherLag);
   IncrementalFixedLagSmoother(double smootherLag, const gtsam::ISAM2Params& params);
+  IncrementalFixedLagSmoother(double smootherLag, const gtsam::ISAM2Params& params,
+                              bool chronologicalOrdering);
 
   void print(string s = "IncrementalFixedLagSmoother:\n") const;
 
@@ -193,8 +193,17 @@ Template typename This::State This::iterate(
     const typename This::State& state) const {
   // Algorithm 16.3 from Nocedal06book.
   // Solve with the current working set eqn 16.39, but solve for x not p
-  auto workingGraph = buildWorkingGraph(state.workingSet, state.values);
-  VectorValues newValues = workingGraph.optimize();
+  GaussianISAM::shared_ptr factorization = state.factorization;
+  VectorValues newValues;
+  if (!POLICY::constantCost) {
+    newValues = buildWorkingGraph(state.workingSet, state.values).optimize();
+  } else {
+    if (!factorization) {
+      factorization = boost::make_shared<GaussianISAM>();
+      factorization->update(buildWorkingGraph(state.workingSet, state.values));
+    }
+    newValues = factorization->optimize();
+  }
   // If we CAN'T move further
   // if p_k = 0 is the original condition, modified by Duy to say that the state
   // update is zero.
@@ -206,9 +215,10 @@ Template typename This::State This::iterate(
     // If all inequality constraints are satisfied: We have the solution!!
     if (leavingFactor < 0) {
       return State(newValues, duals, state.workingSet, true,
-          state.iterations + 1);
+          state.iterations + 1, factorization);
     } else {
-      // Inactivate the leaving constraint
+      // Inactivate the leaving constraint, which cannot be removed from the
+      // factorization
       InequalityFactorGraph newWorkingSet = state.workingSet;
       newWorkingSet.at(leavingFactor)->inactivate();
       return State(newValues, duals, newWorkingSet, false,
@@ -222,14 +232,21 @@ Template typename This::State This::iterate(
     VectorValues p = newValues - state.values;
     boost::tie(alpha, factorIx) = // using 16.41
         computeStepSize(state.workingSet, state.values, p, POLICY::maxAlpha);
-    // also add to the working set the one that complains the most
+    // also add to the working set the one that complains the most, and
+    // update the factorization with it, in place
     InequalityFactorGraph newWorkingSet = state.workingSet;
-    if (factorIx >= 0)
+    if (factorIx >= 0) {
       newWorkingSet.at(factorIx)->activate();
+      if (factorization) {
+        GaussianFactorGraph enteringFactor;
+        enteringFactor.push_back(newWorkingSet.at(factorIx));
+        factorization->update(enteringFactor);
+      }
+    }
     // step!
     newValues = state.values + alpha * p;
     return State(newValues, state.duals, newWorkingSet, false,
-        state.iterations + 1);
+        state.iterations + 1, factorization);
   }
 }
 
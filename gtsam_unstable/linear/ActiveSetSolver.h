@@ -19,6 +19,7 @@
 #pragma once
 
 #include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/GaussianISAM.h>
 #include <gtsam_unstable/linear/InequalityFactorGraph.h>
 #include <boost/range/adaptor/map.hpp>
 
@@ -45,6 +46,9 @@ public:
     bool converged;     //!< True if the algorithm has converged to a solution
     size_t iterations;  /*!< Number of iterations. Incremented at the end of
                         each iteration. */
+    GaussianISAM::shared_ptr factorization; /*!< factorization of the working
+                        graph of workingSet, or null if it has to be computed
+                        again. Only kept if POLICY::constantCost. */
 
     /// Default constructor
     State()
@@ -53,12 +57,14 @@ public:
     /// Constructor with initial values
     State(const VectorValues& initialValues, const VectorValues& initialDuals,
           const InequalityFactorGraph& initialWorkingSet, bool _converged,
-          size_t _iterations)
+          size_t _iterations,
+          const GaussianISAM::shared_ptr& _factorization = nullptr)
         : values(initialValues),
           duals(initialDuals),
           workingSet(initialWorkingSet),
           converged(_converged),
-          iterations(_iterations) {}
+          iterations(_iterations),
+          factorization(_factorization) {}
   };
 
 protected:
@@ -168,7 +174,16 @@ public: /// Just for testing...
       const InequalityFactorGraph& workingSet,
       const VectorValues& xk = VectorValues()) const;
 
-  /// Iterate 1 step, return a new state with a new workingSet and values
+  /**
+   * Iterate 1 step, return a new state with a new workingSet and values.
+   * If the cost does not depend on the current values (POLICY::constantCost),
+   * the factorization of the working graph is passed on to the next state, and
+   * updated incrementally, as in ISAM, when a constraint enters the working
+   * set. It is computed again only after a constraint leaves the working set.
+   * The factorization is updated in place, like the constraints of the
+   * working set are (in)activated in place, so the given state should not be
+   * iterated again.
+   */
   State iterate(const State& state) const;
 
   /// Identify active constraints based on initial values.
@@ -32,6 +32,10 @@ struct LPPolicy {
   /// For LP, maxAlpha = Infinity
   static constexpr double maxAlpha = std::numeric_limits<double>::infinity();
 
+  /// The cost depends on the current solution, see buildCostFunction, so the
+  /// working graph is factorized again at every iteration
+  static constexpr bool constantCost = false;
+
   /**
    * Create the factor ||x-xk - (-g)||^2 where xk is the current feasible solution
    * on the constraint surface and g is the gradient of the linear cost,
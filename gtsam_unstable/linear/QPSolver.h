@@ -31,6 +31,10 @@ struct QPPolicy {
   /// For QP, maxAlpha = 1 is the minimum point of the quadratic cost
   static constexpr double maxAlpha = 1.0;
 
+  /// The cost does not depend on the current solution, so the factorization of
+  /// the working graph is updated incrementally
+  static constexpr bool constantCost = true;
+
   /// Simply the cost of the QP problem
   static const GaussianFactorGraph buildCostFunction(const QP& qp,
       const VectorValues& xk = VectorValues()) {
@@ -196,6 +196,71 @@ TEST(QPSolver, iterate) {
   CHECK(assert_equal(expected[3], state.values, 1e-10));
 }
 
+/* ************************************************************************* */
+// Regulate a double integrator from x0 to the origin over a horizon of n
+// steps, with |u| <= 0.5
+QP createMPC(const Vector2& x0, size_t n) {
+  Matrix2 A;
+  A << 1, 0.1, 0, 1;
+  const Matrix21 B(0.005, 0.1);
+  QP qp;
+  size_t dual = 0;
+  qp.equalities.add(X(0), I_2x2, x0, dual++);
+  for (size_t k = 0; k < n; k++) {
+    qp.cost.add(X(k + 1), I_2x2, Z_2x1);
+    qp.cost.add(U(k), 0.3 * I_1x1, kZero);
+    qp.equalities.add(X(k + 1), I_2x2, X(k), -A, U(k), -B, Z_2x1, dual++);
+    qp.inequalities.add(U(k), I_1x1, 0.5, dual++);
+    qp.inequalities.add(U(k), -I_1x1, 0.5, dual++);
+  }
+  return qp;
+}
+
+/* ************************************************************************* */
+TEST(QPSolver, incrementalFactorization) {
+  const QP qp = createMPC(Vector2(2.0, 0.0), 8);
+  QPSolver solver(qp);
+  VectorValues initialValues;
+  for (size_t k = 0; k <= 8; k++) initialValues.insert(X(k), Z_2x1);
+  for (size_t k = 0; k < 8; k++) initialValues.insert(U(k), kZero);
+
+  // The same iterations as when factorizing every working graph from scratch
+  QPSolver::State incremental(initialValues, VectorValues(),
+      solver.identifyActiveConstraints(qp.inequalities, initialValues), false,
+      0);
+  QPSolver::State batch(initialValues, VectorValues(),
+      solver.identifyActiveConstraints(qp.inequalities, initialValues), false,
+      0);
+  size_t nrUpdated = 0;
+  while (!incremental.converged) {
+    const GaussianISAM::shared_ptr factorization = incremental.factorization;
+    const bool updated = factorization != nullptr;
+    incremental = solver.iterate(incremental);
+    // Entering constraints update the factorization in place
+    if (updated && incremental.factorization)
+      EXPECT(factorization == incremental.factorization);
+    batch.factorization.reset();
+    batch = solver.iterate(batch);
+    EXPECT(assert_equal(batch.values, incremental.values, 1e-9));
+    EXPECT(batch.converged == incremental.converged);
+    if (updated) ++nrUpdated;
+  }
+  EXPECT(nrUpdated > 0);
+  EXPECT(assert_equal(solver.optimize().first, incremental.values, 1e-7));
+}
+
+/* ************************************************************************* */
+TEST(QPSolver, warmStart) {
+  // Start from the solution and working set of the problem at the previous
+  // state, which satisfies all inequalities
+  VectorValues values, duals;
+  boost::tie(values, duals) = QPSolver(createMPC(Vector2(2.0, 0.0), 8)).optimize();
+  const QP qp = createMPC(values.at(X(1)), 8);
+  const VectorValues expected = QPSolver(qp).optimize().first;
+  EXPECT(assert_equal(expected, QPSolver(qp).optimize(values, duals, true).first,
+                      1e-7));
+}
+
 /* ************************************************************************* */
 
 TEST(QPSolver, optimizeForst10book_pg171Ex5) {
@@ -73,6 +73,8 @@ FixedLagSmoother::Result BatchFixedLagSmoother::update(
   for(const size_t i : factorsToRemove){
     if(factors_[i])
       factors_[i].reset();
+    if(i < linearFactors_.size())
+      linearFactors_[i].reset();
   }
 
   // Update the Timestamps associated with the factor keys
@@ -104,6 +106,7 @@ FixedLagSmoother::Result BatchFixedLagSmoother::update(
     marginalize(marginalizableKeys);
   }
   gttoc(marginalize);
+  result.marginalizedVariables = marginalizableKeys.size();
 
   return result;
 }
@@ -126,6 +129,12 @@ void BatchFixedLagSmoother::insertFactors(
     for(Key key: *factor) {
       factorIndex_[key].insert(index);
     }
+    // The factor in this slot has not been linearized yet
+    if (incremental_) {
+      if (index >= linearFactors_.size())
+        linearFactors_.resize(index + 1);
+      linearFactors_[index].reset();
+    }
   }
 }
 
@@ -140,6 +149,8 @@ void BatchFixedLagSmoother::removeFactors(
       }
       // Remove the factor from the factor graph
       factors_.remove(slot);
+      if (slot < linearFactors_.size())
+        linearFactors_[slot].reset();
       // Add the factor's old slot to the list of available slots
       availableSlots_.push(slot);
     } else {
@@ -181,6 +192,44 @@ void BatchFixedLagSmoother::reorder(const KeyVector& marginalizeKeys) {
   ordering_ = Ordering::ColamdConstrainedFirst(factors_, marginalizeKeys);
 }
 
+/* ************************************************************************* */
+GaussianFactorGraph BatchFixedLagSmoother::linearize() {
+  if (!incremental_) {
+    nrLinearizedFactors_ += factors_.nrFactors();
+    return *factors_.linearize(theta_);
+  }
+  GaussianFactorGraph linearFactorGraph;
+  linearFactorGraph.reserve(factors_.size());
+  for (size_t slot = 0; slot < factors_.size(); ++slot) {
+    if (factors_[slot])
+      linearFactorGraph.push_back(linearizeSlot(slot));
+  }
+  return linearFactorGraph;
+}
+
+/* ************************************************************************* */
+GaussianFactor::shared_ptr BatchFixedLagSmoother::linearizeSlot(size_t slot) {
+  if (!incremental_) {
+    ++nrLinearizedFactors_;
+    return factors_[slot]->linearize(theta_);
+  }
+  if (!linearFactors_[slot]) {
+    ++nrLinearizedFactors_;
+    linearFactors_[slot] = factors_[slot]->linearize(theta_);
+  }
+  return linearFactors_[slot];
+}
+
+/* ************************************************************************* */
+void BatchFixedLagSmoother::relinearize(Key key, const Value& value) {
+  theta_.update(key, value);
+  const auto slots = factorIndex_.find(key);
+  if (slots != factorIndex_.end()) {
+    for (size_t slot : slots->second)
+      linearFactors_[slot].reset();
+  }
+}
+
 /* ************************************************************************* */
 FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
 
@@ -210,6 +259,7 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
 
   // Use a custom optimization loop so the linearization points can be controlled
   double previousError;
+  bool converged = false;
   VectorValues newDelta;
   do {
     previousError = result.error;
@@ -218,7 +268,12 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
     gttic(optimizer_iteration);
     {
       // Linearize graph around the linearization point
-      GaussianFactorGraph linearFactorGraph = *factors_.linearize(theta_);
+      gttic(linearize);
+      GaussianFactorGraph linearFactorGraph = linearize();
+      gttoc(linearize);
+
+      // The structure of the damped graph is the same for every lambda
+      boost::optional<VariableIndex> variableIndex;
 
       // Keep increasing lambda until we make make progress
       while (true) {
@@ -245,8 +300,10 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
 
         gttic(solve);
         // Solve Damped Gaussian Factor Graph
-        newDelta = dampedFactorGraph.optimize(ordering_,
-            parameters_.getEliminationFunction());
+        if (!variableIndex)
+          variableIndex = VariableIndex(dampedFactorGraph);
+        newDelta = dampedFactorGraph.eliminateMultifrontal(ordering_,
+            parameters_.getEliminationFunction(), *variableIndex)->optimize();
         // update the evalpoint with the new delta
         evalpoint = theta_.retract(newDelta);
         gttoc(solve);
@@ -260,6 +317,33 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
           // Keep this change
           // Update the error value
           result.error = error;
+          if (incremental_) {
+            // Only move the linearization point of variables that changed enough, and keep the
+            // linearization point of variables involved in linearized factors
+            size_t nrRelinearized = 0;
+            for(const auto& key_delta: newDelta) {
+              const Key key = key_delta.first;
+              const Vector& keyDelta = key_delta.second;
+              if ((enforceConsistency_ && linearKeys_.exists(key))
+                  || keyDelta.lpNorm<Eigen::Infinity>() < relinearizeThreshold_) {
+                delta_.at(key) = keyDelta;
+              } else {
+                relinearize(key, evalpoint.at(key));
+                delta_.at(key).setZero();
+                ++nrRelinearized;
+              }
+            }
+            // If no variable moved enough, the next iteration would solve the same linear system
+            if (nrRelinearized == 0) {
+              converged = true;
+            }
+            // Decrease lambda for next time
+            lambda /= lambdaFactor;
+            if (lambda < lambdaLowerBound) {
+              lambda = lambdaLowerBound;
+            }
+            break;
+          }
           // Update the linearization point
           theta_ = evalpoint;
           // Reset the deltas to zeros
@@ -280,7 +364,13 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
           break;
         } else {
           // Reject this change
-          if (lambda >= lambdaUpperBound) {
+          if (incremental_ && result.iterations > 0
+              && error - result.error <= max(absoluteErrorTol, relativeErrorTol * result.error)) {
+            // The cached linearization is already solved to within the convergence tolerances, so
+            // increasing lambda would not make progress either
+            converged = true;
+            break;
+          } else if (lambda >= lambdaUpperBound) {
             // The maximum lambda has been used. Print a warning and end the search.
             cout
                 << "Warning:  Levenberg-Marquardt giving up because cannot decrease error with maximum lambda"
@@ -296,7 +386,7 @@ FixedLagSmoother::Result BatchFixedLagSmoother::optimize() {
     gttoc(optimizer_iteration);
 
     result.iterations++;
-  } while (result.iterations < maxIterations
+  } while (!converged && result.iterations < maxIterations
       && !checkConvergence(relativeErrorTol, absoluteErrorTol, errorTol,
           previousError, result.error, NonlinearOptimizerParams::SILENT));
 
@@ -313,10 +403,18 @@ void BatchFixedLagSmoother::marginalize(const KeyVector& marginalizeKeys) {
 
   // Identify all of the factors involving any marginalized variable. These must be removed.
   set<size_t> removedFactorSlots;
-  const VariableIndex variableIndex(factors_);
-  for(Key key: marginalizeKeys) {
-    const auto& slots = variableIndex[key];
-    removedFactorSlots.insert(slots.begin(), slots.end());
+  if (incremental_) {
+    // The factor index is up to date, so there is no need to index the whole graph
+    for(Key key: marginalizeKeys) {
+      const auto& slots = factorIndex_.at(key);
+      removedFactorSlots.insert(slots.begin(), slots.end());
+    }
+  } else {
+    const VariableIndex variableIndex(factors_);
+    for(Key key: marginalizeKeys) {
+      const auto& slots = variableIndex[key];
+      removedFactorSlots.insert(slots.begin(), slots.end());
+    }
   }
 
   // Add the removed factors to a factor graph
@@ -328,8 +426,23 @@ void BatchFixedLagSmoother::marginalize(const KeyVector& marginalizeKeys) {
   }
 
   // Calculate marginal factors on the remaining keys
-  NonlinearFactorGraph marginalFactors = CalculateMarginalFactors(
-      removedFactors, theta_, marginalizeKeys, parameters_.getEliminationFunction());
+  NonlinearFactorGraph marginalFactors;
+  if (incremental_) {
+    // Eliminate the cached linearizations of the removed factors, which are all at theta_
+    GaussianFactorGraph removedLinearFactors;
+    for(size_t slot: removedFactorSlots) {
+      if (factors_.at(slot)) {
+        removedLinearFactors.push_back(linearizeSlot(slot));
+      }
+    }
+    marginalFactors = LinearContainerFactor::ConvertLinearGraph(
+        CalculateMarginalFactors(removedLinearFactors, marginalizeKeys,
+            parameters_.getEliminationFunction()), theta_);
+  } else {
+    nrLinearizedFactors_ += removedFactors.size();
+    marginalFactors = CalculateMarginalFactors(
+        removedFactors, theta_, marginalizeKeys, parameters_.getEliminationFunction());
+  }
 
   // Remove marginalized factors from the factor graph
   removeFactors(removedFactorSlots);
@@ -33,9 +33,21 @@ public:
   /// Typedef for a shared pointer to an Incremental Fixed-Lag Smoother
   typedef boost::shared_ptr<BatchFixedLagSmoother> shared_ptr;
 
-  /** default constructor */
-  BatchFixedLagSmoother(double smootherLag = 0.0, const LevenbergMarquardtParams& parameters = LevenbergMarquardtParams(), bool enforceConsistency = true) :
-    FixedLagSmoother(smootherLag), parameters_(parameters), enforceConsistency_(enforceConsistency) { };
+  /**
+   * default constructor
+   * @param smootherLag the length of the smoothing window
+   * @param parameters the L-M optimization parameters
+   * @param enforceConsistency keep the linearization point of variables involved in linearized factors
+   * @param incremental if true, cache the linearized factors between updates, relinearize only
+   *        variables whose delta exceeds relinearizeThreshold, and marginalize using the cached
+   *        linearization of the removed factors
+   * @param relinearizeThreshold the largest absolute delta entry below which a variable keeps its
+   *        linearization point, in incremental mode
+   */
+  BatchFixedLagSmoother(double smootherLag = 0.0, const LevenbergMarquardtParams& parameters = LevenbergMarquardtParams(), bool enforceConsistency = true,
+      bool incremental = false, double relinearizeThreshold = 0.1) :
+    FixedLagSmoother(smootherLag), parameters_(parameters), enforceConsistency_(enforceConsistency),
+    incremental_(incremental), relinearizeThreshold_(relinearizeThreshold) { };
 
   /** destructor */
   ~BatchFixedLagSmoother() override { };
@@ -102,6 +114,16 @@ public:
     return delta_;
   }
 
+  /** Whether linearizations are cached between updates */
+  bool incremental() const {
+    return incremental_;
+  }
+
+  /** The number of factors linearized so far, for profiling the incremental mode */
+  size_t nrLinearizedFactors() const {
+    return nrLinearizedFactors_;
+  }
+
   /// Calculate marginal covariance on given variable
   Matrix marginalCovariance(Key key) const;
 
@@ -130,6 +152,12 @@ protected:
    * smoothing window. This idea is from ??? TODO: Look up paper reference **/
   bool enforceConsistency_;
 
+  /** A flag indicating if linearized factors are re-used between updates **/
+  bool incremental_;
+
+  /** Variables whose delta is smaller than this keep their linearization point, in incremental mode **/
+  double relinearizeThreshold_;
+
   /** The nonlinear factors **/
   NonlinearFactorGraph factors_;
 
@@ -145,6 +173,13 @@ protected:
   /** The current set of linear deltas */
   VectorValues delta_;
 
+  /** The cached linearization of the factor in every slot, at theta_, or null if it needs to be
+   * (re-)linearized. Only used in incremental mode. **/
+  std::vector<GaussianFactor::shared_ptr> linearFactors_;
+
+  /** The number of factors linearized so far **/
+  size_t nrLinearizedFactors_ = 0;
+
   /** The set of available factor graph slots. These occur because we are constantly deleting factors, leaving holes. **/
   std::queue<size_t> availableSlots_;
 
@@ -163,6 +198,15 @@ protected:
   /** Use colamd to update into an efficient ordering */
   void reorder(const KeyVector& marginalizeKeys = KeyVector());
 
+  /** Linearize all factors at theta_, re-using the cached linearizations in incremental mode */
+  GaussianFactorGraph linearize();
+
+  /** Linearize the factor in a slot at theta_, or return its cached linearization */
+  GaussianFactor::shared_ptr linearizeSlot(size_t slot);
+
+  /** Move the linearization point of a variable, invalidating the cached linearizations */
+  void relinearize(Key key, const Value& value);
+
   /** Optimize the current graph using a modified version of L-M */
   Result optimize();
 
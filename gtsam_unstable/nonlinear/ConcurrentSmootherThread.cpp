@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ConcurrentSmootherThread.cpp
+ * @brief   Runs a ConcurrentIncrementalSmoother on a background thread, and
+ *          synchronizes it with a ConcurrentFilter without blocking the filter.
+ * @date    October, 2026
+ */
+
+#include <gtsam_unstable/nonlinear/ConcurrentSmootherThread.h>
+
+#include <algorithm>
+#include <iostream>
+
+namespace gtsam {
+
+/* ************************************************************************* */
+void ConcurrentSmootherThread::Metrics::print(const std::string& s) const {
+  std::cout << s << "Nr synchronizations: " << synchronizations << '\n'
+            << "Nr busy: " << busy << '\n'
+            << "Smoother update: " << lastSmootherUpdate << " s, max " << maxSmootherUpdate << " s\n"
+            << "Synchronize: " << lastSynchronize << " s, max " << maxSynchronize << " s\n"
+            << "Latency: " << lastLatency << " s, max " << maxLatency << " s" << std::endl;
+}
+
+/* ************************************************************************* */
+ConcurrentSmootherThread::ConcurrentSmootherThread(ConcurrentFilter& filter,
+    ConcurrentIncrementalSmoother& smoother) :
+    filter_(filter), smoother_(smoother), busy_(false) {
+  // The first exchange applies the current smoother summarization to the filter
+  smoother_.presync();
+  smoother_.getSummarizedFactors(smootherSummarization_, smootherSeparatorValues_);
+  thread_ = std::thread(&ConcurrentSmootherThread::run, this);
+}
+
+/* ************************************************************************* */
+ConcurrentSmootherThread::~ConcurrentSmootherThread() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wakeUp_.notify_one();
+  thread_.join();
+}
+
+/* ************************************************************************* */
+bool ConcurrentSmootherThread::synchronize() {
+  if (busy_) {
+    ++metrics_.busy;
+    return false;
+  }
+  rethrowSmootherException();
+
+  const Clock::time_point start = Clock::now();
+  if (metrics_.synchronizations > 0) {
+    metrics_.lastSmootherUpdate = smootherUpdateTime_;
+    metrics_.maxSmootherUpdate = std::max(metrics_.maxSmootherUpdate, smootherUpdateTime_);
+    metrics_.lastLatency = std::chrono::duration<double>(start - handedOver_).count();
+    metrics_.maxLatency = std::max(metrics_.maxLatency, metrics_.lastLatency);
+  }
+
+  // Apply the smoother summarization to the filter, and collect the factors for the smoother
+  smootherFactors_ = NonlinearFactorGraph();
+  smootherValues_.clear();
+  filterSummarization_ = NonlinearFactorGraph();
+  filterSeparatorValues_.clear();
+  filter_.presync();
+  filter_.synchronize(smootherSummarization_, smootherSeparatorValues_);
+  filter_.getSmootherFactors(smootherFactors_, smootherValues_);
+  filter_.getSummarizedFactors(filterSummarization_, filterSeparatorValues_);
+  filter_.postsync();
+
+  // Hand the buffers over to the smoother thread
+  handedOver_ = Clock::now();
+  metrics_.lastSynchronize = std::chrono::duration<double>(handedOver_ - start).count();
+  metrics_.maxSynchronize = std::max(metrics_.maxSynchronize, metrics_.lastSynchronize);
+  ++metrics_.synchronizations;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    busy_ = true;
+  }
+  wakeUp_.notify_one();
+  return true;
+}
+
+/* ************************************************************************* */
+void ConcurrentSmootherThread::wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  finished_.wait(lock, [this] { return !busy_; });
+  lock.unlock();
+  rethrowSmootherException();
+}
+
+/* ************************************************************************* */
+void ConcurrentSmootherThread::rethrowSmootherException() {
+  if (smootherException_) {
+    std::exception_ptr exception;
+    std::swap(exception, smootherException_);
+    std::rethrow_exception(exception);
+  }
+}
+
+/* ************************************************************************* */
+void ConcurrentSmootherThread::run() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wakeUp_.wait(lock, [this] { return stop_ || busy_; });
+      if (!busy_)
+        return;
+    }
+
+    // Same sequence as smoother.update() followed by gtsam::synchronize, starting after the
+    // smoother summarization was handed to the filter. Exceptions cannot leave the thread, keep
+    // them for the filter thread.
+    const Clock::time_point start = Clock::now();
+    try {
+      smoother_.synchronize(smootherFactors_, smootherValues_, filterSummarization_,
+          filterSeparatorValues_);
+      smoother_.postsync();
+      smootherResult_ = smoother_.update();
+      smoother_.presync();
+      smootherSummarization_ = NonlinearFactorGraph();
+      smootherSeparatorValues_.clear();
+      smoother_.getSummarizedFactors(smootherSummarization_, smootherSeparatorValues_);
+    } catch (...) {
+      smootherException_ = std::current_exception();
+    }
+    smootherUpdateTime_ = std::chrono::duration<double>(Clock::now() - start).count();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      busy_ = false;
+    }
+    finished_.notify_all();
+  }
+}
+
+/* ************************************************************************* */
+}/// namespace gtsam
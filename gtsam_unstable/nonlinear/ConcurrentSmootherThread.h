@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    ConcurrentSmootherThread.h
+ * @brief   Runs a ConcurrentIncrementalSmoother on a background thread, and
+ *          synchronizes it with a ConcurrentFilter without blocking the filter.
+ * @date    October, 2026
+ */
+
+// \callgraph
+#pragma once
+
+#include <gtsam_unstable/nonlinear/ConcurrentIncrementalSmoother.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace gtsam {
+
+/**
+ * Runs the smoother of the Concurrent Filtering and Smoothing architecture on
+ * its own thread. The filter stays on the calling thread: update it as usual,
+ * and call synchronize() instead of gtsam::synchronize, e.g., after every
+ * filter update.
+ *
+ * If the smoother has finished its last update, synchronize() applies the
+ * smoother summarization to the filter, hands the new smoother factors and the
+ * filter summarization to the smoother thread, which synchronizes and updates
+ * the smoother and computes its next summarization, and returns true.
+ * Otherwise it returns false immediately, so the filter never waits for the
+ * smoother. The two threads exchange the buffers of factors in turn, and the
+ * filter thread only checks an atomic flag while the smoother is busy.
+ *
+ * The sequence of calls made on the filter and the smoother is the same as
+ * calling smoother.update() and gtsam::synchronize(filter, smoother) at every
+ * successful synchronize().
+ *
+ * If the smoother update throws, e.g., an IndeterminantLinearSystemException,
+ * the exception is caught on the smoother thread and rethrown on the filter
+ * thread by the next call to synchronize() or wait(). The smoother is left as
+ * the exception left it.
+ *
+ * The smoother must not be accessed while it is updating: call wait() first.
+ * Note that the gttic/gttoc instrumentation of the Timing build type is not
+ * thread-safe.
+ */
+class GTSAM_UNSTABLE_EXPORT ConcurrentSmootherThread {
+public:
+
+  /** Latency metrics, in seconds, updated by synchronize() */
+  struct Metrics {
+    size_t synchronizations = 0; ///< The number of exchanges with the smoother
+    size_t busy = 0; ///< The number of calls to synchronize while the smoother was updating
+    double lastSmootherUpdate = 0.0; ///< The time the smoother thread spent on its last update
+    double maxSmootherUpdate = 0.0; ///< The longest time the smoother thread spent on an update
+    double lastSynchronize = 0.0; ///< The time the filter thread spent in the last exchange
+    double maxSynchronize = 0.0; ///< The longest time the filter thread spent in an exchange
+    double lastLatency = 0.0; ///< The time between handing factors to the smoother and applying its resulting summarization to the filter
+    double maxLatency = 0.0; ///< The longest such latency
+
+    void print(const std::string& s = "") const;
+  };
+
+  /** Start the smoother thread. The filter and smoother must outlive this object. */
+  ConcurrentSmootherThread(ConcurrentFilter& filter, ConcurrentIncrementalSmoother& smoother);
+
+  /** Finish the current smoother update, if any, and stop the smoother thread */
+  ~ConcurrentSmootherThread();
+
+  /**
+   * Synchronize the filter and the smoother, if the smoother is idle, and start the next smoother
+   * update. Call from the filter thread. Rethrows any exception thrown by the last smoother update,
+   * without synchronizing.
+   * @return true if synchronized, false if the smoother was still updating
+   */
+  bool synchronize();
+
+  /**
+   * Wait until the smoother has finished its current update, if any. Rethrows any exception thrown
+   * by the smoother update.
+   */
+  void wait();
+
+  /** Whether the smoother thread is updating the smoother */
+  bool busy() const {
+    return busy_;
+  }
+
+  /** The latency metrics. Call from the filter thread. */
+  const Metrics& metrics() const {
+    return metrics_;
+  }
+
+  /** The result of the last finished smoother update. Call from the filter thread, when not busy. */
+  const ConcurrentIncrementalSmoother::Result& smootherResult() const {
+    return smootherResult_;
+  }
+
+private:
+  typedef std::chrono::steady_clock Clock;
+
+  /** The loop of the smoother thread */
+  void run();
+
+  /** Rethrow, once, the exception thrown by the last smoother update, if any */
+  void rethrowSmootherException();
+
+  ConcurrentFilter& filter_;
+  ConcurrentIncrementalSmoother& smoother_;
+
+  /** Buffers owned by the smoother thread while busy_ is set, and by the filter thread otherwise */
+  NonlinearFactorGraph smootherFactors_, filterSummarization_, smootherSummarization_;
+  Values smootherValues_, filterSeparatorValues_, smootherSeparatorValues_;
+  ConcurrentIncrementalSmoother::Result smootherResult_;
+  double smootherUpdateTime_ = 0.0;
+  std::exception_ptr smootherException_;
+
+  Metrics metrics_;
+  Clock::time_point handedOver_;
+
+  std::atomic<bool> busy_;
+  bool stop_ = false;
+  std::mutex mutex_;
+  std::condition_variable wakeUp_, finished_;
+  std::thread thread_;
+};
+
+}/// namespace gtsam
@@ -27,6 +27,8 @@ void FixedLagSmoother::Result::print() const {
             << "Nr intermediateSteps: " << intermediateSteps << '\n'
             << "Nr nonlinear variables: " << nonlinearVariables << '\n'
             << "Nr linear variables: " << linearVariables << '\n'
+            << "Nr marginalized variables: " << marginalizedVariables << '\n'
+            << "Nr re-eliminated variables: " << reeliminatedVariables << '\n'
             << "error: " << error << std::endl;
 }
 
@@ -50,14 +50,19 @@ public:
     size_t intermediateSteps; ///< The number of intermediate steps performed within the optimization. For L-M, this is the number of lambdas tried.
     size_t nonlinearVariables; ///< The number of variables that can be relinearized
     size_t linearVariables; ///< The number of variables that must keep a constant linearization point
+    size_t marginalizedVariables; ///< The number of variables marginalized out in this update
+    size_t reeliminatedVariables; ///< The number of variables re-eliminated in this update, if the smoother is incremental
     double error; ///< The final factor graph error
-    Result() : iterations(0), intermediateSteps(0), nonlinearVariables(0), linearVariables(0), error(0) {};
+    Result() : iterations(0), intermediateSteps(0), nonlinearVariables(0), linearVariables(0),
+        marginalizedVariables(0), reeliminatedVariables(0), error(0) {};
 
     /// Getter methods
     size_t getIterations() const { return iterations; }
     size_t getIntermediateSteps() const { return intermediateSteps; }
     size_t getNonlinearVariables() const { return nonlinearVariables; }
     size_t getLinearVariables() const { return linearVariables; }
+    size_t getMarginalizedVariables() const { return marginalizedVariables; }
+    size_t getReeliminatedVariables() const { return reeliminatedVariables; }
     double getError() const { return error; }
     void print() const;
   };
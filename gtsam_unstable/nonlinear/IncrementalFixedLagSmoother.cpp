@@ -46,6 +46,39 @@ void recursiveMarkAffectedKeys(const Key& key,
   // If the key was not found in the separator/parents, then none of its children can have it either
 }
 
+/* ************************************************************************* */
+// Check if all of the frontal keys in the subtree rooted at clique are in keys
+static bool subtreeContained(const ISAM2Clique::shared_ptr& clique,
+    const KeySet& keys) {
+  for(Key frontal: clique->conditional()->frontals()) {
+    if (!keys.exists(frontal))
+      return false;
+  }
+  for(const ISAM2Clique::shared_ptr& child: clique->children) {
+    if (!subtreeContained(child, keys))
+      return false;
+  }
+  return true;
+}
+
+/* ************************************************************************* */
+// Check if all of the keys eliminated before key, in the subtree of its clique, are in keys, i.e.,
+// whether key can be marginalized together with keys by ISAM2::marginalizeLeaves
+static bool isLeaf(Key key, const ISAM2Clique::shared_ptr& clique,
+    const KeySet& keys) {
+  for(Key frontal: clique->conditional()->frontals()) {
+    if (frontal == key)
+      break;
+    if (!keys.exists(frontal))
+      return false;
+  }
+  for(const ISAM2Clique::shared_ptr& child: clique->children) {
+    if (!subtreeContained(child, keys))
+      return false;
+  }
+  return true;
+}
+
 /* ************************************************************************* */
 void IncrementalFixedLagSmoother::print(const std::string& s,
     const KeyFormatter& keyFormatter) const {
@@ -100,7 +133,11 @@ FixedLagSmoother::Result IncrementalFixedLagSmoother::update(
   }
 
   // Force iSAM2 to put the marginalizable variables at the beginning
-  createOrderingConstraints(marginalizableKeys, constrainedKeys);
+  if (chronologicalOrdering_) {
+    createChronologicalOrderingConstraints(constrainedKeys);
+  } else {
+    createOrderingConstraints(marginalizableKeys, constrainedKeys);
+  }
 
   if (debug) {
     std::cout << "Constrained Keys: ";
@@ -114,12 +151,28 @@ FixedLagSmoother::Result IncrementalFixedLagSmoother::update(
     std::cout << std::endl;
   }
 
+  // With chronological ordering, the marginalizable variables are normally leaves already, and
+  // marking is only needed if timestamps were changed without adding factors on the variables
+  bool leaves = false;
+  if (chronologicalOrdering_) {
+    const KeySet marginalizableSet(marginalizableKeys.begin(), marginalizableKeys.end());
+    leaves = true;
+    for(Key key: marginalizableKeys) {
+      if (!isLeaf(key, isam_[key], marginalizableSet)) {
+        leaves = false;
+        break;
+      }
+    }
+  }
+
   // Mark additional keys between the marginalized keys and the leaves
   std::set<Key> additionalKeys;
-  for(Key key: marginalizableKeys) {
-    ISAM2Clique::shared_ptr clique = isam_[key];
-    for(const ISAM2Clique::shared_ptr& child: clique->children) {
-      recursiveMarkAffectedKeys(key, child, additionalKeys);
+  if (!leaves) {
+    for(Key key: marginalizableKeys) {
+      ISAM2Clique::shared_ptr clique = isam_[key];
+      for(const ISAM2Clique::shared_ptr& child: clique->children) {
+        recursiveMarkAffectedKeys(key, child, additionalKeys);
+      }
     }
   }
   KeyList additionalMarkedKeys(additionalKeys.begin(), additionalKeys.end());
@@ -154,6 +207,8 @@ FixedLagSmoother::Result IncrementalFixedLagSmoother::update(
   result.iterations = 1;
   result.linearVariables = 0;
   result.nonlinearVariables = 0;
+  result.marginalizedVariables = marginalizableKeys.size();
+  result.reeliminatedVariables = isamResult_.variablesReeliminated;
   result.error = 0;
 
   if (debug)
@@ -190,6 +245,22 @@ void IncrementalFixedLagSmoother::createOrderingConstraints(
   }
 }
 
+/* ************************************************************************* */
+void IncrementalFixedLagSmoother::createChronologicalOrderingConstraints(
+    boost::optional<FastMap<Key, int> >& constrainedKeys) const {
+  // Number the distinct timestamps in increasing order, so that the marginalizable variables,
+  // which are the oldest, are in the first groups
+  constrainedKeys = FastMap<Key, int>();
+  int group = 0;
+  boost::optional<double> previous;
+  for(const TimestampKeyMap::value_type& timestamp_key: timestampKeyMap_) {
+    if (previous && timestamp_key.first != *previous)
+      ++group;
+    previous = timestamp_key.first;
+    constrainedKeys->operator[](timestamp_key.second) = group;
+  }
+}
+
 /* ************************************************************************* */
 void IncrementalFixedLagSmoother::PrintKeySet(const std::set<Key>& keys,
     const std::string& label) {
@@ -37,10 +37,19 @@ public:
   /// Typedef for a shared pointer to an Incremental Fixed-Lag Smoother
   typedef boost::shared_ptr<IncrementalFixedLagSmoother> shared_ptr;
 
-  /** default constructor */
+  /**
+   * default constructor
+   * @param smootherLag the length of the smoothing window
+   * @param parameters the iSAM2 parameters
+   * @param chronologicalOrdering if true, variables re-eliminated by iSAM2 are ordered by their
+   *        timestamps, so that the oldest variables are always leaves of the Bayes tree and are
+   *        marginalized without re-eliminating any other variable
+   */
   IncrementalFixedLagSmoother(double smootherLag = 0.0,
-      const ISAM2Params& parameters = DefaultISAM2Params()) :
-      FixedLagSmoother(smootherLag), isam_(parameters) {
+      const ISAM2Params& parameters = DefaultISAM2Params(),
+      bool chronologicalOrdering = false) :
+      FixedLagSmoother(smootherLag), isam_(parameters),
+      chronologicalOrdering_(chronologicalOrdering) {
   }
 
   /** destructor */
@@ -132,6 +141,9 @@ protected:
   /** Store results of latest isam2 update */
   ISAM2Result isamResult_;
 
+  /** Whether to order variables by their timestamps */
+  bool chronologicalOrdering_;
+
   /** Erase any keys associated with timestamps before the provided time */
   void eraseKeysBefore(double timestamp);
 
@@ -139,6 +151,10 @@ protected:
   void createOrderingConstraints(const KeyVector& marginalizableKeys,
       boost::optional<FastMap<Key, int> >& constrainedKeys) const;
 
+  /** Fill in an iSAM2 ConstrainedKeys structure such that all keys are eliminated in the order of their timestamps */
+  void createChronologicalOrderingConstraints(
+      boost::optional<FastMap<Key, int> >& constrainedKeys) const;
+
 private:
   /** Private methods for printing debug information */
   static void PrintKeySet(const std::set<Key>& keys, const std::string& label =
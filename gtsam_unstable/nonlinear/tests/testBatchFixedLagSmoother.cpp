@@ -22,6 +22,7 @@
 #include <gtsam/inference/Key.h>
 #include <gtsam/inference/Ordering.h>
 #include <gtsam/geometry/Point2.h>
+#include <gtsam/geometry/Pose2.h>
 #include <gtsam/linear/GaussianBayesNet.h>
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
@@ -168,10 +169,12 @@ TEST( BatchFixedLagSmoother, Example )
     fullinit.insert(newValues);
 
     // Update the smoother
-    smoother.update(newFactors, newValues, newTimestamps);
+    const auto result = smoother.update(newFactors, newValues, newTimestamps);
 
     // Check
     CHECK(check_smoother(fullgraph, fullinit, smoother, key2));
+    // Once the window is full, one variable leaves it at every step
+    EXPECT_LONGS_EQUAL(i >= 8 ? 1 : 0, result.marginalizedVariables);
 
     ++i;
   }
@@ -237,6 +240,52 @@ TEST( BatchFixedLagSmoother, Example )
   }
 }
 
+/* ************************************************************************* */
+TEST( BatchFixedLagSmoother, Incremental )
+{
+  // On a nonlinear pose chain with loop closures, the incremental mode should agree with the
+  // batch mode when relinearizing every variable that moves, and reach the same error while
+  // linearizing fewer factors with a relinearization threshold
+  const auto model = noiseModel::Isotropic::Sigma(3, 0.1);
+  const Pose2 step(1.0, 0.0, 0.1);
+
+  typedef BatchFixedLagSmoother::KeyTimestampMap Timestamps;
+  BatchFixedLagSmoother batch(5.0, LevenbergMarquardtParams());
+  BatchFixedLagSmoother exact(5.0, LevenbergMarquardtParams(), true, true, 0.0);
+  BatchFixedLagSmoother incremental(5.0, LevenbergMarquardtParams(), true, true, 1e-3);
+  EXPECT(!batch.incremental());
+  EXPECT(incremental.incremental());
+
+  Pose2 pose;
+  for (size_t i = 0; i < 30; ++i) {
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    Timestamps newTimestamps;
+    if (i == 0) {
+      newFactors.addPrior(Key(0), Pose2(), model);
+    } else {
+      newFactors.emplace_shared<BetweenFactor<Pose2> >(Key(i - 1), Key(i), step, model);
+      pose = pose * step;
+    }
+    if (i >= 4 && i % 2 == 0) {
+      newFactors.emplace_shared<BetweenFactor<Pose2> >(
+          Key(i - 4), Key(i), Pose2(4.0, 0.0, 0.4).retract(Vector3(0.01, -0.02, 0.01)), model);
+    }
+    newValues.insert(Key(i), pose.retract(Vector3(0.1, -0.1, 0.05)));
+    newTimestamps[Key(i)] = double(i);
+
+    const auto expected = batch.update(newFactors, newValues, newTimestamps);
+    exact.update(newFactors, newValues, newTimestamps);
+    const auto actual = incremental.update(newFactors, newValues, newTimestamps);
+
+    EXPECT(assert_equal(batch.calculateEstimate(), exact.calculateEstimate(), 1e-6));
+    EXPECT_DOUBLES_EQUAL(expected.getError(), actual.getError(), 1e-9 + 1e-2 * expected.getError());
+  }
+  EXPECT_LONGS_EQUAL(batch.calculateEstimate().size(),
+                     incremental.calculateEstimate().size());
+  EXPECT(incremental.nrLinearizedFactors() < batch.nrLinearizedFactors());
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
 /* ************************************************************************* */
@@ -0,0 +1,198 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testConcurrentSmootherThread.cpp
+ * @brief   Unit tests for running the concurrent smoother on its own thread
+ * @date    October, 2026
+ */
+
+#include <gtsam_unstable/nonlinear/ConcurrentSmootherThread.h>
+#include <gtsam_unstable/nonlinear/ConcurrentIncrementalFilter.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/linear/linearExceptions.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <CppUnitLite/TestHarness.h>
+
+using namespace std;
+using namespace gtsam;
+
+namespace {
+
+const size_t lag = 8;
+const SharedDiagonal noisePrior = noiseModel::Diagonal::Sigmas(Vector3(0.3, 0.3, 0.1));
+const SharedDiagonal noiseOdometry = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+const SharedDiagonal noiseLoop = noiseModel::Diagonal::Sigmas(Vector3(0.5, 0.5, 0.25));
+
+/* ************************************************************************* */
+// The new factors and values of a Pose2 trajectory at step i, with a loop closure within the lag
+// every 5 steps, and the keys that leave the filter.
+void createStep(size_t i, NonlinearFactorGraph& newFactors, Values& newValues,
+    FastList<Key>& keysToMove) {
+  newFactors = NonlinearFactorGraph();
+  newValues.clear();
+  keysToMove.clear();
+  const Pose2 odometry(0.5, 0.0, 0.1);
+  if (i == 0) {
+    newFactors.addPrior<Pose2>(0, Pose2(), noisePrior);
+    newValues.insert(0, Pose2(0.01, -0.02, 0.01));
+    return;
+  }
+  newFactors.emplace_shared<BetweenFactor<Pose2> >(i - 1, i,
+      odometry * Pose2(0.01 * (i % 3), -0.02, 0.005), noiseOdometry);
+  if (i % 5 == 0)
+    newFactors.emplace_shared<BetweenFactor<Pose2> >(i - 5, i,
+        Pose2(2.2, 1.0, 0.5) * Pose2(0.0, 0.05, 0.0), noiseLoop);
+  Pose2 pose;
+  for (size_t j = 0; j < i; j++) pose = pose * odometry;
+  newValues.insert(i, pose * Pose2(0.1, 0.1, 0.05));
+  if (i >= lag)
+    keysToMove.push_back(i - lag);
+}
+
+const size_t n = 40;
+
+/* ************************************************************************* */
+// A prior that throws once armed, as a failing linear solve would in the smoother.
+class FailingPrior : public PriorFactor<Pose2> {
+  const std::atomic<bool>& armed_;
+
+public:
+  FailingPrior(Key key, const std::atomic<bool>& armed) :
+      PriorFactor<Pose2>(key, Pose2(), noisePrior), armed_(armed) {
+  }
+
+  Vector evaluateError(const Pose2& x, boost::optional<Matrix&> H = boost::none) const override {
+    if (armed_)
+      throw IndeterminantLinearSystemException(key());
+    return PriorFactor<Pose2>::evaluateError(x, H);
+  }
+};
+
+}
+
+/* ************************************************************************* */
+TEST(ConcurrentSmootherThread, SameAsSynchronize) {
+  // Step the filter and the smoother in the same thread, as in the examples
+  ConcurrentIncrementalFilter expectedFilter;
+  ConcurrentIncrementalSmoother expectedSmoother;
+  // The same, with the smoother on its own thread
+  ConcurrentIncrementalFilter actualFilter;
+  ConcurrentIncrementalSmoother actualSmoother;
+
+  NonlinearFactorGraph newFactors;
+  Values newValues;
+  FastList<Key> keysToMove;
+  {
+    ConcurrentSmootherThread smootherThread(actualFilter, actualSmoother);
+    for (size_t i = 0; i < n; i++) {
+      createStep(i, newFactors, newValues, keysToMove);
+      expectedFilter.update(newFactors, newValues, keysToMove);
+      actualFilter.update(newFactors, newValues, keysToMove);
+      if (i % 3 == 2) {
+        expectedSmoother.update();
+        synchronize(expectedFilter, expectedSmoother);
+        EXPECT(smootherThread.synchronize());
+        smootherThread.wait();
+        EXPECT(!smootherThread.busy());
+      }
+      CHECK(assert_equal(expectedFilter.calculateEstimate(), actualFilter.calculateEstimate(), 1e-9));
+    }
+    EXPECT_LONGS_EQUAL(n / 3, smootherThread.metrics().synchronizations);
+    EXPECT_LONGS_EQUAL(0, smootherThread.metrics().busy);
+    EXPECT(smootherThread.metrics().maxLatency >= smootherThread.metrics().lastLatency);
+    EXPECT(smootherThread.metrics().maxSmootherUpdate >= 0.0);
+  }
+  // The smoother thread has already updated with the factors of the last synchronization
+  expectedSmoother.update();
+  EXPECT(assert_equal(expectedSmoother.calculateEstimate(), actualSmoother.calculateEstimate(), 1e-9));
+  EXPECT(!actualSmoother.calculateEstimate().empty());
+}
+
+/* ************************************************************************* */
+TEST(ConcurrentSmootherThread, NonBlocking) {
+  // Synchronize after every filter update, without waiting for the smoother
+  ConcurrentIncrementalFilter filter;
+  ConcurrentIncrementalSmoother smoother;
+  NonlinearFactorGraph newFactors;
+  Values newValues;
+  FastList<Key> keysToMove;
+  size_t synchronizations = 0, busy = 0;
+  {
+    ConcurrentSmootherThread smootherThread(filter, smoother);
+    for (size_t i = 0; i < n; i++) {
+      createStep(i, newFactors, newValues, keysToMove);
+      filter.update(newFactors, newValues, keysToMove);
+      if (smootherThread.synchronize())
+        ++synchronizations;
+      else
+        ++busy;
+    }
+    smootherThread.wait();
+    EXPECT(smootherThread.synchronize());
+    ++synchronizations;
+    EXPECT_LONGS_EQUAL(synchronizations, smootherThread.metrics().synchronizations);
+    EXPECT_LONGS_EQUAL(busy, smootherThread.metrics().busy);
+    EXPECT(smootherThread.metrics().maxSynchronize >= smootherThread.metrics().lastSynchronize);
+  }
+
+  // All variables are in the filter or in the smoother
+  const Values filterValues = filter.calculateEstimate(), smootherValues = smoother.calculateEstimate();
+  for (size_t i = 0; i < n; i++)
+    EXPECT(filterValues.exists(i) || smootherValues.exists(i));
+  EXPECT(filterValues.exists(n - 1));
+}
+
+/* ************************************************************************* */
+TEST(ConcurrentSmootherThread, Exception) {
+  // Once armed, the smoother update throws on the smoother thread. The first call to wait() or
+  // synchronize() that finds the smoother idle rethrows it, once, on this thread.
+  for (bool useWait : {true, false}) {
+    ConcurrentIncrementalFilter filter;
+    ConcurrentIncrementalSmoother smoother;
+    const Key failing = 1000;
+    std::atomic<bool> armed(false);
+    NonlinearFactorGraph failingFactors;
+    failingFactors.emplace_shared<FailingPrior>(failing, armed);
+    Values failingValues;
+    failingValues.insert(failing, Pose2());
+    smoother.update(failingFactors, failingValues);
+
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    FastList<Key> keysToMove;
+    ConcurrentSmootherThread smootherThread(filter, smoother);
+    for (size_t i = 0; i <= lag; i++) {
+      createStep(i, newFactors, newValues, keysToMove);
+      filter.update(newFactors, newValues, keysToMove);
+      armed = (i == lag);
+      EXPECT(smootherThread.synchronize());
+      if (i < lag)
+        smootherThread.wait();
+    }
+
+    if (useWait) {
+      CHECK_EXCEPTION(smootherThread.wait(), IndeterminantLinearSystemException);
+      smootherThread.wait();
+    } else {
+      while (smootherThread.busy())
+        std::this_thread::yield();
+      CHECK_EXCEPTION(smootherThread.synchronize(), IndeterminantLinearSystemException);
+      EXPECT_LONGS_EQUAL(lag + 1, smootherThread.metrics().synchronizations);
+    }
+  }
+}
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
+/* ************************************************************************* */
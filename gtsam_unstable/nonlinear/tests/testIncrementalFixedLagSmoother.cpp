@@ -233,6 +233,54 @@ TEST( IncrementalFixedLagSmoother, Example )
   }
 }
 
+/* ************************************************************************* */
+TEST( IncrementalFixedLagSmoother, ChronologicalOrdering )
+{
+  // Poses with landmarks, each seen from 5 consecutive poses. With chronological ordering, the
+  // expired variables are leaves of the Bayes tree, so fewer variables are re-eliminated than with
+  // the default ordering, for the same solution
+  SharedDiagonal odometerNoise = noiseModel::Diagonal::Sigmas(Vector2(0.1, 0.1));
+  SharedDiagonal landmarkNoise = noiseModel::Diagonal::Sigmas(Vector2(0.2, 0.2));
+
+  typedef IncrementalFixedLagSmoother::KeyTimestampMap Timestamps;
+  IncrementalFixedLagSmoother smoother(20.0, ISAM2Params());
+  IncrementalFixedLagSmoother chronological(20.0, ISAM2Params(), true);
+
+  Values fullinit;
+  NonlinearFactorGraph fullgraph;
+  size_t marginalized = 0, reeliminated = 0, chronologicalReeliminated = 0;
+  for (size_t i = 0; i < 60; ++i) {
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    Timestamps newTimestamps;
+    if (i == 0) {
+      newFactors.addPrior(MakeKey(i), Point2(0.0, 0.0), odometerNoise);
+    } else {
+      newFactors.push_back(BetweenFactor<Point2>(MakeKey(i - 1), MakeKey(i), Point2(1.0, 0.0), odometerNoise));
+    }
+    newValues.insert(MakeKey(i), Point2(double(i) + 0.1, -0.1));
+    newTimestamps[MakeKey(i)] = double(i);
+    for (size_t j = (i < 4 ? 0 : i - 4); j <= i; ++j) {
+      newFactors.push_back(BetweenFactor<Point2>(MakeKey(i), Symbol('l', j), Point2(double(j) - double(i), 1.0), landmarkNoise));
+      newTimestamps[Symbol('l', j)] = double(i);
+    }
+    newValues.insert(Symbol('l', i), Point2(double(i), 1.1));
+
+    fullgraph.push_back(newFactors);
+    fullinit.insert(newValues);
+
+    const auto result = smoother.update(newFactors, newValues, newTimestamps);
+    const auto chronologicalResult = chronological.update(newFactors, newValues, newTimestamps);
+    marginalized += chronologicalResult.getMarginalizedVariables();
+    reeliminated += result.getReeliminatedVariables();
+    chronologicalReeliminated += chronologicalResult.getReeliminatedVariables();
+
+    CHECK(check_smoother(fullgraph, fullinit, chronological, MakeKey(i)));
+  }
+  EXPECT_LONGS_EQUAL(fullinit.size() - chronological.calculateEstimate().size(), marginalized);
+  EXPECT(chronologicalReeliminated < reeliminated);
+}
+
 /* ************************************************************************* */
 int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
 /* ************************************************************************* */
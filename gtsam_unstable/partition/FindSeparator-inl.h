@@ -40,7 +40,7 @@ namespace gtsam { namespace partition {
    * whether node j is in the left part of the graph, the right part, or the
    * separator, respectively
    */
-  std::pair<int, sharedInts> separatorMetis(idx_t n, const sharedInts& xadj,
+  inline std::pair<int, sharedInts> separatorMetis(idx_t n, const sharedInts& xadj,
     const sharedInts& adjncy, const sharedInts& adjwgt, bool verbose) {
 
     // control parameters
@@ -79,7 +79,7 @@ namespace gtsam { namespace partition {
   }
 
   /* ************************************************************************* */
-  void modefied_EdgeComputeSeparator(idx_t *nvtxs, idx_t *xadj, idx_t *adjncy, idx_t *vwgt,
+  inline void modefied_EdgeComputeSeparator(idx_t *nvtxs, idx_t *xadj, idx_t *adjncy, idx_t *vwgt,
       idx_t *adjwgt, idx_t *options, idx_t *edgecut, idx_t *part)
   {
     idx_t i, ncon;
@@ -127,7 +127,7 @@ namespace gtsam { namespace partition {
    * Part [j] is 0 or 1, depending on
    * whether node j is in the left part of the graph or the right part respectively
    */
-  std::pair<int, sharedInts> edgeMetis(idx_t n, const sharedInts& xadj,  const sharedInts& adjncy,
+  inline std::pair<int, sharedInts> edgeMetis(idx_t n, const sharedInts& xadj,  const sharedInts& adjncy,
     const sharedInts& adjwgt, bool verbose) {
 
     // control parameters
@@ -192,14 +192,11 @@ namespace gtsam { namespace partition {
     int numEdges = 0;
     std::vector<NeighborsInfo> adjacencyMap;
     adjacencyMap.resize(numNodes);
-    std::cout << "Number of nodes: " << adjacencyMap.size() << std::endl;
     int index1, index2;
 
     for(const typename GenericGraph::value_type& factor: graph){
       index1 = dictionary[factor->key1.index];
       index2 = dictionary[factor->key2.index];
-      std::cout << "index1: " << index1 << std::endl;
-      std::cout << "index2: " << index2 << std::endl;
       // if both nodes are in the current graph, i.e. not a joint factor between frontal and separator
       if (index1 >= 0 && index2 >= 0) {
         std::pair<Neighbors, Weights>& adjacencyMap1 = adjacencyMap[index1];
@@ -366,25 +363,25 @@ namespace gtsam { namespace partition {
   }
 
   /* ************************************************************************* */
-  bool isLargerIsland(const std::vector<size_t>& island1, const std::vector<size_t>& island2) {
+  inline bool isLargerIsland(const std::vector<size_t>& island1, const std::vector<size_t>& island2) {
     return island1.size() > island2.size();
   }
 
   /* ************************************************************************* */
   // debug functions
-  void printIsland(const std::vector<size_t>& island) {
+  inline void printIsland(const std::vector<size_t>& island) {
     std::cout << "island: ";
     for(const size_t key: island)
       std::cout << key << " ";
     std::cout << std::endl;
   }
 
-  void printIslands(const std::list<std::vector<size_t> >& islands) {
+  inline void printIslands(const std::list<std::vector<size_t> >& islands) {
     for(const std::vector<std::size_t>& island: islands)
         printIsland(island);
   }
 
-  void printNumCamerasLandmarks(const std::vector<size_t>& keys, const std::vector<Symbol>& int2symbol) {
+  inline void printNumCamerasLandmarks(const std::vector<size_t>& keys, const std::vector<Symbol>& int2symbol) {
     int numCamera = 0, numLandmark = 0;
     for(const size_t key: keys)
     if (int2symbol[key].chr() == 'x')
@@ -0,0 +1,297 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    NestedDissectionSolver.cpp
+ * @brief   Solve factor graphs by parallel elimination of a nested dissection tree
+ * @date    October, 2026
+ */
+
+#include <gtsam_unstable/partition/NestedDissectionSolver.h>
+#include <gtsam_unstable/partition/FindSeparator-inl.h>
+#include <gtsam_unstable/partition/GenericGraph.h>
+#include <gtsam/base/DSFVector.h>
+#include <gtsam/config.h>  // for GTSAM_USE_TBB
+#include <gtsam/linear/GaussianBayesTree.h>
+
+#ifdef GTSAM_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifndef GTSAM_USE_SYSTEM_METIS
+
+using namespace std;
+
+namespace gtsam { namespace partition {
+
+  namespace {
+
+  /* ************************************************************************* */
+  // Call f(k) for k in [0, n), in parallel if TBB is available.
+  template <class FUNCTION>
+  void parallelFor(size_t n, const FUNCTION& f) {
+#ifdef GTSAM_USE_TBB
+    if (n > 1) {
+      tbb::parallel_for(size_t(0), n, f);
+      return;
+    }
+#endif
+    for (size_t k = 0; k < n; ++k) f(k);
+  }
+
+  /* ************************************************************************* */
+  // Recursively partitions the variable graph, whose nodes are the indices of the variables
+  class Partitioner {
+    typedef NestedDissectionSolver::Cluster Cluster;
+
+    const size_t maxLeafSize_;
+    std::vector<Cluster>& clusters_;
+    WorkSpace workspace_;
+    std::vector<int> label_;  // scratch: the component of a node, or -1
+
+  public:
+    std::vector<size_t> clusterOf;  // the cluster in which each node is eliminated
+
+    Partitioner(size_t numNodes, size_t maxLeafSize, std::vector<Cluster>& clusters) :
+      maxLeafSize_(maxLeafSize), clusters_(clusters), workspace_(numNodes),
+      label_(numNodes, -1), clusterOf(numNodes) {}
+
+    // Split the nodes into the connected components of the graph, with the edges of each
+    void components(const std::vector<size_t>& nodes, const GenericGraph2D& edges,
+        std::vector<std::vector<size_t> >& nodesOut, std::vector<GenericGraph2D>& edgesOut) {
+      DSFVector dsf(workspace_.dsf, nodes);
+      for (const sharedGenericFactor2D& edge : edges)
+        dsf.merge(edge->key1.index, edge->key2.index);
+      for (const auto& root_nodes : dsf.arrays()) {
+        for (size_t node : root_nodes.second) label_[node] = nodesOut.size();
+        nodesOut.push_back(root_nodes.second);
+      }
+      edgesOut.resize(nodesOut.size());
+      for (const sharedGenericFactor2D& edge : edges)
+        edgesOut[label_[edge->key1.index]].push_back(edge);
+      for (size_t node : nodes) label_[node] = -1;
+    }
+
+    // Create the cluster of the given nodes and, recursively, its children, and return its index
+    size_t build(const std::vector<size_t>& nodes, const GenericGraph2D& edges, bool connected) {
+      const size_t index = clusters_.size();
+      clusters_.push_back(Cluster());
+      std::vector<size_t> separator;
+      std::vector<std::vector<size_t> > childNodes;
+      std::vector<GenericGraph2D> childEdges;
+
+      if (nodes.size() > maxLeafSize_) {
+        if (!connected)
+          components(nodes, edges, childNodes, childEdges);
+        if (childNodes.size() < 2) {
+          childNodes.clear();
+          childEdges.clear();
+          boost::optional<MetisResult> result = separatorPartitionByMetis(edges, nodes,
+              workspace_, false);
+          if (result && !result->A.empty() && !result->B.empty()) {
+            // The parts of A and B that are not connected are independent subproblems
+            separator = result->C;
+            for (size_t node : separator) label_[node] = 0;
+            std::vector<size_t> others;
+            GenericGraph2D otherEdges;
+            others.reserve(nodes.size() - separator.size());
+            for (size_t node : nodes)
+              if (label_[node] != 0) others.push_back(node);
+            for (const sharedGenericFactor2D& edge : edges)
+              if (label_[edge->key1.index] != 0 && label_[edge->key2.index] != 0)
+                otherEdges.push_back(edge);
+            for (size_t node : separator) label_[node] = -1;
+            components(others, otherEdges, childNodes, childEdges);
+          }
+        }
+      }
+
+      // Nodes that could not be partitioned make a leaf
+      if (childNodes.empty())
+        separator = nodes;
+      for (size_t node : separator) clusterOf[node] = index;
+      clusters_[index].frontals.assign(separator.begin(), separator.end());
+      for (size_t i = 0; i < childNodes.size(); ++i) {
+        const size_t child = build(childNodes[i], childEdges[i], true);
+        clusters_[index].children.push_back(child);
+      }
+      return index;
+    }
+  };
+
+  /* ************************************************************************* */
+  // The result of eliminating a cluster: the conditionals on its frontal variables, and the
+  // factor on its separator, to be eliminated by its parent
+  struct Eliminated {
+    GaussianBayesTree::shared_ptr bayesTree;
+    GaussianFactorGraph::shared_ptr remaining;
+  };
+
+  /* ************************************************************************* */
+  void eliminate(const std::vector<NestedDissectionSolver::Cluster>& clusters, size_t index,
+      const GaussianFactorGraph& gfg, const GaussianFactorGraph::Eliminate& function,
+      std::vector<Eliminated>& results) {
+    const NestedDissectionSolver::Cluster& cluster = clusters[index];
+    parallelFor(cluster.children.size(), [&](size_t k) {
+      eliminate(clusters, cluster.children[k], gfg, function, results);
+    });
+
+    GaussianFactorGraph graph;
+    graph.reserve(cluster.factors.size());
+    for (size_t i : cluster.factors) graph.push_back(gfg[i]);
+    for (size_t child : cluster.children) {
+      graph.push_back(*results[child].remaining);
+      results[child].remaining.reset();
+    }
+
+    Eliminated& result = results[index];
+    if (cluster.frontals.empty())
+      result.remaining = boost::make_shared<GaussianFactorGraph>(graph);
+    else
+      boost::tie(result.bayesTree, result.remaining) =
+          graph.eliminatePartialMultifrontal(cluster.frontals, function);
+  }
+
+  /* ************************************************************************* */
+  // Solve for the frontal variables of a clique and its descendants, given the solution for its
+  // separator. The entries of the solution already exist, so concurrent updates are safe.
+  void backSubstitute(const GaussianBayesTree::sharedClique& clique, VectorValues& solution) {
+    for (const auto& key_value : clique->conditional()->solve(solution))
+      solution.at(key_value.first) = key_value.second;
+    for (const auto& child : clique->children)
+      backSubstitute(child, solution);
+  }
+
+  /* ************************************************************************* */
+  void backSubstitute(const std::vector<NestedDissectionSolver::Cluster>& clusters, size_t index,
+      const std::vector<Eliminated>& results, VectorValues& solution) {
+    if (results[index].bayesTree)
+      for (const auto& root : results[index].bayesTree->roots())
+        backSubstitute(root, solution);
+    const NestedDissectionSolver::Cluster& cluster = clusters[index];
+    parallelFor(cluster.children.size(), [&](size_t k) {
+      backSubstitute(clusters, cluster.children[k], results, solution);
+    });
+  }
+
+  } // namespace
+
+  /* ************************************************************************* */
+  void NestedDissectionSolver::partition(const std::vector<KeyVector>& factorKeys,
+      size_t maxLeafSize) {
+    if (maxLeafSize == 0)
+      throw std::invalid_argument("NestedDissectionSolver: maxLeafSize must be positive");
+    nrFactors_ = factorKeys.size();
+
+    // Number the variables, and connect the variables of each factor
+    KeySet keySet;
+    for (const KeyVector& keys : factorKeys) keySet.insert(keys.begin(), keys.end());
+    const KeyVector keys(keySet.begin(), keySet.end());
+    auto nodeOf = [&keys](Key key) {
+      return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+    };
+    std::vector<std::pair<size_t, size_t> > pairs;
+    for (const KeyVector& factor : factorKeys)
+      for (size_t i = 0; i < factor.size(); ++i)
+        for (size_t j = i + 1; j < factor.size(); ++j) {
+          const size_t node1 = nodeOf(factor[i]), node2 = nodeOf(factor[j]);
+          pairs.emplace_back(std::min(node1, node2), std::max(node1, node2));
+        }
+    std::sort(pairs.begin(), pairs.end());
+    GenericGraph2D edges;
+    for (size_t i = 0; i < pairs.size(); ) {
+      size_t j = i + 1;
+      while (j < pairs.size() && pairs[j] == pairs[i]) ++j;
+      if (pairs[i].first != pairs[i].second)
+        edges.push_back(boost::make_shared<GenericFactor2D>(pairs[i].first, NODE_POSE_2D,
+            pairs[i].second, NODE_POSE_2D, -1, j - i));
+      i = j;
+    }
+
+    std::vector<size_t> nodes(keys.size());
+    for (size_t node = 0; node < nodes.size(); ++node) nodes[node] = node;
+    clusters_.clear();
+    Partitioner partitioner(keys.size(), maxLeafSize, clusters_);
+    if (!keys.empty())
+      partitioner.build(nodes, edges, false);
+
+    // Convert the nodes back to keys, and eliminate each factor in the deepest cluster of its
+    // variables, which is a descendant of the clusters of all its other variables
+    std::vector<size_t> depth(clusters_.size(), 0);
+    for (size_t index = 0; index < clusters_.size(); ++index) {
+      Cluster& cluster = clusters_[index];
+      for (Key& key : cluster.frontals) key = keys[key];
+      for (size_t child : cluster.children) depth[child] = depth[index] + 1;
+    }
+    for (size_t i = 0; i < factorKeys.size(); ++i) {
+      if (factorKeys[i].empty())
+        continue;
+      size_t deepest = partitioner.clusterOf[nodeOf(factorKeys[i].front())];
+      for (Key key : factorKeys[i]) {
+        const size_t index = partitioner.clusterOf[nodeOf(key)];
+        if (depth[index] > depth[deepest]) deepest = index;
+      }
+      clusters_[deepest].factors.push_back(i);
+    }
+  }
+
+  /* ************************************************************************* */
+  size_t NestedDissectionSolver::nrLeaves() const {
+    size_t nrLeaves = 0;
+    for (const Cluster& cluster : clusters_)
+      if (cluster.children.empty()) ++nrLeaves;
+    return nrLeaves;
+  }
+
+  /* ************************************************************************* */
+  VectorValues NestedDissectionSolver::solve(const GaussianFactorGraph& gfg,
+      const GaussianFactorGraph::Eliminate& function) const {
+    if (gfg.size() != nrFactors_)
+      throw std::invalid_argument(
+          "NestedDissectionSolver::solve: the graph does not have the partitioned factors");
+    if (clusters_.empty())
+      return VectorValues();
+
+    std::vector<Eliminated> results(clusters_.size());
+    eliminate(clusters_, 0, gfg, function, results);
+
+    const VectorValues::Dims dims = gfg.getKeyDimMap();
+    size_t dim = 0;
+    for (const auto& key_dim : dims) dim += key_dim.second;
+    VectorValues solution(Vector::Zero(dim), dims);
+    backSubstitute(clusters_, 0, results, solution);
+    return solution;
+  }
+
+  /* ************************************************************************* */
+  Values NestedDissectionSolver::optimize(const NonlinearFactorGraph& graph,
+      const Values& initial, const GaussNewtonParams& params) const {
+    Values values = initial;
+    double error = graph.error(values);
+    for (size_t iteration = 0; iteration < params.maxIterations; ++iteration) {
+      Values newValues = values.retract(solve(*graph.linearize(values)));
+      const double newError = graph.error(newValues);
+      const bool converged = checkConvergence(params.relativeErrorTol, params.absoluteErrorTol,
+          params.errorTol, error, newError, params.verbosity);
+      values.swap(newValues);
+      error = newError;
+      if (converged)
+        break;
+    }
+    return values;
+  }
+
+}} // namespace
+
+#endif
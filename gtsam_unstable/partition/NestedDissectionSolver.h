@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    NestedDissectionSolver.h
+ * @brief   Solve factor graphs by parallel elimination of a nested dissection tree
+ * @date    October, 2026
+ */
+
+#pragma once
+
+#include <gtsam_unstable/dllexport.h>
+#include <gtsam/config.h>  // for GTSAM_USE_SYSTEM_METIS
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/nonlinear/GaussNewtonOptimizer.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+
+#include <vector>
+
+// Like FindSeparator, only available with the Metis bundled with GTSAM
+#ifndef GTSAM_USE_SYSTEM_METIS
+
+namespace gtsam { namespace partition {
+
+  /**
+   * A solver that recursively partitions the variables of a factor graph with the Metis vertex
+   * separators of separatorPartitionByMetis, until the parts have at most maxLeafSize variables.
+   * The leaves of the resulting tree are eliminated concurrently, each into a partial Bayes tree
+   * and a factor on its separator, and the separators are eliminated in the same way up to the
+   * root. The solution is back-substituted down the tree, again concurrently.
+   *
+   * The subproblems are independent, so this is a coarse-grain parallel alternative to the
+   * multifrontal solver for large, e.g., planar SLAM, graphs, whose peak memory is bounded by the
+   * leaves and the separators. The partition only depends on the structure of the graph, and is
+   * computed once, at construction, for all later linearizations of the graph.
+   *
+   * Concurrency requires TBB; otherwise the tree is eliminated sequentially. Like FindSeparator,
+   * the solver is only available with the Metis bundled with GTSAM.
+   */
+  class GTSAM_UNSTABLE_EXPORT NestedDissectionSolver {
+  public:
+
+    /** A node of the nested dissection tree */
+    struct Cluster {
+      KeyVector frontals;              ///< a separator, or all variables of a leaf, eliminated here
+      std::vector<size_t> factors;     ///< the indices of the factors eliminated here
+      std::vector<size_t> children;    ///< the indices of the child clusters
+    };
+
+    /**
+     * Partition the variables of the graph.
+     * @param graph the factor graph, only its structure is used
+     * @param maxLeafSize the maximum number of variables in a leaf
+     */
+    template<class FACTOR>
+    explicit NestedDissectionSolver(const FactorGraph<FACTOR>& graph, size_t maxLeafSize = 500) {
+      std::vector<KeyVector> factorKeys;
+      factorKeys.reserve(graph.size());
+      for (const auto& factor : graph)
+        factorKeys.push_back(factor ? factor->keys() : KeyVector());
+      partition(factorKeys, maxLeafSize);
+    }
+
+    /** The clusters of the tree; the root is the first one */
+    const std::vector<Cluster>& clusters() const { return clusters_; }
+
+    /** The number of leaves of the tree */
+    size_t nrLeaves() const;
+
+    /**
+     * Solve a linear graph with the same factors as the partitioned graph, by eliminating the tree.
+     * @param gfg the linear factor graph, whose factor i involves the same variables as factor i of
+     *        the partitioned graph
+     * @param function the dense elimination function
+     */
+    VectorValues solve(const GaussianFactorGraph& gfg,
+        const GaussianFactorGraph::Eliminate& function = EliminatePreferCholesky) const;
+
+    /**
+     * Optimize a nonlinear graph with the same factors as the partitioned graph, with Gauss-Newton
+     * steps computed by solve().
+     */
+    Values optimize(const NonlinearFactorGraph& graph, const Values& initial,
+        const GaussNewtonParams& params = GaussNewtonParams()) const;
+
+  private:
+    std::vector<Cluster> clusters_;
+    size_t nrFactors_ = 0;
+
+    /** Partition the variables involved in the factors, and assign the factors to clusters */
+    void partition(const std::vector<KeyVector>& factorKeys, size_t maxLeafSize);
+  };
+
+}} // namespace
+
+#endif
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    testNestedDissectionSolver.cpp
+ * @brief   Unit tests for NestedDissectionSolver
+ * @date    October, 2026
+ */
+
+#include <CppUnitLite/TestHarness.h>
+
+#include <gtsam_unstable/partition/NestedDissectionSolver.h>
+#include <gtsam/base/TestableAssertions.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+using namespace std;
+using namespace gtsam;
+using namespace gtsam::partition;
+
+#ifndef GTSAM_USE_SYSTEM_METIS
+
+/* ************************************************************************* */
+// A noisy planar grid of rows x cols poses, with keys from offset, and a prior on the first
+static void createGrid(size_t rows, size_t cols, NonlinearFactorGraph& graph, Values& values,
+    Key offset = 0) {
+  const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  auto key = [cols, offset](size_t i, size_t j) { return offset + i * cols + j; };
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < cols; j++) {
+      const Pose2 pose(j, i, 0.0);
+      values.insert(key(i, j), pose.retract(Vector3(0.1 * sin(i + 2 * j), 0.1 * cos(3 * i + j),
+          0.05 * sin(i * j))));
+      if (j > 0)
+        graph.emplace_shared<BetweenFactor<Pose2> >(key(i, j - 1), key(i, j),
+            Pose2(1.0, 0.01 * ((i + j) % 3), 0.0), model);
+      if (i > 0)
+        graph.emplace_shared<BetweenFactor<Pose2> >(key(i - 1, j), key(i, j),
+            Pose2(0.0, 1.0, 0.01 * ((i * j) % 5)), model);
+    }
+  graph.addPrior<Pose2>(offset, Pose2(), model);
+}
+
+/* ************************************************************************* */
+TEST(NestedDissectionSolver, singleLeaf) {
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(3, 4, graph, values);
+  const NestedDissectionSolver solver(graph);
+  LONGS_EQUAL(1, solver.clusters().size());
+  LONGS_EQUAL(12, solver.clusters()[0].frontals.size());
+  LONGS_EQUAL(graph.size(), solver.clusters()[0].factors.size());
+
+  const GaussianFactorGraph::shared_ptr gfg = graph.linearize(values);
+  EXPECT(assert_equal(gfg->optimize(), solver.solve(*gfg), 1e-9));
+}
+
+/* ************************************************************************* */
+TEST(NestedDissectionSolver, grid) {
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(30, 30, graph, values);
+  const NestedDissectionSolver solver(graph, 50);
+  EXPECT(solver.nrLeaves() > 8);
+
+  // All variables and factors are in exactly one cluster, and leaves are small
+  KeySet frontals;
+  size_t nrFactors = 0;
+  for (const NestedDissectionSolver::Cluster& cluster : solver.clusters()) {
+    for (Key key : cluster.frontals)
+      EXPECT(frontals.insert(key).second);
+    nrFactors += cluster.factors.size();
+    if (cluster.children.empty())
+      EXPECT(cluster.frontals.size() <= 50);
+  }
+  LONGS_EQUAL(900, frontals.size());
+  LONGS_EQUAL(graph.size(), nrFactors);
+
+  // Same linear solution as multifrontal elimination
+  const GaussianFactorGraph::shared_ptr gfg = graph.linearize(values);
+  EXPECT(assert_equal(gfg->optimize(), solver.solve(*gfg), 1e-7));
+  EXPECT(assert_equal(gfg->optimize(), solver.solve(*gfg, EliminateQR), 1e-7));
+
+  // Same Gauss-Newton iterations as GaussNewtonOptimizer
+  GaussNewtonParams params;
+  params.maxIterations = 5;
+  const Values expected = GaussNewtonOptimizer(graph, values, params).optimize();
+  EXPECT(assert_equal(expected, solver.optimize(graph, values, params), 1e-6));
+
+  // The graph must have the partitioned factors
+  NonlinearFactorGraph other = graph;
+  other.resize(graph.size() - 1);
+  CHECK_EXCEPTION(solver.solve(*other.linearize(values)), std::invalid_argument);
+}
+
+/* ************************************************************************* */
+TEST(NestedDissectionSolver, components) {
+  // Two disconnected grids are solved independently
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(10, 10, graph, values);
+  createGrid(10, 10, graph, values, 1000);
+
+  const NestedDissectionSolver solver(graph, 40);
+  EXPECT(solver.clusters()[0].frontals.empty());
+  LONGS_EQUAL(2, solver.clusters()[0].children.size());
+  const GaussianFactorGraph::shared_ptr gfg = graph.linearize(values);
+  EXPECT(assert_equal(gfg->optimize(), solver.solve(*gfg), 1e-7));
+}
+
+#endif
+
+/* ************************************************************************* */
+int main() { TestResult tr; return TestRegistry::runAllTests(tr);}
+/* ************************************************************************* */
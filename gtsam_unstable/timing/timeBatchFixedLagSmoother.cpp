@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeBatchFixedLagSmoother.cpp
+ * @brief   time BatchFixedLagSmoother updates on a 10 second, 100 Hz window
+ * @date    October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam_unstable/nonlinear/BatchFixedLagSmoother.h>
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// Run a smoother on a noisy helix, with odometry at 100 Hz and a loop closure
+// to a pose one second back every 10 poses, and return the final estimate.
+Values run(BatchFixedLagSmoother& smoother, size_t n) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> noise(0.0, 0.01);
+  auto randomTwist = [&]() {
+    Vector6 xi;
+    for (int i = 0; i < 6; i++) xi(i) = noise(rng);
+    return xi;
+  };
+
+  const double dt = 0.01;
+  const auto model = noiseModel::Isotropic::Sigma(6, 0.01);
+  const Pose3 step(Rot3::Ypr(0.01, 0.001, 0), Point3(0.1, 0, 0.005));
+  vector<Pose3> poses{Pose3()};
+  for (size_t i = 1; i < n; i++) poses.push_back(poses.back() * step);
+
+  for (size_t i = 0; i < n; i++) {
+    NonlinearFactorGraph newFactors;
+    Values newValues;
+    BatchFixedLagSmoother::KeyTimestampMap newTimestamps;
+    if (i == 0) {
+      newFactors.addPrior(0, poses[0], model);
+    } else {
+      newFactors.emplace_shared<BetweenFactor<Pose3> >(
+          i - 1, i, step.retract(randomTwist()), model);
+    }
+    if (i >= 100 && i % 10 == 0)
+      newFactors.emplace_shared<BetweenFactor<Pose3> >(
+          i - 100, i, poses[i - 100].between(poses[i]).retract(randomTwist()),
+          model);
+    newValues.insert(i, poses[i].retract(randomTwist()));
+    newTimestamps[i] = i * dt;
+    smoother.update(newFactors, newValues, newTimestamps);
+  }
+  return smoother.calculateEstimate();
+}
+
+/* ************************************************************************* */
+int main(int argc, char* argv[]) {
+  const double lag = 10.0;
+  const size_t n = 1500;
+  cout << "NOTE:  Times are reported for " << n << " updates with a " << lag
+       << " second lag at 100 Hz" << endl;
+
+  LevenbergMarquardtParams params;
+  Values batch, incremental;
+  {
+    gttic_(batch);
+    BatchFixedLagSmoother smoother(lag, params);
+    batch = run(smoother, n);
+  }
+  {
+    gttic_(incremental);
+    BatchFixedLagSmoother smoother(lag, params, true, true);
+    incremental = run(smoother, n);
+  }
+
+  // Compare the estimates of the last pose
+  const Key last = n - 1;
+  cout << "Difference in the last pose: "
+       << batch.at<Pose3>(last)
+              .localCoordinates(incremental.at<Pose3>(last))
+              .norm()
+       << endl;
+
+  // Print timings
+  tictoc_print_();
+
+  return 0;
+}
@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeNestedDissectionSolver.cpp
+ * @brief   time the nested dissection solver against multifrontal elimination
+ * @date    October, 2026
+ *
+ * Usage: timeNestedDissectionSolver [side of the grid] [maximum leaf size]
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <gtsam_unstable/partition/NestedDissectionSolver.h>
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+using namespace gtsam::partition;
+
+/* ************************************************************************* */
+// A noisy planar grid of n x n poses, with a prior on the first
+void createGrid(size_t n, NonlinearFactorGraph* graph, Values* values) {
+  const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.1, 0.05));
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < n; j++) {
+      values->insert(i * n + j, Pose2(j, i, 0.0).retract(Vector3(
+                                    0.1 * sin(i + 2 * j), 0.1 * cos(3 * i + j),
+                                    0.05 * sin(i * j))));
+      if (j > 0)
+        graph->emplace_shared<BetweenFactor<Pose2> >(
+            i * n + j - 1, i * n + j, Pose2(1.0, 0.0, 0.0), model);
+      if (i > 0)
+        graph->emplace_shared<BetweenFactor<Pose2> >(
+            (i - 1) * n + j, i * n + j, Pose2(0.0, 1.0, 0.0), model);
+    }
+  graph->addPrior<Pose2>(0, Pose2(), model);
+}
+
+/* ************************************************************************* */
+int main(int argc, char* argv[]) {
+  const size_t n = argc > 1 ? atoi(argv[1]) : 200;
+  const size_t maxLeafSize = argc > 2 ? atoi(argv[2]) : 500;
+  const int r = 3;
+
+  NonlinearFactorGraph graph;
+  Values values;
+  createGrid(n, &graph, &values);
+  const GaussianFactorGraph::shared_ptr gfg = graph.linearize(values);
+  cout << "NOTE:  Times are reported for " << r << " solves of a " << n << "x"
+       << n << " grid, with leaves of at most " << maxLeafSize << " poses"
+       << endl;
+
+  gttic_(partition);
+  const NestedDissectionSolver solver(graph, maxLeafSize);
+  gttoc_(partition);
+  cout << solver.clusters().size() << " clusters, " << solver.nrLeaves()
+       << " leaves" << endl;
+
+  VectorValues expected, actual;
+  gttic_(multifrontal_colamd);
+  for (int i = 0; i < r; i++) expected = gfg->optimize();
+  gttoc_(multifrontal_colamd);
+
+  const Ordering metis = Ordering::Metis(*gfg);
+  gttic_(multifrontal_metis);
+  for (int i = 0; i < r; i++) gfg->optimize(metis);
+  gttoc_(multifrontal_metis);
+
+  gttic_(nested_dissection);
+  for (int i = 0; i < r; i++) actual = solver.solve(*gfg);
+  gttoc_(nested_dissection);
+
+  cout << "Difference in the solution: " << (expected - actual).norm() << endl;
+
+  // Print timings
+  tictoc_print_();
+
+  return 0;
+}
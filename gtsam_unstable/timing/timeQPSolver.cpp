@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeQPSolver.cpp
+ * @brief   time the active set QP solver on the Maros-Meszaros problems used
+ *          in the tests, and on a sequence of model predictive control QPs
+ * @date    October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam_unstable/linear/QPSParser.h>
+#include <gtsam_unstable/linear/QPSolver.h>
+
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::D;
+using symbol_shorthand::U;
+using symbol_shorthand::X;
+
+/* ************************************************************************* */
+// Regulate a double integrator from x0 to the origin over a horizon of n
+// steps, with |u| <= 1. The dual keys of the constraints are D(i).
+QP createMPC(const Vector2& x0, size_t n) {
+  const double dt = 0.1;
+  Matrix2 A;
+  A << 1, dt, 0, 1;
+  const Matrix21 B(0.5 * dt * dt, dt);
+  QP qp;
+  size_t dual = 0;
+  qp.equalities.add(X(0), I_2x2, x0, D(dual++));
+  for (size_t k = 0; k < n; k++) {
+    qp.cost.emplace_shared<JacobianFactor>(X(k + 1), I_2x2, Vector2::Zero());
+    qp.cost.emplace_shared<JacobianFactor>(U(k), 0.3 * I_1x1, Vector1::Zero());
+    qp.equalities.add(X(k + 1), I_2x2, X(k), -A, U(k), -B, Vector2::Zero(),
+                      D(dual++));
+    qp.inequalities.add(U(k), I_1x1, 1.0, D(dual++));
+    qp.inequalities.add(U(k), -I_1x1, 1.0, D(dual++));
+  }
+  return qp;
+}
+
+/* ************************************************************************* */
+int main(int argc, char* argv[]) {
+  const int r = 200;
+  const vector<string> files{"HS21.QPS",   "HS35.QPS",    "HS35MOD.QPS",
+                             "HS51.QPS",   "HS52.QPS",    "HS268.QPS",
+                             "QPTEST.QPS", "QPExample.QPS"};
+  cout << "NOTE:  Times are reported for " << r
+       << " solves of each Maros-Meszaros problem" << endl;
+  for (const string& file : files) {
+    const QP qp = QPSParser(file).Parse();
+    gttic_(maros_meszaros);
+    for (int i = 0; i < r; i++) QPSolver(qp).optimize();
+  }
+
+  // Model predictive control, solving every problem from scratch, or from the
+  // solution of the previous problem, which is feasible for the inequalities
+  const size_t n = 20, steps = 100;
+  cout << "NOTE:  and for " << steps << " MPC problems with a horizon of " << n
+       << endl;
+  Vector2 x0(5.0, 0.0);
+  VectorValues values, duals;
+  double difference = 0.0;
+  for (size_t step = 0; step < steps; step++) {
+    const QP qp = createMPC(x0, n);
+    VectorValues cold;
+    {
+      gttic_(mpc_cold);
+      cold = QPSolver(qp).optimize().first;
+    }
+    {
+      gttic_(mpc_warm);
+      if (step == 0)
+        boost::tie(values, duals) = QPSolver(qp).optimize();
+      else
+        boost::tie(values, duals) = QPSolver(qp).optimize(values, duals, true);
+    }
+    difference = max(difference, (cold - values).norm());
+    x0 = values.at(X(1));
+  }
+  cout << "Largest difference between cold and warm starts: " << difference
+       << endl;
+
+  // Print timings
+  tictoc_print_();
+
+  return 0;
+}
@@ -143,6 +143,12 @@ namespace simulated2D {
       return (prior(x, H) - measured_);
     }
 
+    /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+    bool linearizeInPlace(const gtsam::Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+      return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+    }
+
     ~GenericPrior() override {}
 
     /// @return a deep copy of this factor
@@ -189,6 +195,12 @@ namespace simulated2D {
       return (odo(x1, x2, H1, H2) - measured_);
     }
 
+    /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+    bool linearizeInPlace(const gtsam::Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+      return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+    }
+
     ~GenericOdometry() override {}
 
     /// @return a deep copy of this factor
@@ -236,6 +248,12 @@ namespace simulated2D {
       return (mea(x1, x2, H1, H2) - measured_);
     }
 
+    /// Linearize in place, see NoiseModelFactor::linearizeInPlace
+    bool linearizeInPlace(const gtsam::Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+      return this->template linearizeInPlaceAs<This>(x, jacobian, H);
+    }
+
     ~GenericMeasurement() override {}
 
     /// @return a deep copy of this factor
@@ -482,6 +482,81 @@ TEST(NonlinearFactor, NoiseModelFactor6) {
 
 }
 
+/* ************************************************************************* */
+// A factor on a Point2 and a Vector, with three rows
+class TestFactorMixed : public NoiseModelFactor2<Point2, Vector> {
+public:
+  typedef NoiseModelFactor2<Point2, Vector> Base;
+  TestFactorMixed(const SharedNoiseModel& model) : Base(model, X(1), X(2)) {}
+
+  Vector evaluateError(const Point2& p, const Vector& v,
+                       boost::optional<Matrix&> H1 = boost::none,
+                       boost::optional<Matrix&> H2 = boost::none) const override {
+    if (H1) *H1 = (Matrix(3, 2) << 1, 2, 3, 4, 5, 6).finished();
+    if (H2) *H2 = (Matrix(3, 3) << 7, 8, 9, 1, 3, 5, 2, 4, 6).finished();
+    return Vector3(p.x() + v(0), p.y() * v(1), v(2) - 10);
+  }
+
+  bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                        std::vector<Matrix>& H) const override {
+    return linearizeInPlaceAs<TestFactorMixed>(x, jacobian, H);
+  }
+};
+
+// The same, whitened by the noise model as in NoiseModelFactor
+class TestFactorMixedGeneral : public TestFactorMixed {
+public:
+  using TestFactorMixed::TestFactorMixed;
+
+protected:
+  void fillJacobianFactor(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+    NoiseModelFactor::fillJacobianFactor(x, jacobian, H);
+  }
+};
+
+/* ************************************ */
+TEST(NonlinearFactor, fillFixedSizeJacobianFactor) {
+  Values values;
+  values.insert(X(1), Point2(1, 2));
+  values.insert(X(2), Vector(Vector3(3, 4, 5)));
+
+  const Matrix3 R = (Matrix3() << 2, 1, 3, 0, 4, 1, 0, 0, 5).finished();
+  const auto diagonal = noiseModel::Diagonal::Sigmas(Vector3(0.1, 0.2, 0.3));
+  using noiseModel::mEstimator::Huber;
+  const std::vector<SharedNoiseModel> models{
+      SharedNoiseModel(), noiseModel::Unit::Create(3),
+      noiseModel::Isotropic::Sigma(3, 0.5), diagonal,
+      noiseModel::Gaussian::SqrtInformation(R),
+      noiseModel::Robust::Create(Huber::Create(1.0), diagonal),
+      noiseModel::Robust::Create(Huber::Create(1.0, Huber::Scalar), diagonal),
+      noiseModel::Robust::Create(Huber::Create(1.0),
+                                 noiseModel::Gaussian::SqrtInformation(R)),
+      noiseModel::Constrained::MixedSigmas(Vector3(0, 0.1, 0.2))};
+
+  for (const SharedNoiseModel& model : models) {
+    const TestFactorMixed factor(model);
+    const TestFactorMixedGeneral general(model);
+    const auto expected =
+        boost::dynamic_pointer_cast<JacobianFactor>(general.linearize(values));
+    const auto actual =
+        boost::dynamic_pointer_cast<JacobianFactor>(factor.linearize(values));
+    CHECK(expected && actual);
+    EXPECT(assert_equal(*expected, *actual, 1e-9));
+
+    // In place, into a factor of a different shape first
+    JacobianFactor inPlace(X(3), I_1x1, Vector1(1));
+    std::vector<Matrix> H;
+    EXPECT(factor.linearizeInPlace(values, inPlace, H));
+    EXPECT(assert_equal(*expected, inPlace, 1e-9));
+    EXPECT(factor.linearizeInPlace(values, inPlace, H));
+    EXPECT(assert_equal(*expected, inPlace, 1e-9));
+
+    // A derived class does not inherit the opt-in
+    EXPECT(!general.linearizeInPlace(values, inPlace, H));
+  }
+}
+
 /* ************************************************************************* */
 TEST( NonlinearFactor, clone_rekey )
 {
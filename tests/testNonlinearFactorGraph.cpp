@@ -25,6 +25,8 @@
 #include <gtsam/inference/Symbol.h>
 #include <gtsam/symbolic/SymbolicFactorGraph.h>
 #include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/NonlinearEquality.h>
+#include <gtsam/slam/expressions.h>
 #include <gtsam/geometry/Pose2.h>
 #include <gtsam/geometry/Pose3.h>
 #include <gtsam/sam/RangeFactor.h>
@@ -135,6 +137,66 @@ TEST( NonlinearFactorGraph, linearize )
   CHECK(assert_equal(expected,linearFG)); // Needs correct linearizations
 }
 
+/* ************************************************************************* */
+TEST(NonlinearFactorGraph, linearizeInPlace) {
+  NonlinearFactorGraph fg = createNonlinearFactorGraph();
+  GaussianFactorGraph linear;
+  fg.linearizeInPlace(createNoisyValues(), linear);
+  EXPECT(assert_equal(createGaussianFactorGraph(), linear));
+
+  // Linearizing again overwrites the factors
+  vector<const GaussianFactor*> previous;
+  for (const auto& factor : linear) previous.push_back(factor.get());
+  const GaussianFactor::shared_ptr kept = linear[1];
+  const Values values = createValues();
+  fg.linearizeInPlace(values, linear);
+  EXPECT(assert_equal(*fg.linearize(values), linear));
+  EXPECT(linear[0].get() == previous[0]);
+  EXPECT(linear[2].get() == previous[2]);
+
+  // ...except those that are still in use elsewhere
+  EXPECT(linear[1].get() != previous[1]);
+  EXPECT(assert_equal(*createGaussianFactorGraph()[1], *kept));
+
+  // Factors with other dimensions are re-allocated
+  NonlinearFactorGraph poses;
+  Values x;
+  const Pose3 odometry(Rot3::RzRyRx(0.1, 0.2, 0.3), Point3(1, 2, 3));
+  poses.addPrior(0, Pose3(), noiseModel::Isotropic::Sigma(6, 0.1));
+  poses.emplace_shared<BetweenFactor<Pose3> >(
+      0, 1, odometry, noiseModel::Diagonal::Sigmas(Vector6::Constant(0.2)));
+  x.insert(0, Pose3());
+  x.insert(1, Pose3(Rot3::Ypr(0.1, 0, 0), Point3(1, 2, 2)));
+  poses.linearizeInPlace(x, linear);
+  EXPECT(assert_equal(*poses.linearize(x), linear));
+}
+
+/* ************************************************************************* */
+TEST(NonlinearFactorGraph, linearizeInPlaceOptIn) {
+  // NonlinearEquality linearizes with fillJacobianFactor, so in place, but an
+  // ExpressionFactor overrides linearize, and gets a new factor every time
+  NonlinearFactorGraph graph;
+  graph.emplace_shared<NonlinearEquality<Point2> >(X(1), Point2(1, 2), 10.0);
+  graph.addExpressionFactor(noiseModel::Isotropic::Sigma(2, 0.1),
+                            Point2(3, 4), Point2_(X(2)));
+  Values x;
+  x.insert(X(1), Point2(1, 2));
+  x.insert(X(2), Point2(3, 4));
+
+  GaussianFactorGraph linear;
+  graph.linearizeInPlace(x, linear);
+  EXPECT(assert_equal(*graph.linearize(x), linear));
+  const GaussianFactor* previous0 = linear[0].get();
+  const GaussianFactor* previous1 = linear[1].get();
+
+  x.update(X(1), Point2(2, 3));
+  x.update(X(2), Point2(4, 5));
+  graph.linearizeInPlace(x, linear);
+  EXPECT(assert_equal(*graph.linearize(x), linear));
+  EXPECT(linear[0].get() == previous0);
+  EXPECT(linear[1].get() != previous1);
+}
+
 /* ************************************************************************* */
 TEST( NonlinearFactorGraph, clone )
 {
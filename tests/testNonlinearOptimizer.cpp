@@ -165,6 +165,38 @@ TEST( NonlinearOptimizer, SimpleDLOptimizer )
   DOUBLES_EQUAL(0,fg.error(actual),tol);
 }
 
+/* ************************************************************************* */
+TEST(NonlinearOptimizer, ReuseLinearFactors) {
+  // A Pose2 chain, whose factors all linearize in place
+  NonlinearFactorGraph fg;
+  Values c0;
+  const auto model = noiseModel::Diagonal::Sigmas(Vector3(0.2, 0.2, 0.1));
+  fg.addPrior(X(0), Pose2(), model);
+  c0.insert(X(0), Pose2(0.1, -0.1, 0.05));
+  for (size_t i = 1; i < 5; i++) {
+    fg.emplace_shared<BetweenFactor<Pose2> >(X(i - 1), X(i),
+                                             Pose2(1, 0, M_PI_4), model);
+    c0.insert(X(i), Pose2(i + 0.2, 0.3, i * 0.5));
+  }
+
+  GaussNewtonParams gnParams;
+  LevenbergMarquardtParams lmParams;
+  DoglegParams dlParams;
+  const Values gn = GaussNewtonOptimizer(fg, c0, gnParams).optimize();
+  const Values lm = LevenbergMarquardtOptimizer(fg, c0, lmParams).optimize();
+  const Values dl = DoglegOptimizer(fg, c0, dlParams).optimize();
+
+  // Same results when linearizing into the factors of the previous iteration
+  gnParams.reuseLinearFactors = true;
+  lmParams.reuseLinearFactors = true;
+  dlParams.reuseLinearFactors = true;
+  CHECK(!gnParams.equals(GaussNewtonParams()));
+  EXPECT(assert_equal(gn, GaussNewtonOptimizer(fg, c0, gnParams).optimize()));
+  EXPECT(assert_equal(
+      lm, LevenbergMarquardtOptimizer(fg, c0, lmParams).optimize()));
+  EXPECT(assert_equal(dl, DoglegOptimizer(fg, c0, dlParams).optimize()));
+}
+
 /* ************************************************************************* */
 TEST( NonlinearOptimizer, optimization_method )
 {
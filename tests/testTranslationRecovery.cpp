@@ -236,6 +236,112 @@ TEST(TranslationRecovery, FourPosesIncludingZeroTranslation) {
   EXPECT(assert_equal(Point3(2, -2, 0), result.at<Point3>(3)));
 }
 
+TEST(TranslationRecovery, InitializeLinear) {
+  // Same poses as in FourPosesIncludingZeroTranslation, without the duplicate.
+  Values poses;
+  poses.insert<Pose3>(0, Pose3(Rot3(), Point3(0, 0, 0)));
+  poses.insert<Pose3>(1, Pose3(Rot3(), Point3(2, 0, 0)));
+  poses.insert<Pose3>(3, Pose3(Rot3(), Point3(1, -1, 0)));
+
+  auto relativeTranslations = TranslationRecovery::SimulateMeasurements(
+      poses, {{0, 1}, {1, 3}, {3, 0}});
+
+  // The linear initialization is already the solution for perfect data.
+  TranslationRecovery algorithm(relativeTranslations);
+  const auto initial = algorithm.initializeLinear(/*scale=*/4.0);
+  EXPECT_LONGS_EQUAL(3, initial.size());
+  EXPECT(assert_equal(Point3(0, 0, 0), initial.at<Point3>(0), 1e-6));
+  EXPECT(assert_equal(Point3(4, 0, 0), initial.at<Point3>(1), 1e-6));
+  EXPECT(assert_equal(Point3(2, -2, 0), initial.at<Point3>(3), 1e-6));
+}
+
+TEST(TranslationRecovery, FilterOutliers) {
+  // Eight cameras on the corners of a box, with all pairs measured.
+  Values poses;
+  vector<TranslationRecovery::KeyPair> edges;
+  for (size_t j = 0; j < 8; j++) {
+    poses.insert<Pose3>(
+        j, Pose3(Rot3(), Point3(j & 1 ? 3 : 0, j & 2 ? 2 : 0, j & 4 ? 1 : 0)));
+    for (size_t i = 0; i < j; i++) edges.emplace_back(i, j);
+  }
+  auto relativeTranslations =
+      TranslationRecovery::SimulateMeasurements(poses, edges);
+
+  // Without outliers, nothing is removed.
+  EXPECT_LONGS_EQUAL(
+      relativeTranslations.size(),
+      TranslationRecovery::FilterOutliers(relativeTranslations).size());
+
+  // Reverse two of the measurements.
+  const set<size_t> outliers{3, 17};
+  for (size_t e : outliers) {
+    const auto& edge = relativeTranslations[e];
+    relativeTranslations[e] = BinaryMeasurement<Unit3>(
+        edge.key1(), edge.key2(), Unit3(-edge.measured().point3()),
+        edge.noiseModel());
+  }
+
+  // Exactly the outliers are rejected, and the inliers keep their order.
+  const auto inliers =
+      TranslationRecovery::FilterOutliers(relativeTranslations);
+  set<size_t> rejected;
+  for (size_t e = 0, i = 0; e < relativeTranslations.size(); e++) {
+    if (i < inliers.size() &&
+        inliers[i].key1() == relativeTranslations[e].key1() &&
+        inliers[i].key2() == relativeTranslations[e].key2())
+      i++;
+    else
+      rejected.insert(e);
+  }
+  EXPECT(outliers == rejected);
+
+  // The first edge, from 0 to 1, has length 3, so the recovered translations
+  // are exact with that scale.
+  const auto result =
+      TranslationRecovery(relativeTranslations).run(3.0, /*filterOutliers=*/true);
+  for (size_t j = 0; j < 8; j++)
+    EXPECT(assert_equal(poses.at<Pose3>(j).translation(),
+                        result.at<Point3>(j), 1e-4));
+}
+
+/* ************************************************************************* */
+TEST(TranslationRecovery, FilterOutliersDuplicates) {
+  // The box of the previous test, with every measurement repeated, and the
+  // repetition of one measurement reversed.
+  Values poses;
+  vector<TranslationRecovery::KeyPair> edges;
+  for (size_t j = 0; j < 8; j++) {
+    poses.insert<Pose3>(
+        j, Pose3(Rot3(), Point3(j & 1 ? 3 : 0, j & 2 ? 2 : 0, j & 4 ? 1 : 0)));
+    for (size_t i = 0; i < j; i++) edges.emplace_back(i, j);
+  }
+  auto relativeTranslations =
+      TranslationRecovery::SimulateMeasurements(poses, edges);
+  const size_t nrEdges = relativeTranslations.size();
+  for (size_t e = 0; e < nrEdges; e++)
+    relativeTranslations.push_back(relativeTranslations[e]);
+  const size_t outlier = nrEdges + 9;
+  const auto& edge = relativeTranslations[outlier];
+  relativeTranslations[outlier] = BinaryMeasurement<Unit3>(
+      edge.key1(), edge.key2(), Unit3(-edge.measured().point3()),
+      edge.noiseModel());
+
+  // Only the reversed measurement is rejected, not the original one.
+  const auto inliers =
+      TranslationRecovery::FilterOutliers(relativeTranslations);
+  set<size_t> rejected;
+  for (size_t e = 0, i = 0; e < relativeTranslations.size(); e++) {
+    if (i < inliers.size() &&
+        inliers[i].key1() == relativeTranslations[e].key1() &&
+        inliers[i].key2() == relativeTranslations[e].key2() &&
+        inliers[i].measured().equals(relativeTranslations[e].measured()))
+      i++;
+    else
+      rejected.insert(e);
+  }
+  EXPECT(set<size_t>{outlier} == rejected);
+}
+
 TEST(TranslationRecovery, ThreePosesWithZeroTranslation) {
   Values poses;
   poses.insert<Pose3>(0, Pose3(Rot3::RzRyRx(-M_PI / 6, 0, 0), Point3(0, 0, 0)));
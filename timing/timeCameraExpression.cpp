@@ -37,6 +37,14 @@ Point2 myProject(const Pose3& pose, const Point3& point,
   return camera.project(point, H1, H2, boost::none);
 }
 
+// Copy of an ExpressionFactor that linearizes with a compiled tape
+NonlinearFactor::shared_ptr compiled(const NonlinearFactor::shared_ptr& f) {
+  auto factor = boost::make_shared<ExpressionFactor<Point2> >(
+      *boost::static_pointer_cast<ExpressionFactor<Point2> >(f));
+  factor->compile();
+  return factor;
+}
+
 int main() {
 
   // Create leaves
@@ -70,6 +78,7 @@ int main() {
       boost::make_shared<ExpressionFactor<Point2> >(model, z,
           uncalibrate(K, project(transformTo(x, p))));
   time("Bin(Leaf,Un(Bin(Leaf,Leaf))): ", f2, values);
+  time("Compiled                    : ", compiled(f2), values);
 
   // ExpressionFactor ternary
   // Oct 3, 2014, Macbook Air
@@ -78,6 +87,7 @@ int main() {
       boost::make_shared<ExpressionFactor<Point2> >(model, z,
           project3(x, p, K));
   time("Ternary(Leaf,Leaf,Leaf)     : ", f3, values);
+  time("Compiled                    : ", compiled(f3), values);
 
   // CALIBRATED
 
@@ -95,6 +105,7 @@ int main() {
       boost::make_shared<ExpressionFactor<Point2> >(model, z,
           uncalibrate(Cal3_S2_(*fixedK), project(transformTo(x, p))));
   time("Bin(Cnst,Un(Bin(Leaf,Leaf))): ", g2, values);
+  time("Compiled                    : ", compiled(g2), values);
 
   // ExpressionFactor, optimized
   // Oct 3, 2014, Macbook Air
@@ -105,5 +116,6 @@ int main() {
       boost::make_shared<ExpressionFactor<Point2> >(model, z,
           Point2_(myProject, x, p));
   time("Binary(Leaf,Leaf)           : ", g3, values);
+  time("Compiled                    : ", compiled(g3), values);
   return 0;
 }
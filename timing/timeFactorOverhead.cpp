@@ -21,8 +21,17 @@
 #include <gtsam/linear/GaussianFactorGraph.h>
 #include <gtsam/linear/NoiseModel.h>
 #include <gtsam/linear/VectorValues.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/PriorFactor.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/slam/BetweenFactor.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <random>
+#include <string>
 #include <vector>
 
 using namespace gtsam;
@@ -31,6 +40,52 @@ using namespace std;
 static std::mt19937 rng;
 static std::uniform_real_distribution<> uniform(0.0, 1.0);
 
+// Count the calls to malloc, which Eigen and operator new both end up in
+static std::atomic<size_t> nrMallocs(0);
+#ifdef __GLIBC__
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* malloc(size_t size) {
+  ++nrMallocs;
+  return __libc_malloc(size);
+}
+#endif
+
+// A factor that whitens with NoiseModel::WhitenSystem, instead of the
+// fixed-size path of NoiseModelFactorN
+template <class FACTOR>
+class GeneralWhitening : public FACTOR {
+ public:
+  using FACTOR::FACTOR;
+
+  bool linearizeInPlace(const Values& x, JacobianFactor& jacobian,
+                        vector<Matrix>& H) const override {
+    return this->template linearizeInPlaceAs<GeneralWhitening>(x, jacobian, H);
+  }
+
+ protected:
+  void fillJacobianFactor(const Values& x, JacobianFactor& jacobian,
+                          std::vector<Matrix>& H) const override {
+    NoiseModelFactor::fillJacobianFactor(x, jacobian, H);
+  }
+};
+
+// Linearize a factor in place nTimes, and return the time per call in us and
+// the number of calls to malloc per call
+static pair<double, double> timeLinearizeInPlace(
+    const NoiseModelFactor& factor, const Values& values, size_t nTimes) {
+  JacobianFactor jacobian;
+  vector<Matrix> H;
+  factor.linearizeInPlace(values, jacobian, H);  // allocates the factor once
+  const size_t mallocs = nrMallocs;
+  const auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < nTimes; ++i)
+    factor.linearizeInPlace(values, jacobian, H);
+  const chrono::duration<double, micro> time =
+      chrono::steady_clock::now() - start;
+  return make_pair(time.count() / nTimes,
+                   double(nrMallocs - mallocs) / nTimes);
+}
+
 int main(int argc, char *argv[]) {
 
   Key key = 0;
@@ -139,6 +194,100 @@ int main(int argc, char *argv[]) {
     cout << combsolve << " s" << endl;
   }
 
+  /////////////////////////////////////////////////////////////////////////////
+  // Timing test of linearizing a Pose3 chain, into new factors, or into the
+  // factors of the previous linearization
+
+  double linearize, linearizeInPlace;
+  size_t linearizeMallocs, linearizeInPlaceMallocs, nFactors;
+  {
+    const size_t nPoses = 10000;
+    NonlinearFactorGraph graph;
+    Values values;
+    const Pose3 odometry(Rot3::RzRyRx(0.01, 0.02, 0.03), Point3(1, 0, 0));
+    auto odometryNoise = noiseModel::Isotropic::Sigma(6, 0.1);
+    graph.addPrior(0, Pose3(), noiseModel::Isotropic::Sigma(6, 0.01));
+    values.insert(0, Pose3());
+    for (size_t i = 0; i + 1 < nPoses; ++i) {
+      graph.emplace_shared<BetweenFactor<Pose3> >(i, i + 1, odometry,
+                                                   odometryNoise);
+      values.insert(i + 1, values.at<Pose3>(i) * odometry);
+    }
+    nFactors = graph.size();
+
+    cout << "Linearizing a Pose3 chain into new factors... ";
+    cout.flush();
+    size_t mallocs = nrMallocs;
+    gttic_(linearize);
+    for (size_t trial = 0; trial < nTrials; ++trial)
+      GaussianFactorGraph::shared_ptr linear = graph.linearize(values);
+    gttoc_(linearize);
+    linearizeMallocs = nrMallocs - mallocs;
+    tictoc_getNode(linearizeNode, linearize);
+    linearize = linearizeNode->secs();
+    cout << linearize << " s" << endl;
+
+    cout << "Linearizing a Pose3 chain in place... ";
+    cout.flush();
+    GaussianFactorGraph linear;
+    graph.linearizeInPlace(values, linear);  // allocates the factors once
+    mallocs = nrMallocs;
+    gttic_(linearizeInPlace);
+    for (size_t trial = 0; trial < nTrials; ++trial)
+      graph.linearizeInPlace(values, linear);
+    gttoc_(linearizeInPlace);
+    linearizeInPlaceMallocs = nrMallocs - mallocs;
+    tictoc_getNode(linearizeInPlaceNode, linearizeInPlace);
+    linearizeInPlace = linearizeInPlaceNode->secs();
+    cout << linearizeInPlace << " s" << endl;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // Timing test of whitening single Pose3 factors with fixed-size products,
+  // or in general, for different noise models
+
+  struct WhiteningTime {
+    string factor;
+    pair<double, double> fixedSize, general;
+  };
+  vector<WhiteningTime> whiteningTimes;
+  {
+    const size_t nTimes = 200000;
+    const Pose3 measured(Rot3::RzRyRx(0.01, 0.02, 0.03), Point3(1, 0, 0));
+    Values values;
+    values.insert(0, Pose3(Rot3::RzRyRx(0.1, 0.2, 0.3), Point3(1, 2, 3)));
+    values.insert(1, values.at<Pose3>(0) * measured * measured);
+
+    const Matrix6 covariance = 0.01 * (Matrix6::Identity() + Matrix6::Ones());
+    const vector<pair<string, SharedNoiseModel> > models{
+        {"Isotropic", noiseModel::Isotropic::Sigma(6, 0.1)},
+        {"Gaussian", noiseModel::Gaussian::Covariance(covariance)},
+        {"Huber", noiseModel::Robust::Create(
+                      noiseModel::mEstimator::Huber::Create(0.1),
+                      noiseModel::Isotropic::Sigma(6, 0.1))}};
+
+    cout << "Whitening single Pose3 factors... ";
+    cout.flush();
+    for (const auto& model : models) {
+      const BetweenFactor<Pose3> between(0, 1, measured, model.second);
+      const GeneralWhitening<BetweenFactor<Pose3> > generalBetween(
+          0, 1, measured, model.second);
+      whiteningTimes.push_back(
+          {"BetweenFactor<Pose3>, " + model.first,
+           timeLinearizeInPlace(between, values, nTimes),
+           timeLinearizeInPlace(generalBetween, values, nTimes)});
+
+      const PriorFactor<Pose3> prior(1, measured, model.second);
+      const GeneralWhitening<PriorFactor<Pose3> > generalPrior(1, measured,
+                                                               model.second);
+      whiteningTimes.push_back({"PriorFactor<Pose3>, " + model.first,
+                                timeLinearizeInPlace(prior, values, nTimes),
+                                timeLinearizeInPlace(generalPrior, values,
+                                                     nTimes)});
+    }
+    cout << "done" << endl;
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // Print per-graph times
   cout << "\nPer-factor-graph times for building and solving\n";
@@ -152,6 +301,18 @@ int main(int argc, char *argv[]) {
       "  total " << (((blockbuild+blocksolve)-(combbuild+combsolve)) / (blockbuild+blocksolve)) << "\n" <<
       "  build " << ((blockbuild-combbuild) / blockbuild) << "\n" <<
       "  solve " << ((blocksolve-combsolve) / blocksolve) << "\n";
+  cout << "\nPer-factor times and calls to malloc for linearizing\n";
+  const double perFactor = 1.0 / double(nTrials * nFactors);
+  cout << "New factors:  " << (1e6 * linearize * perFactor) << " us, "
+       << (linearizeMallocs * perFactor) << " mallocs\n";
+  cout << "In place:     " << (1e6 * linearizeInPlace * perFactor) << " us, "
+       << (linearizeInPlaceMallocs * perFactor) << " mallocs\n";
+  cout << "\nPer-factor times and calls to malloc for linearizing in place, "
+          "with fixed-size or general whitening\n";
+  for (const WhiteningTime& t : whiteningTimes)
+    cout << t.factor << ":  fixed-size " << t.fixedSize.first << " us, "
+         << t.fixedSize.second << " mallocs,  general " << t.general.first
+         << " us, " << t.general.second << " mallocs\n";
   cout << endl;
 
   return 0;
@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeInitializePose3.cpp
+ * @brief   time the chordal and gradient rotation initialization of Pose3 graphs
+ * @date    October, 2026
+ *
+ * Usage: timeInitializePose3 [g2o file], e.g., sphere2500.txt (the default)
+ * or parking-garage.g2o.
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/slam/InitializePose3.h>
+#include <gtsam/slam/dataset.h>
+
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+
+int main(int argc, char* argv[]) {
+  const string g2oFile =
+      argc > 1 ? argv[1] : findExampleDataFile("sphere2500");
+  const int r = 10;
+
+  // Some files, e.g., sphere2500.txt, only contain edges
+  NonlinearFactorGraph::shared_ptr graph;
+  boost::tie(graph, boost::tuples::ignore) = readG2o(g2oFile, true);
+  const KeySet keys = graph->keys();
+  graph->addPrior(*keys.begin(), Pose3(), noiseModel::Unit::Create(6));
+  const NonlinearFactorGraph pose3Graph =
+      InitializePose3::buildPose3graph(*graph);
+  cout << "NOTE:  Times are reported for " << r << " repetitions on "
+       << g2oFile << " with " << keys.size() << " poses and "
+       << graph->size() << " factors" << endl;
+
+  // Start the gradient method from the chordal orientations
+  Values guess;
+  for (const auto key_value :
+       InitializePose3::computeOrientationsChordal(pose3Graph))
+    guess.insert(key_value.key, Pose3(key_value.value.cast<Rot3>(), Point3()));
+
+  // Chordal relaxation with a Gaussian factor graph, as before
+  gttic_(chordal_factor_graph);
+  for (int i = 0; i < r; i++)
+    InitializePose3::normalizeRelaxedRotations(
+        InitializePose3::buildLinearOrientationGraph(pose3Graph).optimize());
+  gttoc_(chordal_factor_graph);
+
+  // Chordal relaxation with a new solver every time
+  gttic_(chordal_solver);
+  for (int i = 0; i < r; i++)
+    InitializePose3::computeOrientationsChordal(pose3Graph);
+  gttoc_(chordal_solver);
+
+  // Chordal relaxation re-using the symbolic factorization
+  ChordalRelaxationSolver solver;
+  solver.solve(pose3Graph);
+  gttic_(chordal_solver_reused);
+  for (int i = 0; i < r; i++) solver.solve(pose3Graph);
+  gttoc_(chordal_solver_reused);
+
+  gttic_(gradient);
+  for (int i = 0; i < r; i++)
+    InitializePose3::computeOrientationsGradient(pose3Graph, guess);
+  gttoc_(gradient);
+
+  gttic_(initialize);
+  for (int i = 0; i < r; i++) InitializePose3::initialize(*graph);
+  gttoc_(initialize);
+
+  // Print timings
+  tictoc_print_();
+
+  return 0;
+}
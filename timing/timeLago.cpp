@@ -10,8 +10,10 @@
  * -------------------------------------------------------------------------- */
 
 /**
- * @file    timeVirtual.cpp
- * @brief   Time the overhead of using virtual destructors and methods
+ * @file    timeLago.cpp
+ * @brief   Time LAGO initialization, on synthetic grids and on a dataset
+ *
+ * Usage: timeLago [dataset], e.g., w10000
  * @author  Richard Roberts
  * @date    Dec 3, 2010
  */
@@ -24,18 +26,60 @@
 #include <gtsam/base/timing.h>
 
 #include <iostream>
+#include <random>
 
 using namespace std;
 using namespace gtsam;
 
-int main(int argc, char *argv[]) {
+/* ************************************************************************* */
+// A noisy side*side grid of poses, with a prior on the first pose. Poses are
+// numbered row by row, alternating the direction, so that consecutive poses
+// are neighbors and form an odometric path; every pose is also connected to
+// its neighbor in the next row.
+NonlinearFactorGraph createGrid(size_t side) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> normal(0.0, 1.0);
+  const Vector3 sigmas(0.05, 0.05, 2.0 * M_PI / 180.0);
+  const auto model = noiseModel::Diagonal::Sigmas(sigmas);
+  auto noisy = [&](const Pose2& measured) {
+    return measured.retract(Vector3(sigmas(0) * normal(rng),
+                                    sigmas(1) * normal(rng),
+                                    sigmas(2) * normal(rng)));
+  };
+  // Column of pose k, and its ground truth
+  auto column = [side](size_t k) {
+    const size_t row = k / side;
+    return row % 2 ? side - 1 - k % side : k % side;
+  };
+  auto pose = [&](size_t k) {
+    return Pose2(column(k), k / side, 0.5 * M_PI * ((k / side + column(k)) % 4));
+  };
+
+  NonlinearFactorGraph graph;
+  graph.reserve(2 * side * side);
+  graph.addPrior(0, pose(0),
+                 noiseModel::Diagonal::Sigmas(Vector3(1e-6, 1e-6, 1e-8)));
+  for (size_t k = 1; k < side * side; k++)
+    graph.emplace_shared<BetweenFactor<Pose2> >(
+        k - 1, k, noisy(pose(k - 1).between(pose(k))), model);
+  for (size_t k = 0; k + side < side * side; k++) {
+    // the neighbor in the next row is the mirror image of k
+    const size_t above = (k / side + 1) * side + (side - 1 - k % side);
+    graph.emplace_shared<BetweenFactor<Pose2> >(
+        k, above, noisy(pose(k).between(pose(above))), model);
+  }
+  return graph;
+}
+
+/* ************************************************************************* */
+// LAGO and Gauss-Newton on a dataset with ground truth, such as w10000
+void timeDataset(const string& inputFile) {
 
   size_t trials = 1;
 
   // read graph
   Values::shared_ptr solution;
   NonlinearFactorGraph::shared_ptr g;
-  string inputFile = findExampleDataFile("w10000");
   SharedDiagonal model = noiseModel::Diagonal::Sigmas((Vector(3) << 0.05, 0.05, 5.0 * M_PI / 180.0).finished());
   boost::tie(g, solution) = load2D(inputFile, model);
 
@@ -77,6 +121,46 @@ int main(int argc, char *argv[]) {
   }
 
   tictoc_print_();
+  tictoc_reset_();
+}
+
+/* ************************************************************************* */
+int main(int argc, char *argv[]) {
+  if (argc > 1) timeDataset(findExampleDataFile(argv[1]));
+
+  // LAGO on synthetic grids, up to a million poses, with the odometric path
+  // and with a breadth-first spanning tree. Factorizing the linear system on
+  // full poses of the largest grid needs many GB, so only the orientations
+  // are computed there.
+  for (size_t side : {100, 316, 1000}) {
+    const NonlinearFactorGraph grid = createGrid(side);
+    cout << "grid " << side << "x" << side << ": " << grid.size()
+         << " factors" << endl;
+    {
+      gttic_(orientations);
+      {
+        gttic_(odometric_path);
+        lago::initializeOrientations(grid);
+      }
+      {
+        gttic_(breadth_first_tree);
+        lago::initializeOrientations(grid, false);
+      }
+    }
+    if (side < 1000) {
+      gttic_(initialize);
+      {
+        gttic_(odometric_path);
+        lago::initialize(grid);
+      }
+      {
+        gttic_(breadth_first_tree);
+        lago::initialize(grid, false);
+      }
+    }
+    tictoc_print_();
+    tictoc_reset_();
+  }
 
   return 0;
 }
@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timePose3Batch.cpp
+ * @brief   time structure-of-arrays Rot3/Pose3 operations against scalar calls
+ * @date    October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose3Batch.h>
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+
+/* ************************************************************************* */
+// Time the scalar STATEMENT for every element k, and the BATCH statement once,
+// both repeated r times.
+#define TEST(TITLE, STATEMENT, BATCH)         \
+  gttic_(TITLE##_scalar);                     \
+  for (int i = 0; i < r; i++)                 \
+    for (size_t k = 0; k < n; k++) STATEMENT; \
+  gttoc_(TITLE##_scalar);                     \
+  gttic_(TITLE##_batch);                      \
+  for (int i = 0; i < r; i++) BATCH;          \
+  gttoc_(TITLE##_batch);
+
+int main() {
+  const size_t n = 100000;
+  const int r = 10;
+  cout << "NOTE:  Times are reported for " << r << " x " << n
+       << " elements" << endl;
+
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  Vector6Batch xi(n, 6);
+  Point3Batch points(n, 3);
+  for (size_t k = 0; k < n; k++) {
+    for (int j = 0; j < 6; j++) xi(k, j) = uniform(rng);
+    for (int j = 0; j < 3; j++) points(k, j) = 10 * uniform(rng);
+  }
+
+  // Scalar inputs and outputs
+  vector<Vector6> xis(n);
+  vector<Vector3> omegas(n);
+  vector<Point3> ps(n), qs(n);
+  for (size_t k = 0; k < n; k++) {
+    xis[k] = xi.row(k);
+    omegas[k] = xis[k].head<3>();
+    ps[k] = points.row(k);
+  }
+  vector<Pose3> poses(n), others(n), results(n);
+  vector<Rot3> rotations(n), rotationResults(n);
+  for (size_t k = 0; k < n; k++) {
+    poses[k] = Pose3::Expmap(xis[k]);
+    others[k] = Pose3::Expmap(-0.5 * xis[k]);
+    rotations[k] = poses[k].rotation();
+  }
+  vector<Vector6> logs(n);
+  vector<Vector3> rotationLogs(n);
+  Matrix3 H3;
+  Matrix36 H36;
+  Matrix6 H6;
+
+  // Batch inputs and outputs
+  const Vector3Batch omega = xi.leftCols<3>();
+  const Pose3Batch poseBatch(poses), otherBatch(others);
+  const Rot3Batch& rotationBatch = poseBatch.rotations();
+  Pose3Batch poseResult;
+  Rot3Batch rotationResult;
+  Point3Batch pointResult;
+  Vector3Batch rotationLog;
+  Vector6Batch log;
+  JacobianBatch<3, 3> J3;
+  JacobianBatch<3, 6> J36;
+  JacobianBatch<6, 6> J6;
+
+  TEST(Rot3_compose, rotationResults[k] = rotations[k] * rotations[k],
+       rotationResult = rotationBatch * rotationBatch)
+  TEST(Rot3_Expmap, rotationResults[k] = Rot3::Expmap(omegas[k]),
+       rotationResult = Rot3Batch::Expmap(omega))
+  TEST(Rot3_Expmap_derivative,
+       rotationResults[k] = Rot3::Expmap(omegas[k], H3),
+       rotationResult = Rot3Batch::Expmap(omega, &J3))
+  TEST(Rot3_Logmap, rotationLogs[k] = Rot3::Logmap(rotations[k]),
+       rotationLog = Rot3Batch::Logmap(rotationBatch))
+  TEST(Rot3_Logmap_derivative,
+       rotationLogs[k] = Rot3::Logmap(rotations[k], H3),
+       rotationLog = Rot3Batch::Logmap(rotationBatch, &J3))
+  TEST(Pose3_compose, results[k] = poses[k] * others[k],
+       poseResult = poseBatch * otherBatch)
+  TEST(Pose3_inverse, results[k] = poses[k].inverse(),
+       poseResult = poseBatch.inverse())
+  TEST(transformFrom, qs[k] = poses[k].transformFrom(ps[k]),
+       pointResult = poseBatch.transformFrom(points))
+  TEST(transformFrom_derivatives,
+       qs[k] = poses[k].transformFrom(ps[k], H36, H3),
+       pointResult = poseBatch.transformFrom(points, &J36, &J3))
+  TEST(transformTo, qs[k] = poses[k].transformTo(ps[k]),
+       pointResult = poseBatch.transformTo(points))
+  TEST(transformTo_derivatives, qs[k] = poses[k].transformTo(ps[k], H36, H3),
+       pointResult = poseBatch.transformTo(points, &J36, &J3))
+  TEST(Pose3_Expmap, results[k] = Pose3::Expmap(xis[k]),
+       poseResult = Pose3Batch::Expmap(xi))
+  TEST(Pose3_Expmap_derivative, results[k] = Pose3::Expmap(xis[k], H6),
+       poseResult = Pose3Batch::Expmap(xi, &J6))
+  TEST(Pose3_Logmap, logs[k] = Pose3::Logmap(poses[k]),
+       log = Pose3Batch::Logmap(poseBatch))
+  TEST(Pose3_Logmap_derivative, logs[k] = Pose3::Logmap(poses[k], H6),
+       log = Pose3Batch::Logmap(poseBatch, &J6))
+
+  // Print timings
+  tictoc_print_();
+
+  return 0;
+}
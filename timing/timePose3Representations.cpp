@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timePose3Representations.cpp
+ * @brief   time BetweenFactor linearization with matrix and quaternion poses
+ * @date    October, 2026
+ */
+
+#include <gtsam/base/timing.h>
+#include <gtsam/geometry/Pose3T.h>
+#include <gtsam/inference/Symbol.h>
+#include <gtsam/linear/GaussianFactorGraph.h>
+#include <gtsam/linear/VectorValues.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/slam/BetweenFactor.h>
+
+#include <iostream>
+#include <random>
+
+using namespace std;
+using namespace gtsam;
+using symbol_shorthand::X;
+
+/* ************************************************************************* */
+// A noisy helix of n poses, with a prior, odometry and a loop closure every
+// 10 poses, as a graph and values for POSE, which is constructed from a Pose3.
+template <class POSE>
+void createPoseGraph(size_t n, NonlinearFactorGraph* graph, Values* values) {
+  std::mt19937 rng(42);
+  std::normal_distribution<double> noise(0.0, 0.05);
+  auto randomTwist = [&]() {
+    Vector6 xi;
+    for (int i = 0; i < 6; i++) xi(i) = noise(rng);
+    return xi;
+  };
+
+  const auto model = noiseModel::Isotropic::Sigma(6, 0.1);
+  const Pose3 step(Rot3::Ypr(0.1, 0.01, 0), Point3(1, 0, 0.05));
+  vector<Pose3> poses{Pose3()};
+  for (size_t i = 1; i < n; i++) poses.push_back(poses.back() * step);
+  for (size_t i = 0; i < n; i++)
+    values->insert(X(i), POSE(poses[i].retract(randomTwist())));
+  graph->addPrior(X(0), POSE(poses[0]), model);
+  for (size_t i = 0; i + 1 < n; i++)
+    graph->emplace_shared<BetweenFactor<POSE> >(
+        X(i), X(i + 1), POSE(step.retract(randomTwist())), model);
+  for (size_t i = 10; i < n; i += 10)
+    graph->emplace_shared<BetweenFactor<POSE> >(
+        X(i - 10), X(i), POSE(poses[i - 10].between(poses[i])), model);
+}
+
+/* ************************************************************************* */
+// Time linearize and retract of the whole graph, and n compositions.
+template <class POSE>
+void timeRepresentation(size_t n, int r) {
+  NonlinearFactorGraph graph;
+  Values values;
+  createPoseGraph<POSE>(n, &graph, &values);
+  const VectorValues delta = graph.linearize(values)->optimize();
+
+  gttic_(linearize);
+  for (int i = 0; i < r; i++) graph.linearize(values);
+  gttoc_(linearize);
+
+  gttic_(retract);
+  for (int i = 0; i < r; i++) values.retract(delta);
+  gttoc_(retract);
+
+  const POSE step = values.at<POSE>(X(1));
+  POSE pose;
+  gttic_(compose);
+  for (int i = 0; i < r; i++)
+    for (size_t j = 0; j < n; j++) pose = pose * step;
+  gttoc_(compose);
+  // Use the result, so the loop is not optimized away
+  if (!pose.translation().allFinite()) cout << "overflow" << endl;
+}
+
+/* ************************************************************************* */
+int main() {
+  const size_t n = 10000;
+  const int r = 20;
+  cout << "NOTE:  Times are reported for " << r << " repetitions on " << n
+       << " poses" << endl;
+
+#ifdef GTSAM_USE_QUATERNIONS
+  cout << "Pose3 uses quaternions" << endl;
+#else
+  cout << "Pose3 uses rotation matrices" << endl;
+#endif
+
+  {
+    gttic_(Pose3);
+    timeRepresentation<Pose3>(n, r);
+  }
+  {
+    gttic_(Pose3M);
+    timeRepresentation<Pose3M>(n, r);
+  }
+  {
+    gttic_(Pose3Q);
+    timeRepresentation<Pose3Q>(n, r);
+  }
+
+  // Print timings
+  tictoc_print_();
+
+  return 0;
+}
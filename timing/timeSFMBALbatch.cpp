@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------------
+
+ * GTSAM Copyright 2010, Georgia Tech Research Corporation,
+ * Atlanta, Georgia 30332-0415
+ * All Rights Reserved
+ * Authors: Frank Dellaert, et al. (see THANKS for the full author list)
+
+ * See LICENSE for the license information
+
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @file    timeSFMBALbatch.cpp
+ * @brief   time linearizing a BAL file, ExpressionFactors vs. one batch
+ * @date    October, 2026
+ */
+
+#include "timeSFMBAL.h"
+
+#include <gtsam/slam/expressions.h>
+#include <gtsam/nonlinear/ExpressionFactor.h>
+#include <gtsam/nonlinear/ExpressionFactorBatch.h>
+#include <gtsam/geometry/Cal3Bundler.h>
+#include <gtsam/geometry/Point3.h>
+
+#include <iostream>
+
+using namespace std;
+using namespace gtsam;
+
+static const size_t kNrRepeats = 10;
+
+int main(int argc, char* argv[]) {
+  // parse options and read BAL file
+  SfmData db = preamble(argc, argv);
+
+  // Same expression as timeSFMBALcamTnav, batch in terms of placeholders
+  auto projection = [](Key i, Key j, Key k) {
+    return uncalibrate(Cal3Bundler_(k),
+                       project(transformFrom(Pose3_(i), Point3_(j))));
+  };
+  ExpressionFactorBatch<Point2> batch(gNoiseModel, projection(0, 1, 2));
+
+  NonlinearFactorGraph graph;
+  for (size_t j = 0; j < db.numberTracks(); j++) {
+    for (const SfmMeasurement& m: db.tracks[j].measurements) {
+      size_t i = m.first;
+      Point2 z = m.second;
+      graph.addExpressionFactor(gNoiseModel, z, projection(C(i), P(j), K(i)));
+      batch.add(z, {C(i), P(j), K(i)});
+    }
+  }
+
+  Values initial;
+  size_t i = 0, j = 0;
+  for (const SfmCamera& camera: db.cameras) {
+    initial.insert(C(i), camera.pose().inverse());
+    initial.insert(K(i), camera.calibration());
+    i += 1;
+  }
+  for (const SfmTrack& track: db.tracks)
+    initial.insert(P(j++), track.p);
+
+  cout << "error: " << graph.error(initial) << " (factors), "
+       << batch.error(initial) << " (batch)" << endl;
+
+  for (size_t n = 0; n < kNrRepeats; n++) {
+    {
+      gttic_(linearize_factors);
+      graph.linearize(initial);
+    }
+    {
+      gttic_(linearize_batch);
+      batch.linearize(initial);
+    }
+    {
+      gttic_(error_factors);
+      graph.error(initial);
+    }
+    {
+      gttic_(error_batch);
+      batch.error(initial);
+    }
+    tictoc_finishedIteration_();
+  }
+  tictoc_print_();
+
+  return 0;
+}
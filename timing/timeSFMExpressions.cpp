@@ -29,6 +29,7 @@ using namespace std;
 using namespace gtsam;
 
 //#define TERNARY
+//#define COMPILED
 
 int main() {
 
@@ -62,6 +63,9 @@ int main() {
           (model, z, project3(x[i], p[j], K));
 #else
           (model, z, uncalibrate(K, project(transformTo(x[i], p[j]))));
+#endif
+#ifdef COMPILED
+      boost::static_pointer_cast<ExpressionFactor<Point2> >(f)->compile();
 #endif
       graph.push_back(f);
     }